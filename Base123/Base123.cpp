@@ -19,7 +19,14 @@
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
 #include "Base123_FDistance.h"
+#include "Base123_FDistance_AA.h"
+#include "Base123_Background_Export.h"
+#include "Base123_Results_Store.h"
+#include "Base123_Sketch.h"
+#include "Base123_MPI.h"
 #include "Base123_FRESH.h"
+#include "Base123_Shuffler.h"
+#include "Base123_Sequence_Archive.h"
 #include "Base123_Fold.h"
 #include "Base123_Structureome_Mgr.h"
 
@@ -39,7 +46,7 @@
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-int main(int nArgumentCount, char* chpArguments[])
+int ProcessCommandLine(int nArgumentCount, char* chpArguments[])
 {
 	//  Parameter report
 	string strReport = "";
@@ -139,6 +146,12 @@ int main(int nArgumentCount, char* chpArguments[])
 
 				return 0;
 			}
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_create_sequence_archive") || (ConvertStringToLowerCase(vArgs[1]) == "-hcsa"))
+			{
+				ReportCreateSequenceArchiveHelp();
+
+				return 0;
+			}
 			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_parse_porf_to_orf") || (ConvertStringToLowerCase(vArgs[1]) == "-hppto"))
 			{
 				ReportListParsePORFtoORFHelp();
@@ -163,6 +176,24 @@ int main(int nArgumentCount, char* chpArguments[])
 
 				return 0;
 			}
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_refresh_gbk_catalog") || (ConvertStringToLowerCase(vArgs[1]) == "-hrgc"))
+			{
+				ReportRefreshGBKCatalogHelp();
+
+				return 0;
+			}
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_compile_catalog") || (ConvertStringToLowerCase(vArgs[1]) == "-hccat"))
+			{
+				ReportCompileCatalogHelp();
+
+				return 0;
+			}
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_query_catalog") || (ConvertStringToLowerCase(vArgs[1]) == "-hqcat"))
+			{
+				ReportQueryCatalogHelp();
+
+				return 0;
+			}
 			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_list_shuffle_fa_files") || (ConvertStringToLowerCase(vArgs[1]) == "-hlsff"))
 			{
 				ReportFRESHHelp();
@@ -181,6 +212,24 @@ int main(int nArgumentCount, char* chpArguments[])
 
 				return 0;
 			}
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_contabulate_results_store") || (ConvertStringToLowerCase(vArgs[1]) == "-hcrs"))
+			{
+				ReportContabulateResultsStoreHelp();
+
+				return 0;
+			}
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_list_build_sketch_index") || (ConvertStringToLowerCase(vArgs[1]) == "-hlbsi"))
+			{
+				ReportListBuildSketchIndexHelp();
+
+				return 0;
+			}
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_list_query_sketch_index") || (ConvertStringToLowerCase(vArgs[1]) == "-hlqsi"))
+			{
+				ReportListQuerySketchIndexHelp();
+
+				return 0;
+			}
 			else if ((ConvertStringToLowerCase(vArgs[1]) == "-help_list_clear_fdistance_output") || (ConvertStringToLowerCase(vArgs[1]) == "-hlclfo"))
 			{
 				ReportListClearFDistanceOutputHelp();
@@ -363,8 +412,9 @@ int main(int nArgumentCount, char* chpArguments[])
 				//         <output_list_file_path_name>
 				//         <error_file_path_name>
 				//         <max_processors>
+				//         [-archive [-ar] <archive_file_path_name>] (optional)
 
-				if (nArgumentCount == 9)
+				if ((nArgumentCount == 9) || ((nArgumentCount == 11) && ((ConvertStringToLowerCase(vArgs[9]) == "-archive") || (ConvertStringToLowerCase(vArgs[9]) == "-ar"))))
 				{
 					string strInputFilePathNameList = "";
 					string strInputFilePathNameTransform = "";
@@ -373,6 +423,7 @@ int main(int nArgumentCount, char* chpArguments[])
 					string strOutputListFilePathName = "";
 					string strErrorFilePathName = "";
 					int nMaxProcs = 0;
+					string strArchiveFilePathName = "";
 
 					strInputFilePathNameList = vArgs[2];
 					strInputFilePathNameTransform = vArgs[3];
@@ -381,8 +432,10 @@ int main(int nArgumentCount, char* chpArguments[])
 					strOutputListFilePathName = vArgs[6];
 					strErrorFilePathName = vArgs[7];
 					stringstream(vArgs[8]) >> nMaxProcs;
+					if (nArgumentCount == 11)
+						strArchiveFilePathName = vArgs[10];
 
-					if (!ListParseFAtoPORF(strInputFilePathNameList, strInputFilePathNameTransform, nMinORFLength, nMaxORFLength, strOutputListFilePathName, strErrorFilePathName, nMaxProcs))
+					if (!ListParseFAtoPORF(strInputFilePathNameList, strInputFilePathNameTransform, nMinORFLength, nMaxORFLength, strOutputListFilePathName, strErrorFilePathName, nMaxProcs, strArchiveFilePathName))
 					{
 						ReportTimeStamp(vArgs[0], "ERROR:  List Parse .fa to .pORF File(s) Failed");
 
@@ -396,6 +449,46 @@ int main(int nArgumentCount, char* chpArguments[])
 					return -1;
 				}
 			}
+			//  Create sequence archive
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-create_sequence_archive") || (ConvertStringToLowerCase(vArgs[1]) == "-csa"))
+			{
+				//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5>
+				//    -create_sequence_archive [-csa]
+				//         <input_file_path_name_list>
+				//         <input_file_path_name_transform>
+				//         <output_archive_file_path_name>
+				//         <error_file_path_name>
+				//         <max_processors>
+
+				if (nArgumentCount == 7)
+				{
+					string strInputFilePathNameList = "";
+					string strInputFilePathNameTransform = "";
+					string strOutputArchiveFilePathName = "";
+					string strErrorFilePathName = "";
+					int nMaxProcs = 1;
+
+					strInputFilePathNameList = vArgs[2];
+					strInputFilePathNameTransform = vArgs[3];
+					strOutputArchiveFilePathName = vArgs[4];
+					strErrorFilePathName = vArgs[5];
+					stringstream(vArgs[6]) >> nMaxProcs;
+
+					CBase123_Sequence_Archive b123Archive;
+					if (!b123Archive.CreateArchive(strInputFilePathNameList, strInputFilePathNameTransform, strOutputArchiveFilePathName, strErrorFilePathName, nMaxProcs))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  Create Sequence Archive Failed");
+
+						return -1;
+					}
+				}
+				else
+				{
+					ReportTimeStamp(vArgs[0], "ERROR:  Command Line is Not Properly Formatted to Create Sequence Archive:  Use -help [-h] Switch for Assistance");
+
+					return -1;
+				}
+			}
 			//  List parse porf to orf
 			else if ((ConvertStringToLowerCase(vArgs[1]) == "-list_parse_porf_to_orf") || (ConvertStringToLowerCase(vArgs[1]) == "-lppto"))
 			{
@@ -571,6 +664,141 @@ int main(int nArgumentCount, char* chpArguments[])
 					return -1;
 				}
 			}
+			//  Refresh .gbk catalog
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-refresh_gbk_catalog") || (ConvertStringToLowerCase(vArgs[1]) == "-rgc"))
+			{
+				//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6> <arg7> <arg8> <arg9> <arg10> <arg11>
+				//    -refresh_gbk_catalog [-rgc]
+				//         <previous_catalog_file_path_name>
+				//         <input_file_path_name_list>
+				//         <input_file_path_name_transform>
+				//         <output_catalog_file_path_name>
+				//         <added_list_file_path_name>
+				//         <changed_list_file_path_name>
+				//         <removed_list_file_path_name>
+				//         <output_file_path_name_transform>
+				//         <error_file_path_name>
+				//         <max_processors>
+				//         <max_catalog_size>
+
+				if (nArgumentCount == 13)
+				{
+					string strPreviousCatalogFilePathName = "";
+					string strInputFilePathNameList = "";
+					string strInputFilePathNameTransform = "";
+					string strOutputCatalogFilePathName = "";
+					string strAddedListFilePathName = "";
+					string strChangedListFilePathName = "";
+					string strRemovedListFilePathName = "";
+					string strOutputFilePathNameTransform = "";
+					string strErrorFilePathName = "";
+					int nMaxProcs = 1;
+					long lMaxCatalogSize = 0;
+
+					strPreviousCatalogFilePathName = vArgs[2];
+					strInputFilePathNameList = vArgs[3];
+					strInputFilePathNameTransform = vArgs[4];
+					strOutputCatalogFilePathName = vArgs[5];
+					strAddedListFilePathName = vArgs[6];
+					strChangedListFilePathName = vArgs[7];
+					strRemovedListFilePathName = vArgs[8];
+					strOutputFilePathNameTransform = vArgs[9];
+					strErrorFilePathName = vArgs[10];
+					stringstream(vArgs[11]) >> nMaxProcs;
+					stringstream(vArgs[12]) >> lMaxCatalogSize;
+
+					CBase123_Catalog b123Catalog(lMaxCatalogSize);
+					if (!b123Catalog.RefreshGBKCatalog(strPreviousCatalogFilePathName, strInputFilePathNameList, strInputFilePathNameTransform, strOutputCatalogFilePathName, strAddedListFilePathName, strChangedListFilePathName, strRemovedListFilePathName, strOutputFilePathNameTransform, strErrorFilePathName, nMaxProcs))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  Refresh .gbk Catalog Failed");
+
+						return -1;
+					}
+				}
+				else
+				{
+					ReportTimeStamp(vArgs[0], "ERROR:  Command Line is Not Properly Formatted to Refresh .gbk Catalog:  Use -help [-h] Switch for Assistance");
+
+					return -1;
+				}
+			}
+			//  Compile catalog
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-compile_catalog") || (ConvertStringToLowerCase(vArgs[1]) == "-ccat"))
+			{
+				//  Usage is Base123 <switch> <arg1> <arg2> <arg3>
+				//    -compile_catalog [-ccat]
+				//         <input_catalog_file_path_name>
+				//         <output_catalog_file_path_name>
+				//         <max_catalog_size>
+
+				if (nArgumentCount == 5)
+				{
+					string strInputCatalogFilePathName = "";
+					string strOutputCatalogFilePathName = "";
+					long lMaxCatalogSize = 0;
+
+					strInputCatalogFilePathName = vArgs[2];
+					strOutputCatalogFilePathName = vArgs[3];
+					stringstream(vArgs[4]) >> lMaxCatalogSize;
+
+					CBase123_Catalog b123Catalog(lMaxCatalogSize);
+					if (!b123Catalog.CompileCatalog(strInputCatalogFilePathName, strOutputCatalogFilePathName))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  Compile Catalog Failed");
+
+						return -1;
+					}
+				}
+				else
+				{
+					ReportTimeStamp(vArgs[0], "ERROR:  Command Line is Not Properly Formatted to Compile Catalog:  Use -help [-h] Switch for Assistance");
+
+					return -1;
+				}
+			}
+			//  Query catalog
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-query_catalog") || (ConvertStringToLowerCase(vArgs[1]) == "-qcat"))
+			{
+				//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6>
+				//    -query_catalog [-qcat]
+				//         <input_catalog_file_path_name>
+				//         <query>
+				//         <output_list_file_path_name>
+				//         <output_file_path_name_transform>
+				//         <max_processors>
+				//         <max_catalog_size>
+
+				if (nArgumentCount == 8)
+				{
+					string strInputCatalogFilePathName = "";
+					string strQuery = "";
+					string strOutputListFilePathName = "";
+					string strOutputFilePathNameTransform = "";
+					int nMaxProcs = 1;
+					long lMaxCatalogSize = 0;
+
+					strInputCatalogFilePathName = vArgs[2];
+					strQuery = vArgs[3];
+					strOutputListFilePathName = vArgs[4];
+					strOutputFilePathNameTransform = vArgs[5];
+					stringstream(vArgs[6]) >> nMaxProcs;
+					stringstream(vArgs[7]) >> lMaxCatalogSize;
+
+					CBase123_Catalog b123Catalog(lMaxCatalogSize, true);
+					if (!b123Catalog.QueryCatalog(strInputCatalogFilePathName, strQuery, strOutputListFilePathName, strOutputFilePathNameTransform, nMaxProcs))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  Query Catalog Failed");
+
+						return -1;
+					}
+				}
+				else
+				{
+					ReportTimeStamp(vArgs[0], "ERROR:  Command Line is Not Properly Formatted to Query Catalog:  Use -help [-h] Switch for Assistance");
+
+					return -1;
+				}
+			}
 			//  FRESH shuffles
 			else if ((ConvertStringToLowerCase(vArgs[1]) == "-list_shuffle_fa_files") || (ConvertStringToLowerCase(vArgs[1]) == "-lsff"))
 			{
@@ -584,8 +812,10 @@ int main(int nArgumentCount, char* chpArguments[])
 				//         <output_list_file_path_name>
 				//         <error_file_path_name>
 				//         <max_processors>
+				//         [-archive [-ar] <archive_file_path_name>] (optional)
+				//         [-shuffle_seed [-ssd] <seed>] (optional)
 
-				if (nArgumentCount == 10)
+				if ((nArgumentCount >= 10) && ((nArgumentCount - 10) % 2 == 0))
 				{
 					string strInputFilePathNameList = "";
 					string strInputFilePathNameTransform = "";
@@ -595,6 +825,8 @@ int main(int nArgumentCount, char* chpArguments[])
 					string strOutputListFilePathName = "";
 					string strErrorFilePathName = "";
 					int nMaxProcs = 0;
+					string strArchiveFilePathName = "";
+					uint64_t ullSeed = m_ullShuffleDefaultSeed;
 
 					strInputFilePathNameList = vArgs[2];
 					strInputFilePathNameTransform = vArgs[3];
@@ -605,7 +837,22 @@ int main(int nArgumentCount, char* chpArguments[])
 					strErrorFilePathName = vArgs[8];
 					stringstream(vArgs[9]) >> nMaxProcs;
 
-					if (!ListshuffleFAFiles(strInputFilePathNameList, strInputFilePathNameTransform, strCatalogFilePathName, nMaxCatalogSize, nOutputCount, strOutputListFilePathName, strErrorFilePathName, nMaxProcs))
+					//  Optional switch/value pairs
+					for (int nCount = 10; nCount < nArgumentCount; nCount += 2)
+					{
+						if ((ConvertStringToLowerCase(vArgs[nCount]) == "-archive") || (ConvertStringToLowerCase(vArgs[nCount]) == "-ar"))
+							strArchiveFilePathName = vArgs[nCount + 1];
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-shuffle_seed") || (ConvertStringToLowerCase(vArgs[nCount]) == "-ssd"))
+							stringstream(vArgs[nCount + 1]) >> ullSeed;
+						else
+						{
+							ReportTimeStamp(vArgs[0], "ERROR:  Unknown List shuffle Option [" + vArgs[nCount] + "]:  Use -help [-h] Switch for Assistance");
+
+							return -1;
+						}
+					}
+
+					if (!ListshuffleFAFiles(strInputFilePathNameList, strInputFilePathNameTransform, strCatalogFilePathName, nMaxCatalogSize, nOutputCount, strOutputListFilePathName, strErrorFilePathName, nMaxProcs, strArchiveFilePathName, ullSeed))
 					{
 						ReportTimeStamp(vArgs[0], "ERROR:  List shuffle .fa File(s) Failed");
 
@@ -633,8 +880,9 @@ int main(int nArgumentCount, char* chpArguments[])
 				//         <accept_output_list_file_path_name>
 				//         <reject_output_list_file_path_name>
 				//         <max_processors>
+				//         [-archive [-ar] <archive_file_path_name>] (optional)
 
-				if (nArgumentCount == 9)
+				if ((nArgumentCount == 9) || ((nArgumentCount == 11) && ((ConvertStringToLowerCase(vArgs[9]) == "-archive") || (ConvertStringToLowerCase(vArgs[9]) == "-ar"))))
 				{
 					string strInputFilePathNameList = "";
 					string strInputFilePathNameTransform = "";
@@ -643,6 +891,7 @@ int main(int nArgumentCount, char* chpArguments[])
 					string strAcceptOutputListFilePathName = "";
 					string strRejectOutputListFilePathName = "";
 					int nMaxProcs = 0;
+					string strArchiveFilePathName = "";
 
 					strInputFilePathNameList = vArgs[2];
 					strInputFilePathNameTransform = vArgs[3];
@@ -652,8 +901,10 @@ int main(int nArgumentCount, char* chpArguments[])
 					strAcceptOutputListFilePathName = vArgs[6];
 					strRejectOutputListFilePathName = vArgs[7];
 					stringstream(vArgs[8]) >> nMaxProcs;
+					if (nArgumentCount == 11)
+						strArchiveFilePathName = vArgs[10];
 
-					if (!ListFilterForFDistance(strInputFilePathNameList, strInputFilePathNameTransform, bUseStrictFilter, nMaxPolyLimit, strAcceptOutputListFilePathName, strRejectOutputListFilePathName, nMaxProcs))
+					if (!ListFilterForFDistance(strInputFilePathNameList, strInputFilePathNameTransform, bUseStrictFilter, nMaxPolyLimit, strAcceptOutputListFilePathName, strRejectOutputListFilePathName, nMaxProcs, strArchiveFilePathName))
 					{
 						ReportTimeStamp(vArgs[0], "ERROR:  Filter F-Distance List Failed");
 
@@ -704,7 +955,7 @@ int main(int nArgumentCount, char* chpArguments[])
 					strErrorFilePathName = vArgs[9];
 					stringstream(vArgs[10]) >> nMaxProcs;
 
-					if (ListContabulateFDistanceOutput(strInputFilePathNameList, strInputFilePathNameTransform, strOutputTableFilePathName, strCatalogFilePathName, lMaxCatalogSize, nOutputCount, strOutputFileNameSuffix, strErrorFilePathName, nMaxProcs))
+					if (!ListContabulateFDistanceOutput(strInputFilePathNameList, strInputFilePathNameTransform, strOutputTableFilePathName, strCatalogFilePathName, lMaxCatalogSize, nOutputCount, strOutputFileNameSuffix, strErrorFilePathName, nMaxProcs))
 					{
 						ReportTimeStamp(vArgs[0], "ERROR:  Contabulate F-Distance Output Failed");
 
@@ -718,6 +969,141 @@ int main(int nArgumentCount, char* chpArguments[])
 					return -1;
 				}
 			}
+			//  Contabulate F-Distance results store
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-contabulate_results_store") || (ConvertStringToLowerCase(vArgs[1]) == "-crs"))
+			{
+				//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6>
+				//    -contabulate_results_store [-crs]
+				//         <results_store_file_path_name>
+				//         <output_table_file_path_name>
+				//         <catalog_file_path_name>
+				//         <max_catalog_size>
+				//         <error_file_path_name>
+				//         <max_processors>
+
+				if (nArgumentCount == 8)
+				{
+					string strStoreFilePathName = "";
+					string strOutputTableFilePathName = "";
+					string strCatalogFilePathName = "";
+					long lMaxCatalogSize = 0;
+					string strErrorFilePathName = "";
+					int nMaxProcs = 0;
+
+					strStoreFilePathName = vArgs[2];
+					strOutputTableFilePathName = vArgs[3];
+					strCatalogFilePathName = vArgs[4];
+					stringstream(vArgs[5]) >> lMaxCatalogSize;
+					strErrorFilePathName = vArgs[6];
+					stringstream(vArgs[7]) >> nMaxProcs;
+
+					if (!ContabulateResultsStore(strStoreFilePathName, strOutputTableFilePathName, strCatalogFilePathName, lMaxCatalogSize, strErrorFilePathName, nMaxProcs))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  Contabulate Results Store Failed");
+
+						return -1;
+					}
+				}
+				else
+				{
+					ReportTimeStamp(vArgs[0], "ERROR:  Command Line is Not Properly Formatted to Contabulate Results Store:  Use -help [-h] Switch for Assistance");
+
+					return -1;
+				}
+			}
+			//  Build sketch index
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-list_build_sketch_index") || (ConvertStringToLowerCase(vArgs[1]) == "-lbsi"))
+			{
+				//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6> <arg7>
+				//    -list_build_sketch_index [-lbsi]
+				//         <input_file_path_name_list>
+				//         <input_file_path_name_transform>
+				//         <kmer_length>
+				//         <sketch_size>
+				//         <index_file_path_name>
+				//         <error_file_path_name>
+				//         <max_processors>
+
+				if (nArgumentCount == 9)
+				{
+					string strInputFilePathNameList = "";
+					string strInputFilePathNameTransform = "";
+					int nKMerLength = 0;
+					int nSketchSize = 0;
+					string strIndexFilePathName = "";
+					string strErrorFilePathName = "";
+					int nMaxProcs = 0;
+
+					strInputFilePathNameList = vArgs[2];
+					strInputFilePathNameTransform = vArgs[3];
+					stringstream(vArgs[4]) >> nKMerLength;
+					stringstream(vArgs[5]) >> nSketchSize;
+					strIndexFilePathName = vArgs[6];
+					strErrorFilePathName = vArgs[7];
+					stringstream(vArgs[8]) >> nMaxProcs;
+
+					if (!ListBuildSketchIndex(strInputFilePathNameList, strInputFilePathNameTransform, nKMerLength, nSketchSize, strIndexFilePathName, strErrorFilePathName, nMaxProcs))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  Build Sketch Index Failed");
+
+						return -1;
+					}
+				}
+				else
+				{
+					ReportTimeStamp(vArgs[0], "ERROR:  Command Line is Not Properly Formatted to Build Sketch Index:  Use -help [-h] Switch for Assistance");
+
+					return -1;
+				}
+			}
+			//  Query sketch index
+			else if ((ConvertStringToLowerCase(vArgs[1]) == "-list_query_sketch_index") || (ConvertStringToLowerCase(vArgs[1]) == "-lqsi"))
+			{
+				//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6> <arg7> <arg8>
+				//    -list_query_sketch_index [-lqsi]
+				//         <index_file_path_name>
+				//         <input_file_path_name_list>
+				//         <input_file_path_name_transform>
+				//         <nearest_count>
+				//         <output_table_file_path_name>
+				//         <background_list_file_path_base_name>
+				//         <error_file_path_name>
+				//         <max_processors>
+
+				if (nArgumentCount == 10)
+				{
+					string strIndexFilePathName = "";
+					string strInputFilePathNameList = "";
+					string strInputFilePathNameTransform = "";
+					int nTopCount = 0;
+					string strOutputTableFilePathName = "";
+					string strBackgroundListFilePathBaseName = "";
+					string strErrorFilePathName = "";
+					int nMaxProcs = 0;
+
+					strIndexFilePathName = vArgs[2];
+					strInputFilePathNameList = vArgs[3];
+					strInputFilePathNameTransform = vArgs[4];
+					stringstream(vArgs[5]) >> nTopCount;
+					strOutputTableFilePathName = vArgs[6];
+					strBackgroundListFilePathBaseName = vArgs[7];
+					strErrorFilePathName = vArgs[8];
+					stringstream(vArgs[9]) >> nMaxProcs;
+
+					if (!ListQuerySketchIndex(strIndexFilePathName, strInputFilePathNameList, strInputFilePathNameTransform, nTopCount, strOutputTableFilePathName, strBackgroundListFilePathBaseName, strErrorFilePathName, nMaxProcs))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  Query Sketch Index Failed");
+
+						return -1;
+					}
+				}
+				else
+				{
+					ReportTimeStamp(vArgs[0], "ERROR:  Command Line is Not Properly Formatted to Query Sketch Index:  Use -help [-h] Switch for Assistance");
+
+					return -1;
+				}
+			}
 			//  Clear F-Distance output
 			else if ((ConvertStringToLowerCase(vArgs[1]) == "-list_clear_fdistance_output") || (ConvertStringToLowerCase(vArgs[1]) == "-lclfo"))
 			{
@@ -788,8 +1174,21 @@ int main(int nArgumentCount, char* chpArguments[])
 				//         <foreground_error_file_path_name>
 				//         <nmer_length>
 				//         <max_processors>
-
-				if (nArgumentCount == 20)
+				//         [-resume_journal [-rj] <journal_file_path_name>] (optional)
+				//         [-memory_budget [-mb] <background_memory_budget_mb>] (optional)
+				//         [-alphabet [-ab] <nucleotide|amino_acid|reduced_amino_acid>] (optional)
+				//         [-cds_table [-cdst] <cds_table_file_path_name>] (optional)
+				//         [-background_export [-be] <export_file_path_base_name>] (optional)
+				//         [-background_export_format [-bef] <text|2bit|delta>] (optional)
+				//         [-background_export_set [-bes] <present|absent|both>] (optional)
+				//         [-results_store [-rs] <results_store_file_path_name>] (optional)
+				//         [-shuffle_count [-sc] <shuffles_per_genome>] (optional)
+				//         [-shuffle_table [-st] <shuffle_table_file_path_name>] (optional)
+				//         [-store_shuffles [-ss] <y | n>] (optional)
+				//         [-archive [-ar] <archive_file_path_name>] (optional)
+				//         [-shuffle_seed [-ssd] <seed>] (optional)
+
+				if ((nArgumentCount >= 20) && ((nArgumentCount - 20) % 2 == 0))
 				{
 					bool bResult = false;
 					string strOutputTableFilePathName = "";
@@ -810,6 +1209,20 @@ int main(int nArgumentCount, char* chpArguments[])
 					string strOutputFileNameSuffix = "";
 					int nNMerLength = 0;
 					int nMaxProcs = 0;
+					string strJournalFilePathName = "";
+					long lMemoryBudget = 0;
+					int nAlphabetType = m_nAlphabetNucleotide;
+					string strCDSTableFilePathName = "";
+					string strBackgroundExportFilePathBaseName = "";
+					int nBackgroundExportFormat = m_nBackgroundExportText;
+					int nBackgroundExportSet = m_nBackgroundExportPresent;
+					string strResultsStoreFilePathName = "";
+					int nShuffleCount = 0;
+					bool bStoreShuffles = false;
+					string strShuffleTableFilePathName = "";
+					string strArchiveFilePathName = "";
+					uint64_t ullShuffleSeed = m_ullShuffleDefaultSeed;
+					bool bOptionsValid = true;
 
 					strOutputTableFilePathName = vArgs[2];
 					strBackgroundFilePathNameList = vArgs[3];
@@ -834,12 +1247,93 @@ int main(int nArgumentCount, char* chpArguments[])
 					stringstream(vArgs[18]) >> nNMerLength;
 					stringstream(vArgs[19]) >> nMaxProcs;
 
-					if ((nNMerLength == 8) || (nNMerLength == 16))
+					//  Optional switch/value pairs
+					for (int nCount = 20; nCount < nArgumentCount; nCount += 2)
 					{
-						if (PerformFDistanceAnalysis(strOutputTableFilePathName, strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, 
+						if ((ConvertStringToLowerCase(vArgs[nCount]) == "-resume_journal") || (ConvertStringToLowerCase(vArgs[nCount]) == "-rj"))
+							strJournalFilePathName = vArgs[nCount + 1];
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-memory_budget") || (ConvertStringToLowerCase(vArgs[nCount]) == "-mb"))
+							stringstream(vArgs[nCount + 1]) >> lMemoryBudget;
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-cds_table") || (ConvertStringToLowerCase(vArgs[nCount]) == "-cdst"))
+							strCDSTableFilePathName = vArgs[nCount + 1];
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-background_export") || (ConvertStringToLowerCase(vArgs[nCount]) == "-be"))
+							strBackgroundExportFilePathBaseName = vArgs[nCount + 1];
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-results_store") || (ConvertStringToLowerCase(vArgs[nCount]) == "-rs"))
+							strResultsStoreFilePathName = vArgs[nCount + 1];
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-shuffle_count") || (ConvertStringToLowerCase(vArgs[nCount]) == "-sc"))
+							stringstream(vArgs[nCount + 1]) >> nShuffleCount;
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-shuffle_table") || (ConvertStringToLowerCase(vArgs[nCount]) == "-st"))
+							strShuffleTableFilePathName = vArgs[nCount + 1];
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-store_shuffles") || (ConvertStringToLowerCase(vArgs[nCount]) == "-ss"))
+							bStoreShuffles = ((ConvertStringToLowerCase(vArgs[nCount + 1]) == "y") || (ConvertStringToLowerCase(vArgs[nCount + 1]) == "yes"));
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-archive") || (ConvertStringToLowerCase(vArgs[nCount]) == "-ar"))
+							strArchiveFilePathName = vArgs[nCount + 1];
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-shuffle_seed") || (ConvertStringToLowerCase(vArgs[nCount]) == "-ssd"))
+							stringstream(vArgs[nCount + 1]) >> ullShuffleSeed;
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-background_export_format") || (ConvertStringToLowerCase(vArgs[nCount]) == "-bef"))
+						{
+							nBackgroundExportFormat = GetBackgroundExportFormat(vArgs[nCount + 1]);
+
+							if (nBackgroundExportFormat < 0)
+							{
+								ReportTimeStamp(vArgs[0], "ERROR:  Unknown Background Export Format [" + vArgs[nCount + 1] + "]:  Use -help [-h] Switch for Assistance");
+
+								bOptionsValid = false;
+							}
+						}
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-background_export_set") || (ConvertStringToLowerCase(vArgs[nCount]) == "-bes"))
+						{
+							nBackgroundExportSet = GetBackgroundExportSet(vArgs[nCount + 1]);
+
+							if (nBackgroundExportSet < 0)
+							{
+								ReportTimeStamp(vArgs[0], "ERROR:  Unknown Background Export Set [" + vArgs[nCount + 1] + "]:  Use -help [-h] Switch for Assistance");
+
+								bOptionsValid = false;
+							}
+						}
+						else if ((ConvertStringToLowerCase(vArgs[nCount]) == "-alphabet") || (ConvertStringToLowerCase(vArgs[nCount]) == "-ab"))
+						{
+							if ((ConvertStringToLowerCase(vArgs[nCount + 1]) == "nucleotide") || (ConvertStringToLowerCase(vArgs[nCount + 1]) == "nt"))
+								nAlphabetType = m_nAlphabetNucleotide;
+							else if ((ConvertStringToLowerCase(vArgs[nCount + 1]) == "amino_acid") || (ConvertStringToLowerCase(vArgs[nCount + 1]) == "aa"))
+								nAlphabetType = m_nAlphabetAminoAcid;
+							else if ((ConvertStringToLowerCase(vArgs[nCount + 1]) == "reduced_amino_acid") || (ConvertStringToLowerCase(vArgs[nCount + 1]) == "raa"))
+								nAlphabetType = m_nAlphabetReducedAminoAcid;
+							else
+							{
+								ReportTimeStamp(vArgs[0], "ERROR:  Unknown F-Distance Alphabet [" + vArgs[nCount + 1] + "]:  Use -help [-h] Switch for Assistance");
+
+								bOptionsValid = false;
+							}
+						}
+						else
+						{
+							ReportTimeStamp(vArgs[0], "ERROR:  Unknown F-Distance Analysis Option [" + vArgs[nCount] + "]:  Use -help [-h] Switch for Assistance");
+
+							bOptionsValid = false;
+						}
+					}
+
+					//  Shuffles are nucleotide only and contabulate into the shuffle table
+					if ((nShuffleCount > 0) && ((nAlphabetType != m_nAlphabetNucleotide) || (strShuffleTableFilePathName.empty())))
+					{
+						ReportTimeStamp(vArgs[0], "ERROR:  -shuffle_count [-sc] Requires the Nucleotide Alphabet and -shuffle_table [-st]:  Use -help [-h] Switch for Assistance");
+
+						bOptionsValid = false;
+					}
+
+					if (!bOptionsValid)
+						return -1;
+
+					if (((nAlphabetType == m_nAlphabetNucleotide) && ((nNMerLength == 8) || (nNMerLength == 16))) ||
+						((nAlphabetType != m_nAlphabetNucleotide) && (nNMerLength > 0) && (nNMerLength <= GetMaxNMerLengthAA(nAlphabetType))))
+					{
+						if (!PerformFDistanceAnalysis(strOutputTableFilePathName, strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, 
 								strBackgroundCatalogFilePathName, lMaxBackgroundCatalogSize, bBackgroundBidirect, bBackgroundAllowUnknowns, strBackgroundErrorFilePathName, 
 								strForegroundFilePathNameList, strForegroundInputFilePathNameTransform, strForegroundCatalogFilePathName, lMaxForegroundCatalogSize,
-								bForegroundBidirect, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, nNMerLength, nMaxProcs))
+								bForegroundBidirect, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, nNMerLength, nMaxProcs, strJournalFilePathName, lMemoryBudget, nAlphabetType, strCDSTableFilePathName,
+								strBackgroundExportFilePathBaseName, nBackgroundExportFormat, nBackgroundExportSet, strResultsStoreFilePathName, nShuffleCount, bStoreShuffles, strShuffleTableFilePathName, strArchiveFilePathName, ullShuffleSeed))
 						{
 							ReportTimeStamp(vArgs[0], "ERROR:  F-Distance Analysis Failed");
 
@@ -848,7 +1342,7 @@ int main(int nArgumentCount, char* chpArguments[])
 					}
 					else
 					{
-						ReportTimeStamp(vArgs[0], "ERROR:  F-Distance nMer Length Must be [8, 16]:  Use -help [-h] Switch for Assistance");
+						ReportTimeStamp(vArgs[0], "ERROR:  F-Distance nMer Length Must be [8, 16] (Nucleotide), [1:6] (Amino Acid), or [1:7] (Reduced Amino Acid):  Use -help [-h] Switch for Assistance");
 
 						return -1;
 					}
@@ -1691,3 +2185,33 @@ int main(int nArgumentCount, char* chpArguments[])
 
 	return 0;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123 entry point; initializes MPI (a single rank, unless launched by mpiexec/mpirun
+//      from a BASE123_MPI build) and processes the command line;
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nArgumentCount:  argument count, space delimited
+//  [char*] chpArguments:  arguments, space cropped
+//                     :  returns the exit or return code
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int nArgumentCount, char* chpArguments[])
+{
+	//  Return code
+	int nReturnCode = -1;
+
+	//  Initialize MPI
+	if (InitializeMPI(&nArgumentCount, &chpArguments))
+	{
+		nReturnCode = ProcessCommandLine(nArgumentCount, chpArguments);
+
+		//  Finalize MPI
+		FinalizeMPI();
+	}
+
+	return nReturnCode;
+}
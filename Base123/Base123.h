@@ -100,4 +100,7 @@ const unsigned int m_untStC = 7;
 //  Guanine nucleotide value, stem, decimal
 const unsigned int m_untStG = 8;
 //  Thymine/uracil nucleotide value, stem, decimal
-const unsigned int m_untStTU = 9;
\ No newline at end of file
+const unsigned int m_untStTU = 9;
+
+//  F-Distance output reading frame delimiter (translated outputs)
+const char m_chFDistanceFrameDelimiter = ',';
\ No newline at end of file
@@ -0,0 +1,1459 @@
+// Base123_Background32.cpp : Function definitions
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Background32:  stores the 16-mer (32-bit) F-Distance background nMer set;
+//      see Base123_Background32.h for the available representations
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Utilities.h"
+#include "Base123_Background32.h"
+#include "Base123_MPI.h"
+
+#include <algorithm>
+#include <iterator>
+
+#ifdef _WIN64
+	#include <intrin.h>
+#endif
+
+//  Bucket prefix bits (2^16 buckets of 2^16 nMers)
+const int m_nBucketPrefixBits = 16;
+//  Bucket count
+const uint64_t m_ullBucketCount = 65536;
+//  Words per bucket (2^16 bits / 64)
+const uint64_t m_ullBucketWords = 1024;
+//  Dense bitset word count (2^32 bits / 64)
+const uint64_t m_ullDenseWords = 67108864;
+//  nMer universe size, 2^32
+const uint64_t m_ullUniverse = 4294967296;
+//  Bytes per MB
+const uint64_t m_ullBytesPerMB = 1048576;
+//  Minimum unsorted marks held by a thread before they are merged into its run
+const uint64_t m_ullRunMinimumMarks = 65536;
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Counts the set bits in a 64-bit word
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullWord:  word to count
+//                    :  returns set bit count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+static int CountBits64(uint64_t ullWord)
+{
+	#ifdef _WIN64
+		return (int)__popcnt64(ullWord);
+	#else
+		return __builtin_popcountll(ullWord);
+	#endif
+}
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_Background32 class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Background32::CBase123_Background32()
+{
+	try
+	{
+		//  Set defaults
+		m_nType = m_nBackgroundTypeNone;
+		m_lMemoryBudget = 0;
+		m_ullaDense = NULL;
+		m_ullaDenseAllocation = NULL;
+		m_ullpaBuckets = NULL;
+		m_lBucketCount = 0;
+		m_ullRunCount.store(0);
+		m_bDenseMarking.store(false);
+		m_bRunsOverBudget.store(false);
+		m_untMergeLast = 0;
+		m_bMergeStarted = false;
+		m_ullCount = 0;
+		m_nLowBitWidth = 0;
+		m_ullHighBucketCount = 0;
+
+		omp_init_lock(&m_lockRuns);
+		omp_init_lock(&m_lockDense);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CBase123_Background32] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_Background32 class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Background32::~CBase123_Background32()
+{
+	try
+	{
+		Destroy();
+
+		omp_destroy_lock(&m_lockRuns);
+		omp_destroy_lock(&m_lockDense);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [~CBase123_Background32] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Initializes the background for marking; nMers are marked into sorted runs, one per
+//      thread, and no bitset is allocated until the runs outgrow half the dense bitset (see
+//      Mark()) or Finalize() selects the representation
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lMemoryBudget:  memory budget, MB (0 = unlimited)
+//  [int] nMaxProcs     :  maximum processors for openMP (marking threads)
+//                     :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::Initialize(long lMemoryBudget, int nMaxProcs)
+{
+	try
+	{
+		//  If memory budget is properly set
+		if (lMemoryBudget >= 0)
+		{
+			//  Release any previous background
+			Destroy();
+
+			m_lMemoryBudget = lMemoryBudget;
+
+			if (nMaxProcs < omp_get_max_threads())
+				nMaxProcs = omp_get_max_threads();
+
+			//  One run per thread, plus the shared run
+			m_vRuns.resize(nMaxProcs + 1);
+
+			m_nType = m_nBackgroundTypeRuns;
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[Initialize]", "ERROR:  Memory Budget Must be Zero (Unlimited) or Greater");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Initialize] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destroys the background
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::Destroy()
+{
+	try
+	{
+		//  Dense bitset
+		if (m_ullaDenseAllocation != NULL)
+		{
+			delete[] m_ullaDenseAllocation;
+			m_ullaDenseAllocation = NULL;
+			m_ullaDense = NULL;
+		}
+
+		//  Prefix buckets
+		if (m_ullpaBuckets != NULL)
+		{
+			for (uint64_t ullCount = 0; ullCount < m_ullBucketCount; ullCount++)
+			{
+				if (m_ullpaBuckets[ullCount] != NULL)
+					delete[] m_ullpaBuckets[ullCount];
+			}
+
+			delete[] m_ullpaBuckets;
+			m_ullpaBuckets = NULL;
+		}
+
+		//  Runs
+		ReleaseRuns();
+		m_vRuns.clear();
+		m_vRuns.shrink_to_fit();
+
+		//  Elias-Fano array
+		m_vLowBits.clear();
+		m_vLowBits.shrink_to_fit();
+		m_vHighBits.clear();
+		m_vHighBits.shrink_to_fit();
+		m_vZeroSamples.clear();
+		m_vZeroSamples.shrink_to_fit();
+
+		m_lBucketCount = 0;
+		m_bDenseMarking.store(false);
+		m_bRunsOverBudget.store(false);
+		m_ullCount = 0;
+		m_nLowBitWidth = 0;
+		m_ullHighBucketCount = 0;
+		m_nType = m_nBackgroundTypeNone;
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Destroy] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Combines the backgrounds marked by each MPI rank (collective); if any rank marks densely,
+//      every rank folds its runs into the dense bitset and the bitsets are combined by a
+//      bitwise-OR allreduce; else, each rank merges its runs into one and every rank gathers
+//      all of them (merged by Finalize()); no-op for a single rank
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::Reduce()
+{
+	//  Dense marking on any rank, if true
+	bool bDenseMarking = false;
+	//  This rank's merged run (all ranks' runs, on return from the gather)
+	vector<uint32_t> vRun;
+	//  Run nMer counts, by rank
+	vector<uint64_t> vRankCounts;
+	//  Merged nMer
+	uint32_t untSequence = 0;
+
+	try
+	{
+		//  If background is set
+		if (IsSet())
+		{
+			//  Single rank, nothing to combine
+			if (GetRankCountMPI() <= 1)
+				return true;
+
+			if (m_nType == m_nBackgroundTypeRuns)
+			{
+				bDenseMarking = m_bDenseMarking.load();
+
+				if (!ReduceLogicalOrMPI(bDenseMarking))
+					return false;
+
+				//  Dense, on every rank
+				if (bDenseMarking)
+					return ((ConvertRunsToDense()) && (ReduceBitwiseOrMPI(m_ullaDense, m_ullDenseWords)));
+
+				//  Merge this rank's runs into one
+				if (!OpenRunMerge())
+					return false;
+
+				vRun.reserve((size_t)m_ullRunCount.load());
+				while (GetNextRunSequence(untSequence))
+					vRun.push_back(untSequence);
+
+				ReleaseRuns();
+
+				//  Gather every rank's run
+				if (!AllGatherSequencesMPI(vRun, vRankCounts))
+					return false;
+
+				m_vGatheredRuns.swap(vRun);
+				m_vGatheredRunEnds.resize(vRankCounts.size());
+				for (size_t stCount = 0; stCount < vRankCounts.size(); stCount++)
+					m_vGatheredRunEnds[stCount] = ((stCount > 0) ? m_vGatheredRunEnds[stCount - 1] : 0) + vRankCounts[stCount];
+
+				m_ullRunCount.store(m_vGatheredRuns.size());
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[Reduce]", "ERROR:  Background is Finalized (Read-Only)");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[Reduce]", "ERROR:  Background Collection is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Reduce] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Finalizes the background after marking; the runs are folded into the dense bitset (if
+//      marking switched to it), else merged into the representation selected by cardinality
+//      and memory budget (see Base123_Background32.h); the background is then read-only
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::Finalize()
+{
+	try
+	{
+		//  If background is set
+		if (IsSet())
+		{
+			if (m_nType == m_nBackgroundTypeRuns)
+			{
+				if (m_bDenseMarking.load())
+				{
+					if (!ConvertRunsToDense())
+					{
+						ReportTimeStamp("[Finalize]", "ERROR:  Dense Bitset Conversion Failed");
+
+						return false;
+					}
+				}
+				else if (!ConvertRunsToFinal())
+				{
+					ReportTimeStamp("[Finalize]", "ERROR:  Background Run Merge Failed");
+
+					return false;
+				}
+
+				if ((m_lMemoryBudget > 0) && (GetMemorySize() > (uint64_t)m_lMemoryBudget * m_ullBytesPerMB))
+					ReportTimeStamp("[Finalize]", "NOTE:  Smallest Background Representation Exceeds Memory Budget [" + ConvertLongToString(m_lMemoryBudget) + " MB]");
+			}
+
+			ReportTimeStamp("[Finalize]", "NOTE:  Background Representation = " + GetTypeName() + ", nMers = " + ConvertUnsignedInt64ToString(GetCardinality()) + ", Size = " + ConvertUnsignedInt64ToString(GetMemorySize() / m_ullBytesPerMB) + " MB");
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[Finalize]", "ERROR:  Background Collection is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Finalize] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background status
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if background is set; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::IsSet()
+{
+	return (m_nType != m_nBackgroundTypeNone);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Marks an nMer present in the background; thread-safe; the mark is held by the calling
+//      thread's run (threads beyond nMaxProcs share one run, under a lock) and the run absorbs
+//      its unsorted marks once they outnumber it; once the runs outgrow half the dense bitset,
+//      and it fits the memory budget, marking switches to the dense bitset
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  nMer to mark
+//                       :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::Mark(uint32_t untSequence)
+{
+	if (m_nType == m_nBackgroundTypeRuns)
+	{
+		//  Thread
+		int nThread = omp_get_thread_num();
+		//  Run is shared, if true
+		bool bShared = (nThread >= (int)m_vRuns.size() - 1);
+		//  Run
+		structBackgroundRun& stRun = bShared ? m_vRuns.back() : m_vRuns[nThread];
+
+		if (bShared)
+			omp_set_lock(&m_lockRuns);
+
+		//  Dense marking (acquire pairs with the switch's release, so the bitset is allocated)
+		if (m_bDenseMarking.load(memory_order_acquire))
+		{
+			//  Fold this thread's run into the dense bitset, once
+			if ((!stRun.vRun.empty()) || (!stRun.vMarks.empty()))
+				MarkRunDense(stRun);
+
+			//  Word
+			uint64_t& ullWord = m_ullaDense[untSequence >> 6];
+
+			#pragma omp atomic
+			ullWord |= (uint64_t)1 << (untSequence & 63);
+		}
+		else
+		{
+			stRun.vMarks.push_back(untSequence);
+
+			//  Merge the marks into the run, once they outnumber it
+			if (stRun.vMarks.size() >= max((size_t)m_ullRunMinimumMarks, stRun.vRun.size()))
+			{
+				MergeMarks(stRun);
+
+				//  Switch to dense marking, if the runs outgrow half the dense bitset and it fits the budget
+				if ((m_ullRunCount.load(memory_order_relaxed) * sizeof(uint32_t) > GetDenseMemorySize() / 2) &&
+					((m_lMemoryBudget == 0) || ((uint64_t)m_lMemoryBudget * m_ullBytesPerMB >= GetDenseMemorySize())))
+				{
+					omp_set_lock(&m_lockDense);
+
+					if (!m_bDenseMarking.load(memory_order_relaxed))
+					{
+						AllocateDense();
+						m_bDenseMarking.store(true, memory_order_release);
+
+						ReportTimeStamp("[Mark]", "NOTE:  Background Runs Exceed Half the Dense Bitset; Marking Switched to Dense Bitset");
+					}
+
+					omp_unset_lock(&m_lockDense);
+				}
+				//  Report the runs exceeding the budget, once
+				else if ((m_lMemoryBudget > 0) && (m_ullRunCount.load(memory_order_relaxed) * sizeof(uint32_t) > (uint64_t)m_lMemoryBudget * m_ullBytesPerMB) &&
+					(!m_bRunsOverBudget.exchange(true)))
+				{
+					ReportTimeStamp("[Mark]", "NOTE:  Background Runs Exceed Memory Budget [" + ConvertLongToString(m_lMemoryBudget) + " MB]");
+				}
+			}
+		}
+
+		if (bShared)
+			omp_unset_lock(&m_lockRuns);
+
+		return true;
+	}
+	else if (IsSet())
+	{
+		ReportTimeStamp("[Mark]", "ERROR:  Background is Finalized (Read-Only)");
+	}
+	else
+	{
+		ReportTimeStamp("[Mark]", "ERROR:  Background Collection is Not Set");
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Queries the background for an nMer; the single query used by mutational search
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  nMer to query
+//                       :  returns true, if nMer is present in the background; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::IsPresent(uint32_t untSequence)
+{
+	if (m_nType == m_nBackgroundTypeDense)
+		return ((m_ullaDense[untSequence >> 6] >> (untSequence & 63)) & 1) != 0;
+	else if (m_nType == m_nBackgroundTypeBucketed)
+	{
+		//  Bucket bitset
+		uint64_t* ullpBucket = m_ullpaBuckets[untSequence >> m_nBucketPrefixBits];
+
+		return (ullpBucket != NULL) && (((ullpBucket[(untSequence & 0xFFFF) >> 6] >> (untSequence & 63)) & 1) != 0);
+	}
+	else if (m_nType == m_nBackgroundTypeEliasFano)
+		return IsPresentEliasFano(untSequence);
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Prefetches the bitset cache line holding an nMer, so that a batch of probes to different
+//      lines overlaps its misses; no-op for the Elias-Fano array
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  nMer to be queried
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_Background32::Prefetch(uint32_t untSequence)
+{
+	//  Word to prefetch
+	const uint64_t* ullpWord = NULL;
+
+	if (m_nType == m_nBackgroundTypeDense)
+		ullpWord = &m_ullaDense[untSequence >> 6];
+	else if (m_nType == m_nBackgroundTypeBucketed)
+	{
+		//  Bucket bitset
+		uint64_t* ullpBucket = m_ullpaBuckets[untSequence >> m_nBucketPrefixBits];
+
+		if (ullpBucket != NULL)
+			ullpWord = &ullpBucket[(untSequence & 0xFFFF) >> 6];
+	}
+
+	if (ullpWord != NULL)
+	{
+		#ifdef _WIN64
+			_mm_prefetch((const char*)ullpWord, _MM_HINT_T0);
+		#else
+			__builtin_prefetch(ullpWord);
+		#endif
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background membership of 64 consecutive nMers (for scans, e.g., export)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untFirstSequence:  first nMer (a multiple of 64)
+//                            :  returns membership word; bit i is nMer untFirstSequence + i
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Background32::GetWord(uint32_t untFirstSequence)
+{
+	//  Membership word
+	uint64_t ullWord = 0;
+
+	if (m_nType == m_nBackgroundTypeDense)
+		ullWord = m_ullaDense[untFirstSequence >> 6];
+	else if (m_nType == m_nBackgroundTypeBucketed)
+	{
+		//  Bucket bitset
+		uint64_t* ullpBucket = m_ullpaBuckets[untFirstSequence >> m_nBucketPrefixBits];
+
+		if (ullpBucket != NULL)
+			ullWord = ullpBucket[(untFirstSequence & 0xFFFF) >> 6];
+	}
+	else if ((m_nType == m_nBackgroundTypeEliasFano) && (m_ullCount > 0))
+	{
+		//  Scan the high buckets spanned by the 64 nMers, once each
+		for (uint64_t ullHigh = (uint64_t)untFirstSequence >> m_nLowBitWidth; ullHigh <= ((uint64_t)untFirstSequence + 63) >> m_nLowBitWidth; ullHigh++)
+		{
+			//  Bucket start position in the high bits
+			uint64_t ullPosition = GetEliasFanoBucketPosition(ullHigh);
+
+			while ((m_vHighBits[ullPosition >> 6] >> (ullPosition & 63)) & 1)
+			{
+				//  Element
+				uint64_t ullElement = (ullHigh << m_nLowBitWidth) | GetEliasFanoLowBits(ullPosition - ullHigh);
+
+				if (ullElement >= (uint64_t)untFirstSequence + 64)
+					break;
+				else if (ullElement >= untFirstSequence)
+					ullWord |= (uint64_t)1 << (ullElement - untFirstSequence);
+
+				ullPosition++;
+			}
+		}
+	}
+
+	return ullWord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background representation type
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the representation type
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int CBase123_Background32::GetType()
+{
+	return m_nType;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background representation type name
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the representation type name
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string CBase123_Background32::GetTypeName()
+{
+	if (m_nType == m_nBackgroundTypeDense)
+		return "Dense Bitset";
+	else if (m_nType == m_nBackgroundTypeBucketed)
+		return "Prefix-Bucketed Bitset";
+	else if (m_nType == m_nBackgroundTypeEliasFano)
+		return "Elias-Fano Array";
+	else if (m_nType == m_nBackgroundTypeRuns)
+		return "Sorted nMer Runs";
+
+	return "Not Set";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background cardinality (distinct nMers present); while marking, the distinct nMers
+//      held by the runs (marks made densely are counted once finalized)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the cardinality
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Background32::GetCardinality()
+{
+	//  Cardinality
+	uint64_t ullCardinality = 0;
+	//  Merged nMer
+	uint32_t untSequence = 0;
+
+	try
+	{
+		if (m_nType == m_nBackgroundTypeDense)
+		{
+			for (uint64_t ullCount = 0; ullCount < m_ullDenseWords; ullCount++)
+				ullCardinality += CountBits64(m_ullaDense[ullCount]);
+		}
+		else if (m_nType == m_nBackgroundTypeBucketed)
+		{
+			for (uint64_t ullCountBuckets = 0; ullCountBuckets < m_ullBucketCount; ullCountBuckets++)
+			{
+				//  Bucket bitset
+				uint64_t* ullpBucket = m_ullpaBuckets[ullCountBuckets];
+
+				if (ullpBucket != NULL)
+				{
+					for (uint64_t ullCount = 0; ullCount < m_ullBucketWords; ullCount++)
+						ullCardinality += CountBits64(ullpBucket[ullCount]);
+				}
+			}
+		}
+		else if (m_nType == m_nBackgroundTypeEliasFano)
+			ullCardinality = m_ullCount;
+		else if ((m_nType == m_nBackgroundTypeRuns) && (OpenRunMerge()))
+		{
+			while (GetNextRunSequence(untSequence))
+				ullCardinality++;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetCardinality] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return ullCardinality;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background memory size
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the memory size, bytes
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Background32::GetMemorySize()
+{
+	if (m_nType == m_nBackgroundTypeDense)
+		return GetDenseMemorySize();
+	else if (m_nType == m_nBackgroundTypeBucketed)
+		return GetBucketedMemorySize();
+	else if (m_nType == m_nBackgroundTypeEliasFano)
+		return (m_vLowBits.size() + m_vHighBits.size() + m_vZeroSamples.size()) * sizeof(uint64_t);
+	else if (m_nType == m_nBackgroundTypeRuns)
+		return (m_ullRunCount.load() * sizeof(uint32_t)) + ((m_ullaDense != NULL) ? GetDenseMemorySize() : 0);
+
+	return 0;
+}
+
+//  Implementation (private)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the dense bitset memory size
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the memory size, bytes
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Background32::GetDenseMemorySize()
+{
+	return m_ullDenseWords * sizeof(uint64_t);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the prefix-bucketed bitset memory size
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the memory size, bytes
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Background32::GetBucketedMemorySize()
+{
+	return GetBucketedMemorySize((uint64_t)m_lBucketCount);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the prefix-bucketed bitset memory size for a given touched bucket count
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullBucketCount:  touched bucket count
+//                          :  returns the memory size, bytes
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Background32::GetBucketedMemorySize(uint64_t ullBucketCount)
+{
+	return (m_ullBucketCount * sizeof(uint64_t*)) + (ullBucketCount * m_ullBucketWords * sizeof(uint64_t));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the Elias-Fano array memory size for a given cardinality
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullCardinality:  nMer count
+//                          :  returns the memory size, bytes
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Background32::GetEliasFanoMemorySize(uint64_t ullCardinality)
+{
+	//  Low bit width
+	int nLowBitWidth = 0;
+
+	//  Low bits = floor(log2(universe / cardinality))
+	if (ullCardinality > 0)
+	{
+		while ((nLowBitWidth < 32) && (((uint64_t)2 << nLowBitWidth) <= (m_ullUniverse / ullCardinality)))
+			nLowBitWidth++;
+	}
+
+	//  Low bits + high bits + zero samples
+	return ((((ullCardinality * nLowBitWidth) + 63) / 64) + 1 + (((ullCardinality + (m_ullUniverse >> nLowBitWidth)) + 63) / 64) + 1 + ((m_ullUniverse >> nLowBitWidth) / 64) + 1) * sizeof(uint64_t);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Allocates the dense bitset, zeroed and cache-line aligned
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::AllocateDense()
+{
+	try
+	{
+		if (m_ullaDenseAllocation == NULL)
+		{
+			//  Over-allocate one cache line, so the bitset can start on a line boundary
+			m_ullaDenseAllocation = new uint64_t[m_ullDenseWords + m_nBackgroundLineBytes / sizeof(uint64_t)];
+			m_ullaDense = (uint64_t*)(((uintptr_t)m_ullaDenseAllocation + m_nBackgroundLineBytes - 1) & ~(uintptr_t)(m_nBackgroundLineBytes - 1));
+
+			//  Initialize background to 0
+			for (uint64_t ullCount = 0; ullCount < m_ullDenseWords; ullCount++)
+				m_ullaDense[ullCount] = 0;
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AllocateDense] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Merges a run's unsorted marks into the run (sorted, distinct)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structBackgroundRun&] stRun:  run to merge
+//                             :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::MergeMarks(structBackgroundRun& stRun)
+{
+	//  Merged run
+	vector<uint32_t> vMerged;
+
+	try
+	{
+		if (!stRun.vMarks.empty())
+		{
+			sort(stRun.vMarks.begin(), stRun.vMarks.end());
+			stRun.vMarks.erase(unique(stRun.vMarks.begin(), stRun.vMarks.end()), stRun.vMarks.end());
+
+			vMerged.reserve(stRun.vRun.size() + stRun.vMarks.size());
+			set_union(stRun.vRun.begin(), stRun.vRun.end(), stRun.vMarks.begin(), stRun.vMarks.end(), back_inserter(vMerged));
+
+			m_ullRunCount.fetch_add(vMerged.size() - stRun.vRun.size());
+
+			stRun.vRun.swap(vMerged);
+			stRun.vMarks.clear();
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [MergeMarks] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Marks a run (and its unsorted marks) in the dense bitset, then releases it; thread-safe
+//      for distinct runs
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structBackgroundRun&] stRun:  run to mark
+//                             :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::MarkRunDense(structBackgroundRun& stRun)
+{
+	try
+	{
+		for (size_t stCount = 0; stCount < stRun.vRun.size(); stCount++)
+		{
+			//  Word
+			uint64_t& ullWord = m_ullaDense[stRun.vRun[stCount] >> 6];
+
+			#pragma omp atomic
+			ullWord |= (uint64_t)1 << (stRun.vRun[stCount] & 63);
+		}
+
+		for (size_t stCount = 0; stCount < stRun.vMarks.size(); stCount++)
+		{
+			//  Word
+			uint64_t& ullWord = m_ullaDense[stRun.vMarks[stCount] >> 6];
+
+			#pragma omp atomic
+			ullWord |= (uint64_t)1 << (stRun.vMarks[stCount] & 63);
+		}
+
+		m_ullRunCount.fetch_sub(stRun.vRun.size());
+
+		vector<uint32_t>().swap(stRun.vRun);
+		vector<uint32_t>().swap(stRun.vMarks);
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [MarkRunDense] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Converts the runs to the dense bitset (after marking), releasing them
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::ConvertRunsToDense()
+{
+	try
+	{
+		//  If background is marking
+		if (m_nType == m_nBackgroundTypeRuns)
+		{
+			if (!AllocateDense())
+				return false;
+
+			for (size_t stCount = 0; stCount < m_vRuns.size(); stCount++)
+				MarkRunDense(m_vRuns[stCount]);
+
+			for (size_t stCount = 0; stCount < m_vGatheredRuns.size(); stCount++)
+				m_ullaDense[m_vGatheredRuns[stCount] >> 6] |= (uint64_t)1 << (m_vGatheredRuns[stCount] & 63);
+
+			ReleaseRuns();
+
+			m_nType = m_nBackgroundTypeDense;
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[ConvertRunsToDense]", "ERROR:  Background Collection is Not Marking");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ConvertRunsToDense] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Opens a merge of all runs (and gathered runs), in ascending order; each thread's unsorted
+//      marks are merged into its run first; not thread-safe (after marking)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::OpenRunMerge()
+{
+	try
+	{
+		m_vMergeRanges.clear();
+		m_pqMergeHeads = priority_queue<pair<uint32_t, size_t>, vector<pair<uint32_t, size_t>>, greater<pair<uint32_t, size_t>>>();
+		m_bMergeStarted = false;
+
+		//  Thread runs
+		for (size_t stCount = 0; stCount < m_vRuns.size(); stCount++)
+		{
+			if (!MergeMarks(m_vRuns[stCount]))
+				return false;
+
+			if (!m_vRuns[stCount].vRun.empty())
+				m_vMergeRanges.push_back(make_pair(m_vRuns[stCount].vRun.data(), m_vRuns[stCount].vRun.data() + m_vRuns[stCount].vRun.size()));
+		}
+
+		//  Gathered runs
+		for (size_t stCount = 0; stCount < m_vGatheredRunEnds.size(); stCount++)
+		{
+			//  Run start
+			uint64_t ullStart = (stCount > 0) ? m_vGatheredRunEnds[stCount - 1] : 0;
+
+			if (m_vGatheredRunEnds[stCount] > ullStart)
+				m_vMergeRanges.push_back(make_pair(m_vGatheredRuns.data() + ullStart, m_vGatheredRuns.data() + m_vGatheredRunEnds[stCount]));
+		}
+
+		for (size_t stCount = 0; stCount < m_vMergeRanges.size(); stCount++)
+			m_pqMergeHeads.push(make_pair(*m_vMergeRanges[stCount].first, stCount));
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [OpenRunMerge] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the next distinct nMer of the open run merge
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t&] untSequence:  next nMer
+//                        :  returns true, if an nMer is returned; else (merge complete), false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::GetNextRunSequence(uint32_t& untSequence)
+{
+	while (!m_pqMergeHeads.empty())
+	{
+		//  Smallest head
+		pair<uint32_t, size_t> prHead = m_pqMergeHeads.top();
+		//  Its range
+		pair<const uint32_t*, const uint32_t*>& prRange = m_vMergeRanges[prHead.second];
+
+		m_pqMergeHeads.pop();
+
+		prRange.first++;
+		if (prRange.first != prRange.second)
+			m_pqMergeHeads.push(make_pair(*prRange.first, prHead.second));
+
+		//  Distinct across runs
+		if ((!m_bMergeStarted) || (prHead.first != m_untMergeLast))
+		{
+			m_untMergeLast = prHead.first;
+			m_bMergeStarted = true;
+			untSequence = prHead.first;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Converts the runs to the final representation, releasing them; the runs are merged once to
+//      count the nMers and touched buckets, the representation is selected (the first of dense,
+//      bucketed and Elias-Fano that fits the memory budget and is within m_nBackgroundSizeRatio
+//      of the smallest; else, the smallest), and the runs are merged again straight into it
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::ConvertRunsToFinal()
+{
+	//  Cardinality
+	uint64_t ullCardinality = 0;
+	//  Touched bucket count
+	uint64_t ullBuckets = 0;
+	//  Merged nMer
+	uint32_t untSequence = 0;
+	//  Last touched bucket
+	uint32_t untLastBucket = 0;
+	//  Representation sizes, bytes
+	uint64_t ullDenseSize = 0;
+	uint64_t ullBucketedSize = 0;
+	uint64_t ullEliasFanoSize = 0;
+	uint64_t ullSmallestSize = 0;
+	//  Memory budget, bytes
+	uint64_t ullBudget = UINT64_MAX;
+	//  Selected representation
+	int nType = m_nBackgroundTypeNone;
+	//  Element index
+	uint64_t ullIndex = 0;
+	//  Current high bucket
+	uint64_t ullHigh = 0;
+	//  Zero (bucket terminator) count
+	uint64_t ullZeroCount = 0;
+	//  High bit position
+	uint64_t ullPosition = 0;
+
+	try
+	{
+		//  If background is marking
+		if (m_nType == m_nBackgroundTypeRuns)
+		{
+			//  Count the nMers and touched buckets
+			if (!OpenRunMerge())
+				return false;
+
+			while (GetNextRunSequence(untSequence))
+			{
+				if ((ullCardinality == 0) || ((untSequence >> m_nBucketPrefixBits) != untLastBucket))
+				{
+					untLastBucket = untSequence >> m_nBucketPrefixBits;
+					ullBuckets++;
+				}
+
+				ullCardinality++;
+			}
+
+			//  Select the representation
+			ullDenseSize = GetDenseMemorySize();
+			ullBucketedSize = GetBucketedMemorySize(ullBuckets);
+			ullEliasFanoSize = GetEliasFanoMemorySize(ullCardinality);
+			ullSmallestSize = min(ullDenseSize, min(ullBucketedSize, ullEliasFanoSize));
+
+			if (m_lMemoryBudget > 0)
+				ullBudget = (uint64_t)m_lMemoryBudget * m_ullBytesPerMB;
+
+			if ((ullDenseSize <= ullBudget) && (ullDenseSize <= ullSmallestSize * m_nBackgroundSizeRatio))
+				nType = m_nBackgroundTypeDense;
+			else if ((ullBucketedSize <= ullBudget) && (ullBucketedSize <= ullSmallestSize * m_nBackgroundSizeRatio))
+				nType = m_nBackgroundTypeBucketed;
+			else if ((ullEliasFanoSize <= ullBudget) && (ullEliasFanoSize <= ullSmallestSize * m_nBackgroundSizeRatio))
+				nType = m_nBackgroundTypeEliasFano;
+			else if (ullSmallestSize == ullDenseSize)
+				nType = m_nBackgroundTypeDense;
+			else if (ullSmallestSize == ullBucketedSize)
+				nType = m_nBackgroundTypeBucketed;
+			else
+				nType = m_nBackgroundTypeEliasFano;
+
+			//  Merge the runs into the representation
+			if (!OpenRunMerge())
+				return false;
+
+			if (nType == m_nBackgroundTypeDense)
+			{
+				if (!AllocateDense())
+					return false;
+
+				while (GetNextRunSequence(untSequence))
+					m_ullaDense[untSequence >> 6] |= (uint64_t)1 << (untSequence & 63);
+			}
+			else if (nType == m_nBackgroundTypeBucketed)
+			{
+				m_ullpaBuckets = new uint64_t*[m_ullBucketCount]();
+				m_lBucketCount = 0;
+
+				while (GetNextRunSequence(untSequence))
+				{
+					//  Bucket bitset
+					uint64_t*& ullpBucket = m_ullpaBuckets[untSequence >> m_nBucketPrefixBits];
+
+					if (ullpBucket == NULL)
+					{
+						ullpBucket = new uint64_t[m_ullBucketWords]();
+						m_lBucketCount++;
+					}
+
+					ullpBucket[(untSequence & 0xFFFF) >> 6] |= (uint64_t)1 << (untSequence & 63);
+				}
+			}
+			else
+			{
+				m_ullCount = ullCardinality;
+
+				//  Low bits = floor(log2(universe / cardinality))
+				m_nLowBitWidth = 0;
+				if (m_ullCount > 0)
+				{
+					while ((m_nLowBitWidth < 32) && (((uint64_t)2 << m_nLowBitWidth) <= (m_ullUniverse / m_ullCount)))
+						m_nLowBitWidth++;
+				}
+				m_ullHighBucketCount = m_ullUniverse >> m_nLowBitWidth;
+
+				//  Allocate (one pad word each)
+				m_vLowBits.assign((((m_ullCount * m_nLowBitWidth) + 63) / 64) + 1, 0);
+				m_vHighBits.assign((((m_ullCount + m_ullHighBucketCount) + 63) / 64) + 1, 0);
+				m_vZeroSamples.clear();
+				m_vZeroSamples.reserve((size_t)(m_ullHighBucketCount / 64) + 1);
+
+				//  Values are merged sorted
+				while (GetNextRunSequence(untSequence))
+				{
+					//  Close high buckets below this value with zeros
+					while (ullHigh < ((uint64_t)untSequence >> m_nLowBitWidth))
+					{
+						if (ullZeroCount % 64 == 0)
+							m_vZeroSamples.push_back(ullPosition);
+						ullZeroCount++;
+						ullPosition++;
+						ullHigh++;
+					}
+
+					//  One per element
+					m_vHighBits[ullPosition >> 6] |= (uint64_t)1 << (ullPosition & 63);
+					ullPosition++;
+
+					//  Low bits
+					SetEliasFanoLowBits(ullIndex, (uint64_t)untSequence & (((uint64_t)1 << m_nLowBitWidth) - 1));
+					ullIndex++;
+				}
+
+				//  Close remaining high buckets
+				while (ullHigh < m_ullHighBucketCount)
+				{
+					if (ullZeroCount % 64 == 0)
+						m_vZeroSamples.push_back(ullPosition);
+					ullZeroCount++;
+					ullPosition++;
+					ullHigh++;
+				}
+			}
+
+			ReleaseRuns();
+
+			m_nType = nType;
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[ConvertRunsToFinal]", "ERROR:  Background Collection is Not Marking");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ConvertRunsToFinal] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Releases the runs (and gathered runs); the run slots are kept
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::ReleaseRuns()
+{
+	try
+	{
+		for (size_t stCount = 0; stCount < m_vRuns.size(); stCount++)
+		{
+			vector<uint32_t>().swap(m_vRuns[stCount].vRun);
+			vector<uint32_t>().swap(m_vRuns[stCount].vMarks);
+		}
+
+		vector<uint32_t>().swap(m_vGatheredRuns);
+		vector<uint64_t>().swap(m_vGatheredRunEnds);
+
+		m_vMergeRanges.clear();
+		m_pqMergeHeads = priority_queue<pair<uint32_t, size_t>, vector<pair<uint32_t, size_t>>, greater<pair<uint32_t, size_t>>>();
+		m_bMergeStarted = false;
+
+		m_ullRunCount.store(0);
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReleaseRuns] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the packed Elias-Fano low bits of an element
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullIndex:  element index
+//                    :  returns the low bits
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Background32::GetEliasFanoLowBits(uint64_t ullIndex)
+{
+	//  Bit offset
+	uint64_t ullOffset = ullIndex * m_nLowBitWidth;
+	//  Word, shift
+	uint64_t ullWord = ullOffset >> 6;
+	int nShift = (int)(ullOffset & 63);
+	//  Low bits
+	uint64_t ullLowBits = m_vLowBits[ullWord] >> nShift;
+
+	if (m_nLowBitWidth == 0)
+		return 0;
+
+	//  Straddles a word boundary
+	if (nShift + m_nLowBitWidth > 64)
+		ullLowBits |= m_vLowBits[ullWord + 1] << (64 - nShift);
+
+	return ullLowBits & (((uint64_t)1 << m_nLowBitWidth) - 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets the packed Elias-Fano low bits of an element
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullIndex  :  element index
+//  [uint64_t] ullLowBits:  low bits to set
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_Background32::SetEliasFanoLowBits(uint64_t ullIndex, uint64_t ullLowBits)
+{
+	//  Bit offset
+	uint64_t ullOffset = ullIndex * m_nLowBitWidth;
+	//  Word, shift
+	uint64_t ullWord = ullOffset >> 6;
+	int nShift = (int)(ullOffset & 63);
+
+	if (m_nLowBitWidth == 0)
+		return;
+
+	m_vLowBits[ullWord] |= ullLowBits << nShift;
+
+	//  Straddles a word boundary
+	if (nShift + m_nLowBitWidth > 64)
+		m_vLowBits[ullWord + 1] |= ullLowBits >> (64 - nShift);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the start position of an Elias-Fano high bucket; bucket h starts one past the (h - 1)th
+//      zero, located through the sampled zero positions
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullHigh:  high bucket
+//                   :  returns bucket start position in the high bits
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Background32::GetEliasFanoBucketPosition(uint64_t ullHigh)
+{
+	//  Bucket start position in the high bits
+	uint64_t ullPosition = 0;
+
+	//  Bucket h starts one past zero (h - 1)
+	if (ullHigh > 0)
+	{
+		//  Zero to find
+		uint64_t ullZero = ullHigh - 1;
+		//  Zeros remaining after the sample
+		uint64_t ullRemaining = ullZero & 63;
+
+		ullPosition = m_vZeroSamples[(size_t)(ullZero >> 6)];
+
+		//  Skip whole words, then bits
+		if (ullRemaining > 0)
+		{
+			ullPosition++;
+
+			while (true)
+			{
+				//  Zeros from this position to the end of the word
+				uint64_t ullZeros = ~m_vHighBits[ullPosition >> 6] >> (ullPosition & 63);
+				int nZeroCount = CountBits64(ullZeros);
+
+				if ((uint64_t)nZeroCount >= ullRemaining)
+				{
+					//  Select within the word
+					while (true)
+					{
+						if (ullZeros & 1)
+						{
+							ullRemaining--;
+							if (ullRemaining == 0)
+								break;
+						}
+						ullZeros >>= 1;
+						ullPosition++;
+					}
+					break;
+				}
+
+				ullRemaining -= nZeroCount;
+				ullPosition = (ullPosition | 63) + 1;
+			}
+		}
+
+		ullPosition++;
+	}
+
+	return ullPosition;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Queries the Elias-Fano array for an nMer; locates the high bucket through the
+//      sampled zero positions, then scans the (short) bucket for the low bits
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  nMer to query
+//                       :  returns true, if nMer is present in the background; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Background32::IsPresentEliasFano(uint32_t untSequence)
+{
+	//  High bucket, low bits
+	uint64_t ullHigh = (uint64_t)untSequence >> m_nLowBitWidth;
+	uint64_t ullLow = (uint64_t)untSequence & (((uint64_t)1 << m_nLowBitWidth) - 1);
+	//  Bucket start position in the high bits
+	uint64_t ullPosition = 0;
+
+	//  Empty background
+	if (m_ullCount == 0)
+		return false;
+
+	ullPosition = GetEliasFanoBucketPosition(ullHigh);
+
+	//  Scan the bucket's elements (ones) until its terminating zero
+	while ((m_vHighBits[ullPosition >> 6] >> (ullPosition & 63)) & 1)
+	{
+		//  Element low bits (element index = position - bucket)
+		uint64_t ullElementLow = GetEliasFanoLowBits(ullPosition - ullHigh);
+
+		if (ullElementLow == ullLow)
+			return true;
+		//  Sorted, stop early
+		else if (ullElementLow > ullLow)
+			return false;
+
+		ullPosition++;
+	}
+
+	return false;
+}
@@ -0,0 +1,194 @@
+// Base123_Background32.h : Stores the Base123 16-mer F-Distance background
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Background32 class (header) stores the 16-mer (32-bit) F-Distance background
+//      nMer set behind a single mark/query interface; nMers are marked into sorted runs, one
+//      per thread (each run absorbs its thread's unsorted marks once they outnumber it), and
+//      Finalize() merges the runs straight into the representation selected by background
+//      cardinality and memory budget:
+//
+//      dense bitset     :  one bit per nMer (512 MB), fastest query
+//      bucketed bitset  :  two-level, 16-bit prefix buckets allocated only when touched
+//      Elias-Fano array :  sorted, compressed nMer array; smallest for sparse backgrounds
+//
+//      the first of these that fits the budget and is within m_nBackgroundSizeRatio of the
+//      smallest is selected; if the runs outgrow half the dense bitset while it fits the budget,
+//      marking switches to the dense bitset (each thread folds its run in on its next mark)
+//
+//      Reduce() combines per-rank backgrounds (MPI) before Finalize()
+//
+//      the dense bitset is cache-line aligned; an nMer's bit index is its 2-bit packing (last base lowest), so
+//      the 256 variants of its last four bases share one 64-byte line; mutational search probes those
+//      positions first and prefetches the lines of the remaining substitutions
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Base123.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <string>
+#include <vector>
+#include <omp.h>
+
+using namespace std;
+
+//  Background representation, not set
+const int m_nBackgroundTypeNone = 0;
+//  Background representation, dense bitset
+const int m_nBackgroundTypeDense = 1;
+//  Background representation, two-level prefix-bucketed bitset
+const int m_nBackgroundTypeBucketed = 2;
+//  Background representation, Elias-Fano compressed sorted array
+const int m_nBackgroundTypeEliasFano = 3;
+//  Background representation, sorted nMer runs (marking only; see Finalize())
+const int m_nBackgroundTypeRuns = 4;
+
+//  Representation size ratio; a faster representation is selected over the smallest one only
+//      while it is at most this many times larger
+const int m_nBackgroundSizeRatio = 8;
+
+//  Bitset cache line, bytes
+const int m_nBackgroundLineBytes = 64;
+//  Base positions (from the last base) whose variants share one bitset cache line
+const int m_nBackgroundLinePositions = 4;
+
+//  Background run, one per marking thread (padded, so threads do not share a cache line)
+struct structBackgroundRun
+{
+	//  Sorted, distinct nMers
+	vector<uint32_t> vRun;
+	//  Unsorted marks, not yet merged into the run
+	vector<uint32_t> vMarks;
+	//  Padding
+	char chaPadding[m_nBackgroundLineBytes];
+};
+
+class CBase123_Background32
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_Background32();
+	//  Destructor
+	virtual ~CBase123_Background32();
+
+	//  Interface (public)
+
+public:
+
+	bool Initialize(long lMemoryBudget, int nMaxProcs);
+	bool Destroy();
+	bool Reduce();
+	bool Finalize();
+	bool IsSet();
+	bool Mark(uint32_t untSequence);
+	bool IsPresent(uint32_t untSequence);
+	void Prefetch(uint32_t untSequence);
+	uint64_t GetWord(uint32_t untFirstSequence);
+	int GetType();
+	string GetTypeName();
+	uint64_t GetCardinality();
+	uint64_t GetMemorySize();
+
+	//  Implementation (private)
+
+private:
+
+	uint64_t GetDenseMemorySize();
+	uint64_t GetBucketedMemorySize();
+	uint64_t GetBucketedMemorySize(uint64_t ullBucketCount);
+	uint64_t GetEliasFanoMemorySize(uint64_t ullCardinality);
+	bool AllocateDense();
+	bool MergeMarks(structBackgroundRun& stRun);
+	bool MarkRunDense(structBackgroundRun& stRun);
+	bool ConvertRunsToDense();
+	bool OpenRunMerge();
+	bool GetNextRunSequence(uint32_t& untSequence);
+	bool ConvertRunsToFinal();
+	bool ReleaseRuns();
+	uint64_t GetEliasFanoLowBits(uint64_t ullIndex);
+	void SetEliasFanoLowBits(uint64_t ullIndex, uint64_t ullLowBits);
+	uint64_t GetEliasFanoBucketPosition(uint64_t ullHigh);
+	bool IsPresentEliasFano(uint32_t untSequence);
+
+	//  Representation type
+	int m_nType;
+
+	//  Memory budget, MB (0 = unlimited)
+	long m_lMemoryBudget;
+
+	//  Dense bitset, 2^32 bits (cache-line aligned within m_ullaDenseAllocation)
+	uint64_t* m_ullaDense;
+
+	//  Dense bitset allocation
+	uint64_t* m_ullaDenseAllocation;
+
+	//  Prefix buckets, 2^16 pointers to 2^16-bit bitsets (NULL, if untouched)
+	uint64_t** m_ullpaBuckets;
+
+	//  Touched bucket count
+	long m_lBucketCount;
+
+	//  Runs, by thread (the last is shared, under m_lockRuns, by threads beyond nMaxProcs)
+	vector<structBackgroundRun> m_vRuns;
+
+	//  Run (sorted) nMer count, all threads
+	atomic<uint64_t> m_ullRunCount;
+
+	//  Dense marking (the runs outgrew half the dense bitset), if true; set with release after
+	//      the dense bitset is allocated
+	atomic<bool> m_bDenseMarking;
+
+	//  Memory budget exceeded while marking (reported once), if true
+	atomic<bool> m_bRunsOverBudget;
+
+	//  Shared run lock
+	omp_lock_t m_lockRuns;
+
+	//  Dense switch lock
+	omp_lock_t m_lockDense;
+
+	//  Runs gathered from all MPI ranks (sorted, distinct within each rank) and their ends
+	vector<uint32_t> m_vGatheredRuns;
+	vector<uint64_t> m_vGatheredRunEnds;
+
+	//  Run merge, run ranges
+	vector<pair<const uint32_t*, const uint32_t*>> m_vMergeRanges;
+
+	//  Run merge, (nMer, range) heads, smallest first
+	priority_queue<pair<uint32_t, size_t>, vector<pair<uint32_t, size_t>>, greater<pair<uint32_t, size_t>>> m_pqMergeHeads;
+
+	//  Run merge, nMer last returned (valid once m_bMergeStarted)
+	uint32_t m_untMergeLast;
+	bool m_bMergeStarted;
+
+	//  Elias-Fano cardinality
+	uint64_t m_ullCount;
+
+	//  Elias-Fano low bit width
+	int m_nLowBitWidth;
+
+	//  Elias-Fano high bucket count
+	uint64_t m_ullHighBucketCount;
+
+	//  Elias-Fano packed low bits
+	vector<uint64_t> m_vLowBits;
+
+	//  Elias-Fano unary-coded high bits
+	vector<uint64_t> m_vHighBits;
+
+	//  Elias-Fano position of every 64th zero (bucket terminator) in the high bits
+	vector<uint64_t> m_vZeroSamples;
+};
@@ -0,0 +1,390 @@
+// Base123_Background_Export.cpp : Exports the Base123 F-Distance background nMer set
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Exports the Base123 F-Distance background nMer set; chunks are scanned by membership word and
+//      streamed to one file per chunk, so memory is bounded by one buffer per thread regardless of
+//      the nMer universe (4^16 for the 16-mer background); see Base123_Background_Export.h for formats
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Utilities.h"
+#include "Base123_Background_Export.h"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <omp.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN64
+	#include <intrin.h>
+#endif
+
+//  nMer ranks per export chunk file (2^24; the 16-mer universe is 256 chunks)
+const uint64_t m_ullExportChunkRanks = 16777216;
+//  Export buffer size, bytes, at which a chunk buffer is flushed to file
+const size_t m_ulExportBufferBytes = 4194304;
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the index of the lowest set bit of a non-zero 64-bit word
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullWord:  word to scan (non-zero)
+//                    :  returns lowest set bit index
+//
+////////////////////////////////////////////////////////////////////////////////
+
+static int GetLowestBit64(uint64_t ullWord)
+{
+	#ifdef _WIN64
+		unsigned long ulIndex = 0;
+		_BitScanForward64(&ulIndex, ullWord);
+		return (int)ulIndex;
+	#else
+		return __builtin_ctzll(ullWord);
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background export format from its name
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFormatName:  format name (text [txt], 2bit, delta)
+//                       :  returns the export format, if known; else, -1
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int GetBackgroundExportFormat(string strFormatName)
+{
+	try
+	{
+		strFormatName = ConvertStringToLowerCase(strFormatName);
+
+		if ((strFormatName == "text") || (strFormatName == "txt"))
+			return m_nBackgroundExportText;
+		else if ((strFormatName == "2bit") || (strFormatName == "two_bit"))
+			return m_nBackgroundExportTwoBit;
+		else if (strFormatName == "delta")
+			return m_nBackgroundExportDelta;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetBackgroundExportFormat] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background export set from its name
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strSetName:  set name (present, absent, both)
+//                    :  returns the export set, if known; else, -1
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int GetBackgroundExportSet(string strSetName)
+{
+	try
+	{
+		strSetName = ConvertStringToLowerCase(strSetName);
+
+		if (strSetName == "present")
+			return m_nBackgroundExportPresent;
+		else if (strSetName == "absent")
+			return m_nBackgroundExportAbsent;
+		else if (strSetName == "both")
+			return m_nBackgroundExportBoth;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetBackgroundExportSet] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the background export file extension of a format
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nFormat:  export format
+//              :  returns the file extension (with '.'), if known; else, empty string
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetBackgroundExportExtension(int nFormat)
+{
+	if (nFormat == m_nBackgroundExportText)
+		return ".txt";
+	else if (nFormat == m_nBackgroundExportTwoBit)
+		return ".2bit";
+	else if (nFormat == m_nBackgroundExportDelta)
+		return ".delta";
+
+	return "";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Appends one nMer rank to an export buffer in the given format
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullRank          :  nMer rank (2-bit packed nMer, first base highest)
+//  [int] nNMerLength           :  nMer length
+//  [int] nFormat               :  export format
+//  [uint64_t&] ullPreviousRank :  previous rank of the chunk (delta format); set to ullRank
+//  [string&] strBuffer         :  export buffer to append
+//                             :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool AppendBackgroundExportEntry(uint64_t ullRank, int nNMerLength, int nFormat, uint64_t& ullPreviousRank, string& strBuffer)
+{
+	//  Bases, by 2-bit code
+	static const char chaBases[4] = { 'a', 'c', 'g', 'u' };
+
+	if (nFormat == m_nBackgroundExportText)
+	{
+		//  Decode bases, first base highest
+		for (int nCount = nNMerLength - 1; nCount >= 0; nCount--)
+			strBuffer += chaBases[(ullRank >> (2 * nCount)) & 0b11];
+
+		strBuffer += '\n';
+	}
+	else if (nFormat == m_nBackgroundExportTwoBit)
+	{
+		//  Little-endian, nMer / 4 bytes
+		for (int nCount = 0; nCount < (nNMerLength + 3) / 4; nCount++)
+			strBuffer += (char)((ullRank >> (8 * nCount)) & 0xFF);
+	}
+	else if (nFormat == m_nBackgroundExportDelta)
+	{
+		//  Gap from previous rank
+		uint64_t ullGap = ullRank - ullPreviousRank;
+
+		//  LEB128, 7 bits per byte, high bit set on all but the last byte
+		while (ullGap >= 0x80)
+		{
+			strBuffer += (char)((ullGap & 0x7F) | 0x80);
+			ullGap >>= 7;
+		}
+
+		strBuffer += (char)ullGap;
+	}
+	else
+		return false;
+
+	ullPreviousRank = ullRank;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Exports the present (or absent) nMers of a background to chunk files, in parallel; writes
+//      <base>_<present|absent>_<chunk>.<ext> files and a <base>_<present|absent>_manifest.txt
+//      table (chunk, rank range, nMer count, file path name)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strOutputFilePathBaseName:  output file path base name
+//  [int] nNMerLength                 :  nMer length (universe is 4^nMer ranks)
+//  [int] nFormat                     :  export format
+//  [bool] bPresent                   :  export present nMers, if true; else, absent nMers
+//  [BackgroundWordFunction] fnGetWord:  background membership, 64 ranks at a time
+//  [int] nMaxProcs                   :  maximum processors for openMP
+//                                   :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ExportBackground(string strOutputFilePathBaseName, int nNMerLength, int nFormat, bool bPresent, BackgroundWordFunction fnGetWord, int nMaxProcs)
+{
+	//  Set name
+	string strSetName = bPresent ? "present" : "absent";
+	//  nMer universe size
+	uint64_t ullUniverse = 0;
+	//  Ranks per chunk
+	uint64_t ullChunkRanks = 0;
+	//  Chunk count
+	long lChunkCount = 0;
+	//  nMer count, by chunk
+	vector<uint64_t> vChunkCounts;
+	//  Chunk file path names
+	vector<string> vChunkFilePathNames;
+	//  Chunk write failed, if true
+	bool bWriteFailed = false;
+	//  Manifest file text
+	string strManifestFileText = "";
+
+	try
+	{
+		//  If output file path base name is not empty
+		if (!strOutputFilePathBaseName.empty())
+		{
+			//  If nMer length is properly set (universe is scanned 64 ranks at a time)
+			if ((nNMerLength >= 3) && (nNMerLength <= 16))
+			{
+				//  If format is known
+				if (!GetBackgroundExportExtension(nFormat).empty())
+				{
+					//  If membership function is set
+					if (fnGetWord != NULL)
+					{
+						ullUniverse = (uint64_t)1 << (2 * nNMerLength);
+						ullChunkRanks = (ullUniverse < m_ullExportChunkRanks) ? ullUniverse : m_ullExportChunkRanks;
+						lChunkCount = (long)(ullUniverse / ullChunkRanks);
+
+						vChunkCounts.resize(lChunkCount, 0);
+						vChunkFilePathNames.resize(lChunkCount);
+
+						//  Chunk file path names
+						for (long lCount = 0; lCount < lChunkCount; lCount++)
+						{
+							//  Chunk file path name
+							stringstream ssFilePathName;
+
+							ssFilePathName << strOutputFilePathBaseName << "_" << strSetName << "_" << setw(4) << setfill('0') << lCount << GetBackgroundExportExtension(nFormat);
+							vChunkFilePathNames[lCount] = ssFilePathName.str();
+						}
+
+						//  Declare omp parallel
+						#pragma omp parallel num_threads(nMaxProcs)
+						{
+							//  omp loop; chunk cost varies with background density
+							#pragma omp for schedule(dynamic)
+							for (long lCount = 0; lCount < lChunkCount; lCount++)
+							{
+								//  Chunk file
+								ofstream oFile;
+								//  Chunk buffer
+								string strBuffer = "";
+								//  First rank of chunk
+								uint64_t ullFirstRank = (uint64_t)lCount * ullChunkRanks;
+								//  Previous rank (delta format)
+								uint64_t ullPreviousRank = ullFirstRank;
+								//  nMer count
+								uint64_t ullCount = 0;
+
+								oFile.open(vChunkFilePathNames[lCount].c_str(), ios::out | ios::binary);
+
+								if (oFile.is_open())
+								{
+									strBuffer.reserve(m_ulExportBufferBytes + 64);
+
+									//  Scan membership words
+									for (uint64_t ullWordRank = ullFirstRank; ullWordRank < ullFirstRank + ullChunkRanks; ullWordRank += 64)
+									{
+										//  Membership word, complemented for the absent set
+										uint64_t ullWord = fnGetWord(ullWordRank);
+
+										if (!bPresent)
+											ullWord = ~ullWord;
+
+										//  Iterate set bits
+										while (ullWord != 0)
+										{
+											AppendBackgroundExportEntry(ullWordRank + GetLowestBit64(ullWord), nNMerLength, nFormat, ullPreviousRank, strBuffer);
+											ullCount++;
+
+											//  Clear lowest set bit
+											ullWord &= ullWord - 1;
+										}
+
+										//  Flush a full buffer
+										if (strBuffer.length() >= m_ulExportBufferBytes)
+										{
+											oFile.write(strBuffer.c_str(), strBuffer.length());
+											strBuffer.clear();
+										}
+									}
+
+									oFile.write(strBuffer.c_str(), strBuffer.length());
+
+									if (!oFile.good())
+									{
+										#pragma omp atomic write
+										bWriteFailed = true;
+									}
+
+									oFile.close();
+
+									#ifdef _WIN64
+									#else
+										chmod(vChunkFilePathNames[lCount].c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+									#endif
+
+									vChunkCounts[lCount] = ullCount;
+								}
+								else
+								{
+									#pragma omp atomic write
+									bWriteFailed = true;
+								}
+							}
+						}
+
+						if (!bWriteFailed)
+						{
+							//  Manifest header
+							strManifestFileText = "Set~Format~nMer Length~Chunk~First Rank~Last Rank~nMer Count~File Path Name\n";
+
+							for (long lCount = 0; lCount < lChunkCount; lCount++)
+							{
+								strManifestFileText += strSetName + "~" + GetBackgroundExportExtension(nFormat).substr(1) + "~" + ConvertIntToString(nNMerLength) + "~" + ConvertLongToString(lCount) + "~";
+								strManifestFileText += ConvertUnsignedInt64ToString((uint64_t)lCount * ullChunkRanks) + "~" + ConvertUnsignedInt64ToString((uint64_t)(lCount + 1) * ullChunkRanks - 1) + "~";
+								strManifestFileText += ConvertUnsignedInt64ToString(vChunkCounts[lCount]) + "~" + vChunkFilePathNames[lCount] + "\n";
+							}
+
+							return WriteFileText(strOutputFilePathBaseName + "_" + strSetName + "_manifest.txt", strManifestFileText);
+						}
+						else
+						{
+							ReportTimeStamp("[ExportBackground]", "ERROR:  Background Export Chunk File Write Failed [" + strOutputFilePathBaseName + "_" + strSetName + "_*]");
+						}
+					}
+					else
+					{
+						ReportTimeStamp("[ExportBackground]", "ERROR:  Background Membership Function is Not Set");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ExportBackground]", "ERROR:  Background Export Format is Unknown");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ExportBackground]", "ERROR:  nMer Length is Not Properly Set:  Should be 3 - 16");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ExportBackground]", "ERROR:  Output File Path Base Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ExportBackground] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
@@ -0,0 +1,47 @@
+// Base123_Background_Export.h : Exports the Base123 F-Distance background nMer set
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Exports the Base123 F-Distance background nMer set (header); the nMer universe (4^nMer ranks) is
+//      split into contiguous chunks that are scanned 64 ranks at a time and written in parallel, each
+//      to its own file, through a bounded buffer; a manifest lists every chunk file; formats:
+//
+//      text  :  one nMer per line (acgu), ascending
+//      2bit  :  packed 2-bit nMer ranks, little-endian, nMer / 4 bytes each, ascending
+//      delta :  ascending ranks as LEB128 varint gaps; the first gap is taken from the chunk's first rank
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+//  Background export format, text
+const int m_nBackgroundExportText = 0;
+//  Background export format, packed 2-bit ranks
+const int m_nBackgroundExportTwoBit = 1;
+//  Background export format, delta-coded ranks
+const int m_nBackgroundExportDelta = 2;
+
+//  Background export set, present nMers
+const int m_nBackgroundExportPresent = 1;
+//  Background export set, absent nMers
+const int m_nBackgroundExportAbsent = 2;
+//  Background export set, present and absent nMers
+const int m_nBackgroundExportBoth = 3;
+
+//  Background membership of the 64 nMer ranks starting at ullFirstRank (a multiple of 64); bit i is rank ullFirstRank + i
+typedef uint64_t (*BackgroundWordFunction)(uint64_t ullFirstRank);
+
+int GetBackgroundExportFormat(string strFormatName);
+int GetBackgroundExportSet(string strSetName);
+string GetBackgroundExportExtension(int nFormat);
+bool AppendBackgroundExportEntry(uint64_t ullRank, int nNMerLength, int nFormat, uint64_t& ullPreviousRank, string& strBuffer);
+bool ExportBackground(string strOutputFilePathBaseName, int nNMerLength, int nFormat, bool bPresent, BackgroundWordFunction fnGetWord, int nMaxProcs);
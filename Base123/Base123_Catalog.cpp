@@ -15,11 +15,115 @@
 #include "Base123.h"
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
+#include "Base123_Catalog_Binary.h"
+#include "Base123_Catalog_Compact.h"
+#include "Base123_Catalog_Query.h"
+#include "Base123_GBK_Parser.h"
+#include "Base123_Mapped_File.h"
 #include "Base123_Utilities.h"
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
 #include <sstream>
 #include <omp.h>
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets whether a file is a compiled (binary) catalog, by its magic
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathName:  catalog file path name
+//                               :  returns true, if the file is a compiled catalog; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+static bool IsBinaryCatalogFile(string strInputFilePathName)
+{
+	//  Catalog file
+	ifstream iFile(strInputFilePathName.c_str(), ios::in | ios::binary);
+	//  Magic
+	char chaMagic[sizeof(m_chaBinaryCatalogMagic)];
+
+	if ((iFile.is_open()) && (iFile.read(chaMagic, sizeof(chaMagic))))
+		return (memcmp(chaMagic, m_chaBinaryCatalogMagic, sizeof(chaMagic)) == 0);
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Interns a string into a compiled catalog string table
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strValue                          :  string to intern
+//  [unordered_map<string, uint32_t>&] umIndex :  string table index
+//  [vector<string>&] vStrings                 :  string table
+//                                             :  returns the string table index
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t InternCatalogString(string strValue, unordered_map<string, uint32_t>& umIndex, vector<string>& vStrings)
+{
+	//  Index entry
+	unordered_map<string, uint32_t>::iterator itIndex = umIndex.find(strValue);
+
+	if (itIndex != umIndex.end())
+		return itIndex->second;
+
+	umIndex.emplace(strValue, (uint32_t)vStrings.size());
+	vStrings.push_back(strValue);
+
+	return (uint32_t)vStrings.size() - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the accession of a text catalog line without parsing the entry; the line must be formatted
+//      as SetEntry requires (one header/CDS separator, 21 header columns), so that only lines that
+//      would parse to an accession are indexed
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const char*] chpLine:  catalog line
+//  [size_t] ulLength    :  catalog line length
+//                       :  returns the accession, if the line is properly formatted; else, an empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+static string GetCatalogLineAccession(const char* chpLine, size_t ulLength)
+{
+	//  Header/CDS separator
+	const char* chpSeparator = (const char*)memchr(chpLine, '|', ulLength);
+	//  Header column separator count
+	int nSeparators = 0;
+	//  Accession
+	string strAccession = "";
+
+	if ((chpSeparator == NULL) || (memchr(chpSeparator + 1, '|', ulLength - (size_t)(chpSeparator + 1 - chpLine)) != NULL))
+		return "";
+
+	for (const char* chpCount = chpLine; chpCount < chpSeparator; chpCount++)
+	{
+		if (*chpCount == '~')
+			nSeparators++;
+	}
+
+	if (nSeparators != m_nBinaryCatalogFields)
+		return "";
+
+	for (const char* chpCount = chpLine; (chpCount < chpSeparator) && (*chpCount != '~'); chpCount++)
+	{
+		if (*chpCount != '\r')
+			strAccession += *chpCount;
+	}
+
+	return strAccession;
+}
+
 //  Initialization
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -33,88 +137,267 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 CBase123_Catalog::CBase123_Catalog(long lMaxSize)
+{
+	InitializeCatalog(lMaxSize, false);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_Catalog class object, optionally lazy; a lazy catalog indexes line offsets
+//      (or compiled entry records) and accessions when opened, then parses each entry on its first
+//      access (thread-safe; each entry is parsed once); entries are not preallocated, so a lazy
+//      catalog costs memory only for the entries used; a lazy catalog is made eager by any change
+//      (SetEntryAtIndex, AddEntry, RemoveEntry)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lMaxSize:  maximum size expected for this catalog (indexed upper limit)
+//  [bool] bLazy   :  true, if entries are parsed on first access; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Catalog::CBase123_Catalog(long lMaxSize, bool bLazy)
+{
+	InitializeCatalog(lMaxSize, bLazy);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_Catalog class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Catalog::~CBase123_Catalog()
 {
 	try
 	{
-		//  GBK Features MUST be in lowercase for comparisons
-		m_strGBKFeature_Locus = "locus       ";
-		m_strGBKFeature_Organism = "  organism  ";
-		m_strGBKFeature_Definition = "definition  ";
-		m_strGBKFeature_Version = "version     ";
-		m_strGBKFeature_Host = "                     /host=\"";
-		m_strGBKFeature_Chromosome = "                     /chromosome=\"";
-		m_strGBKFeature_Segment = "                     /segment=\"";
-		m_strGBKFeature_Country = "                     /country=\"";
-		m_strGBKFeature_CollectionDate = "                     /collection_date=\"";
-		m_strGBKFeature_CDS = "     cds             ";
-		m_strGBKFeature_Gene = "                     /gene=\"";
-		m_strGBKFeature_Product = "                     /product=\"";
-		m_strGBKFeature_NextFeature = "                     /";
-		m_strGBKFeature_GeneID = "                     /db_xref=\"geneid:";
-		m_strGBKFeature_Translation = "                     /translation=\"";
-		m_strGBKFeature_Origin = "origin";
+		ReleaseLazyEntries();
 
-		m_vEntries.clear();
-		m_vEntries.resize(lMaxSize);
+		for (int nLock = 0; nLock < m_nLazyEntryLocks; nLock++)
+			omp_destroy_lock(&m_laLazyLocks[nLock]);
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [CBase123_Catalog] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [~CBase123_Catalog] Exception Code:  " << ex.what() << "\n";
 	}
 }
 
+//  Interface (public)
+
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Destructs the CBase123_Catalog class object
+//  Gets the catalog entry count (the index range; for an eager catalog, this includes unset entries)
 //
 ////////////////////////////////////////////////////////////////////////////////
 //
+//  :  returns the entry count
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_Catalog::GetEntryCount()
+{
+	if (m_bLazy)
+		return m_lLazyEntryCount;
+
+	return (long)m_vEntries.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
 //
+//  Gets a pointer to the catalog entry at the indicated index (no copy); a lazy catalog parses the
+//      entry on its first access, under the entry's lock, and returns the same entry thereafter
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex:  index to return
+//               :  returns a pointer to the requested catalog entry, if successful; else, NULL
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-CBase123_Catalog::~CBase123_Catalog()
+CBase123_Catalog_Entry* CBase123_Catalog::GetEntryPointerByIndex(long lIndex)
 {
+	//  Lazy entry
+	CBase123_Catalog_Entry* cepEntry = NULL;
+
 	try
 	{
+		//  If the index is in range
+		if ((lIndex >= 0) && (lIndex < GetEntryCount()))
+		{
+			if (!m_bLazy)
+				return &m_vEntries[lIndex];
+
+			cepEntry = m_appLazyEntries[lIndex].load(memory_order_acquire);
+
+			//  If the entry is not yet parsed, parse it under its lock (rechecked; another thread may have parsed it)
+			if (cepEntry == NULL)
+			{
+				omp_set_lock(&m_laLazyLocks[lIndex % m_nLazyEntryLocks]);
+
+				cepEntry = m_appLazyEntries[lIndex].load(memory_order_relaxed);
+
+				if (cepEntry == NULL)
+				{
+					cepEntry = new CBase123_Catalog_Entry();
+
+					GetLazyEntry(lIndex, *cepEntry);
+
+					m_appLazyEntries[lIndex].store(cepEntry, memory_order_release);
+				}
+
+				omp_unset_lock(&m_laLazyLocks[lIndex % m_nLazyEntryLocks]);
+			}
+
+			return cepEntry;
+		}
+		else
+		{
+			ReportTimeStamp("[GetEntryPointerByIndex]", "ERROR:  Index [" + ConvertLongToString(lIndex) + "] is Out of Range [0:" + ConvertLongToString(GetEntryCount() - 1) + "]");
+		}
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [~CBase123_Catalog] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [GetEntryPointerByIndex] Exception Code:  " << ex.what() << "\n";
 	}
+
+	return NULL;
 }
 
-//  Interface (public)
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets one header column (catalog column order) of the entry at the indicated index; a compacted
+//      catalog reads the column in place, without decoding the entry (for scans)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex :  entry index
+//  [int] nColumn :  column index [0:20]
+//                :  returns the column value, if the index and column are in range; else, an empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string CBase123_Catalog::GetColumnByIndex(long lIndex, int nColumn)
+{
+	//  Entry
+	CBase123_Catalog_Entry* cepEntry = NULL;
+
+	try
+	{
+		if (m_pb123Compact != NULL)
+			return m_pb123Compact->GetColumn(lIndex, nColumn);
+
+		cepEntry = GetEntryPointerByIndex(lIndex);
+
+		if (cepEntry != NULL)
+			return cepEntry->GetColumn(nColumn);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetColumnByIndex] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return "";
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Gets a pointer to the indicated CDS colletion vector<structCDS> by accession search
+//  Gets the index of the entry for the indicated accession; uses the accession index when current
+//      (built by OpenCatalog), else searches the entries
 //
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string] strAccession:  accession to search and return
-//                       :  returns  a pointer to the requested CDS collection vector<structCDS>, if successful; else, NULL
+//  [string&] strAccession:  accession to search
+//                        :  returns the entry index, if found; else, -1
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-vector<structCDS>* CBase123_Catalog::GetCDSCollectionPointerByAccession(string strAccession)
+long CBase123_Catalog::GetIndexByAccession(string& strAccession)
 {
 	try
 	{
 		if (!strAccession.empty())
 		{
-			for (long lCount = 0; lCount < m_vEntries.size(); lCount++)
+			if (m_bAccessionsIndexed)
+			{
+				//  Index shard
+				unordered_map<string, long>& umShard = m_vAccessionIndex[hash<string>()(strAccession) % m_nAccessionIndexShards];
+				//  Index entry
+				unordered_map<string, long>::const_iterator itIndex = umShard.find(strAccession);
+
+				if (itIndex != umShard.end())
+					return itIndex->second;
+			}
+			else
 			{
-				if (m_vEntries[lCount].GetAccession() == strAccession)
-					return m_vEntries[lCount].GetCDSCollectionPointer();
+				for (long lCount = 0; lCount < m_vEntries.size(); lCount++)
+				{
+					if (m_vEntries[lCount].GetAccession() == strAccession)
+						return lCount;
+				}
 			}
 		}
 		else
 		{
-			ReportTimeStamp("[GetCDSCollectionPointerByAccession]", "ERROR:  Accession is Empty");
+			ReportTimeStamp("[GetIndexByAccession]", "ERROR:  Accession is Empty");
 		}
 	}
 	catch (exception ex)
+	{
+		cout << "ERROR [GetIndexByAccession] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets a pointer to the catalog entry for the indicated accession (no copy; the entry remains owned
+//      by the catalog and is valid until the catalog changes)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strAccession:  accession to search and return
+//                        :  returns a pointer to the requested catalog entry, if successful; else, NULL
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Catalog_Entry* CBase123_Catalog::GetEntryPointerByAccession(string& strAccession)
+{
+	//  Entry index
+	long lIndex = GetIndexByAccession(strAccession);
+
+	if (lIndex >= 0)
+		return GetEntryPointerByIndex(lIndex);
+
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets a pointer to the indicated CDS colletion vector<structCDS> by accession search
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strAccession:  accession to search and return
+//                       :  returns  a pointer to the requested CDS collection vector<structCDS>, if successful; else, NULL
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+vector<structCDS>* CBase123_Catalog::GetCDSCollectionPointerByAccession(string strAccession)
+{
+	try
+	{
+		//  Entry
+		CBase123_Catalog_Entry* cepEntry = GetEntryPointerByAccession(strAccession);
+
+		if (cepEntry != NULL)
+			return cepEntry->GetCDSCollectionPointer();
+	}
+	catch (exception ex)
 	{
 		cout << "ERROR [GetCDSCollectionPointerByAccession] Exception Code:  " << ex.what() << "\n";
 	}
@@ -138,18 +421,11 @@ bool CBase123_Catalog::GetCDSCollectionByAccession(string strAccession, vector<s
 {
 	try
 	{
-		if (!strAccession.empty())
-		{
-			for (long lCount = 0; lCount < m_vEntries.size(); lCount++)
-			{
-				if (m_vEntries[lCount].GetAccession() == strAccession)
-					return m_vEntries[lCount].GetCDSCollection(vCDSs);
-			}
-		}
-		else
-		{
-			ReportTimeStamp("[GetCDSCollectionByAccession]", "ERROR:  Accession is Empty");
-		}
+		//  Entry
+		CBase123_Catalog_Entry* cepEntry = GetEntryPointerByAccession(strAccession);
+
+		if (cepEntry != NULL)
+			return cepEntry->GetCDSCollection(vCDSs);
 	}
 	catch (exception ex)
 	{
@@ -174,13 +450,13 @@ vector<structCDS>* CBase123_Catalog::GetCDSCollectionPointerByIndex(long lIndex)
 {
 	try
 	{
-		if ((lIndex >= 0) && (lIndex < m_vEntries.size()))
+		if ((lIndex >= 0) && (lIndex < GetEntryCount()))
 		{
-			return m_vEntries[lIndex].GetCDSCollectionPointer();
+			return GetEntryPointerByIndex(lIndex)->GetCDSCollectionPointer();
 		}
 		else
 		{
-			ReportTimeStamp("[GetCDSCollectionPointerByIndex]", "ERROR:  Index [" + ConvertLongToString(lIndex) + "] is Out of Range [0:" + ConvertLongToString((long)m_vEntries.size() - 1) + "]");
+			ReportTimeStamp("[GetCDSCollectionPointerByIndex]", "ERROR:  Index [" + ConvertLongToString(lIndex) + "] is Out of Range [0:" + ConvertLongToString(GetEntryCount() - 1) + "]");
 		}
 	}
 	catch (exception ex)
@@ -207,13 +483,13 @@ bool CBase123_Catalog::GetCDSCollectionByIndex(long lIndex, vector<structCDS>& v
 {
 	try
 	{
-		if ((lIndex >= 0) && (lIndex < m_vEntries.size()))
+		if ((lIndex >= 0) && (lIndex < GetEntryCount()))
 		{
-			return m_vEntries[lIndex].GetCDSCollection(vCDSs);
+			return GetEntryPointerByIndex(lIndex)->GetCDSCollection(vCDSs);
 		}
 		else
 		{
-			ReportTimeStamp("[GetCDSCollectionByIndex]", "ERROR:  Index [" + ConvertLongToString(lIndex) + "] is Out of Range [0:" + ConvertLongToString((long)m_vEntries.size() - 1) + "]");
+			ReportTimeStamp("[GetCDSCollectionByIndex]", "ERROR:  Index [" + ConvertLongToString(lIndex) + "] is Out of Range [0:" + ConvertLongToString(GetEntryCount() - 1) + "]");
 		}
 	}
 	catch (exception ex)
@@ -240,11 +516,14 @@ bool CBase123_Catalog::SetEntryAtIndex(CBase123_Catalog_Entry& eSet, long lIndex
 {
 	try
 	{
+		MaterializeLazyEntries();
+
 		if ((lIndex >= 0) && (lIndex < m_vEntries.size()))
 		{
 			eSet.SetIsSet(true);
 
 			m_vEntries[lIndex] = eSet;
+			m_bAccessionsIndexed = false;
 
 			return true;
 		}
@@ -276,9 +555,12 @@ bool CBase123_Catalog::AddEntry(CBase123_Catalog_Entry& eAdd)
 {
 	try
 	{
+		MaterializeLazyEntries();
+
 		eAdd.SetIsSet(true);
 
 		m_vEntries.push_back(eAdd);
+		m_bAccessionsIndexed = false;
 
 		return true;
 	}
@@ -307,15 +589,15 @@ bool CBase123_Catalog::GetEntryByIndex(int nIndex, CBase123_Catalog_Entry& ceGet
 	try
 	{
 		//  If the index is in range
-		if ((nIndex >= 0) && (nIndex < m_vEntries.size()))
+		if ((nIndex >= 0) && (nIndex < GetEntryCount()))
 		{
-			ceGet = m_vEntries[nIndex];
+			ceGet = *GetEntryPointerByIndex(nIndex);
 
 			return true;
 		}
 		else
 		{
-			ReportTimeStamp("[GetEntryByIndex]", "ERROR:  Catalog Index [" + ConvertIntToString(nIndex) + "] is Out of Range [0:" + ConvertIntToString((int)m_vEntries.size() - 1) + "]");
+			ReportTimeStamp("[GetEntryByIndex]", "ERROR:  Catalog Index [" + ConvertIntToString(nIndex) + "] is Out of Range [0:" + ConvertIntToString((int)GetEntryCount() - 1) + "]");
 		}
 	}
 	catch (exception ex)
@@ -342,25 +624,14 @@ bool CBase123_Catalog::GetEntryByAccession(string strAccession, CBase123_Catalog
 {
 	try
 	{
-		//  If the accession is not empty
-		if (!strAccession.empty())
-		{
-			for (int nCount = 0; nCount < m_vEntries.size(); nCount++)
-			{
-				if (m_vEntries[nCount].GetAccession() == strAccession)
-				{
-					ceGet = m_vEntries[nCount];
-
-					return true;
-				}
+		//  Entry
+		CBase123_Catalog_Entry* cepEntry = GetEntryPointerByAccession(strAccession);
 
-				if (!m_vEntries[nCount].GetIsSet())
-					break;
-			}
-		}
-		else
+		if (cepEntry != NULL)
 		{
-			ReportTimeStamp("[GetEntryByAccession]", "ERROR:  Accession is Empty");
+			ceGet = *cepEntry;
+
+			return true;
 		}
 	}
 	catch (exception ex)
@@ -410,10 +681,13 @@ bool CBase123_Catalog::RemoveEntry(int nIndex)
 {
 	try
 	{
+		MaterializeLazyEntries();
+
 		//  If the index is in range
 		if ((nIndex >= 0) && (nIndex < m_vEntries.size()))
 		{
 			m_vEntries.erase(m_vEntries.begin() + nIndex);
+			m_bAccessionsIndexed = false;
 
 			return true;
 		}
@@ -432,7 +706,7 @@ bool CBase123_Catalog::RemoveEntry(int nIndex)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Opens and creates the catalog from file
+//  Opens and creates the catalog from file, using all available processors
 //
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -443,52 +717,76 @@ bool CBase123_Catalog::RemoveEntry(int nIndex)
 
 bool CBase123_Catalog::OpenCatalog(string strInputFilePathName)
 {
-	//  The file text to open
-	string strInputFileText = "";
-	//  The file line vector
-	vector<string> vLines;
+	return OpenCatalog(strInputFilePathName, omp_get_max_threads());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Opens and creates the catalog from file (text or compiled), in parallel; a text catalog is
+//      mapped, its lines located (see GetCatalogLines), then its entries parsed concurrently; a
+//      lazy catalog is indexed, only (see OpenLazyCatalog)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathName:  file path name of the catalog
+//  [int] nMaxProcs              :  maximum processors for openMP
+//                               :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::OpenCatalog(string strInputFilePathName, int nMaxProcs)
+{
+	//  Mapped catalog
+	CBase123_Mapped_File b123MappedFile;
+	//  Line starts (byte offsets)
+	vector<uint64_t> vLineStarts;
+	//  Line ends (byte offsets, exclusive)
+	vector<uint64_t> vLineEnds;
 
 	try
 	{
+		if (nMaxProcs < 1)
+			nMaxProcs = 1;
+
+		//  If the catalog is lazy, index it
+		if ((!strInputFilePathName.empty()) && (m_bLazy))
+			return OpenLazyCatalog(strInputFilePathName, nMaxProcs);
+
+		//  If the catalog is compiled, map it
+		if ((!strInputFilePathName.empty()) && (IsBinaryCatalogFile(strInputFilePathName)))
+			return OpenBinaryCatalog(strInputFilePathName, nMaxProcs);
+
 		//  If the file path name is not empty
 		if (!strInputFilePathName.empty())
 		{
-			//  Get the file text
-			GetFileText(strInputFilePathName, strInputFileText);
-
 			//  If file text is not empty
-			if (!strInputFileText.empty())
+			if (b123MappedFile.OpenMappedFile(strInputFilePathName))
 			{
-				//  SPlit the file into lines
-				SplitString(strInputFileText, '\n', vLines);
+				//  File text
+				const char* chpText = b123MappedFile.GetData();
+
+				GetCatalogLines(chpText, b123MappedFile.GetSize(), nMaxProcs, vLineStarts, vLineEnds);
 
 				//  If lines are filled
-				if (vLines.size() > 0)
+				if (vLineStarts.size() > 0)
 				{
-					//  Iterate through the lines, create catalog entries; 1, to skip header
-					for (long lCount = 1; lCount < vLines.size(); lCount++)
+					//  Entries (less the header line)
+					if ((long)vLineStarts.size() - 1 <= (long)m_vEntries.size())
 					{
-						//  If line is not empty
-						if (!vLines[lCount].empty())
+						//  Create catalog entries; line 0, the header, is skipped
+						#pragma omp parallel for schedule(dynamic, 256) num_threads(nMaxProcs)
+						for (long lLine = 1; lLine < (long)vLineStarts.size(); lLine++)
 						{
-							CBase123_Catalog_Entry eAdd;
-
-							eAdd.SetEntry(vLines[lCount]);
-
-							if ((lCount - 1 >= 0) && (lCount - 1 < m_vEntries.size()))
-								SetEntryAtIndex(eAdd, lCount - 1);
-							else
-							{
-								ReportTimeStamp("[OpenCatalog]", "ERROR:  Catalog Entry Index [" + ConvertLongToString(lCount) + "] Exceeds Index Range [0:" + ConvertLongToString((long)m_vEntries.size()) + "]");
-
-								return false;
-							}
+							SetEntryFromLine(m_vEntries[lLine - 1], chpText + vLineStarts[lLine], (size_t)(vLineEnds[lLine] - vLineStarts[lLine]));
 						}
-						//  No entry, there should not be empty lines
-					}
 
-					return true;
-				}
+						return IndexAccessions(nMaxProcs);
+					}
+					else
+					{
+						ReportTimeStamp("[OpenCatalog]", "ERROR:  Catalog Entry Count [" + ConvertLongToString((long)vLineStarts.size() - 1) + "] Exceeds Index Range [0:" + ConvertLongToString((long)m_vEntries.size()) + "]");
+					}
+				}
 				else
 				{
 					ReportTimeStamp("[OpenCatalog]", "ERROR:  Catalog File [" + strInputFilePathName + "] Container is Not Set");
@@ -562,17 +860,20 @@ bool CBase123_Catalog::WriteCatalog(string strOutputFilePathName)
 			strOutputFileText = GetEntryHeader() + "|" + GetCDSHeader() + "\n" + strOutputFileText;
 
 			//  Iterate entries to fill file text
-			for (long lCount = 0; lCount < m_vEntries.size() ; lCount++)
+			for (long lCount = 0; lCount < GetEntryCount() ; lCount++)
 			{
+				//  Entry
+				CBase123_Catalog_Entry* cepEntry = GetEntryPointerByIndex(lCount);
+
 				//  If entry is set
-				if (m_vEntries[lCount].GetIsSet())
+				if (cepEntry->GetIsSet())
 				{
 					//  Append new line to second+ lines
 					if (lCount > 0)
 						strOutputFileText += '\n';
 
 					//  Concatenate the file text
-					strOutputFileText += m_vEntries[lCount].GetEntry();
+					strOutputFileText += cepEntry->GetEntry();
 				}
 			}
 
@@ -595,6 +896,490 @@ bool CBase123_Catalog::WriteCatalog(string strOutputFilePathName)
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes the catalog in compiled (binary) format; see Base123_Catalog_Binary.h
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strOutputFilePathName:  file path name of the compiled catalog
+//                                :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::WriteBinaryCatalog(string strOutputFilePathName)
+{
+	//  Header
+	structBinaryCatalogHeader stHeader;
+	//  Entry records
+	vector<structBinaryCatalogEntry> vEntries;
+	//  CDS records
+	vector<structBinaryCatalogCDS> vCDSs;
+	//  String table
+	vector<string> vStrings;
+	//  String table index
+	unordered_map<string, uint32_t> umStrings;
+	//  String offsets
+	vector<uint64_t> vStringOffsets;
+	//  Output file
+	ofstream oFile;
+
+	try
+	{
+		//  If the file path name is not empty
+		if (!strOutputFilePathName.empty())
+		{
+			//  String 0 is empty
+			InternCatalogString("", umStrings, vStrings);
+
+			//  Iterate set entries
+			for (long lCount = 0; lCount < GetEntryCount(); lCount++)
+			{
+				//  Entry
+				CBase123_Catalog_Entry* cepEntry = GetEntryPointerByIndex(lCount);
+
+				if (cepEntry->GetIsSet())
+				{
+					//  Entry record
+					structBinaryCatalogEntry stEntry;
+					//  Entry CDSs
+					vector<structCDS>* pvCDSs = cepEntry->GetCDSCollectionPointer();
+
+					memset(&stEntry, 0, sizeof(stEntry));
+
+					stEntry.llLength = cepEntry->GetLength();
+					stEntry.ullCDSStart = vCDSs.size();
+					stEntry.untCDSCount = (uint32_t)pvCDSs->size();
+
+					//  String fields are every column except length (column 2)
+					for (int nField = 0; nField < m_nBinaryCatalogFields; nField++)
+						stEntry.untaFields[nField] = InternCatalogString(cepEntry->GetColumn(nField < 2 ? nField : nField + 1), umStrings, vStrings);
+
+					for (size_t ulCDS = 0; ulCDS < pvCDSs->size(); ulCDS++)
+					{
+						//  CDS record
+						structBinaryCatalogCDS stCDS;
+
+						memset(&stCDS, 0, sizeof(stCDS));
+
+						stCDS.llStart = (*pvCDSs)[ulCDS].lStart;
+						stCDS.llStop = (*pvCDSs)[ulCDS].lStop;
+						stCDS.untIsComplement = InternCatalogString((*pvCDSs)[ulCDS].strIsComplement, umStrings, vStrings);
+						stCDS.untNameID = InternCatalogString((*pvCDSs)[ulCDS].strNameID, umStrings, vStrings);
+						stCDS.untCompleteness = InternCatalogString((*pvCDSs)[ulCDS].strCompleteness, umStrings, vStrings);
+
+						vCDSs.push_back(stCDS);
+					}
+
+					vEntries.push_back(stEntry);
+				}
+			}
+
+			//  String offsets
+			vStringOffsets.resize(vStrings.size() + 1, 0);
+			for (size_t ulCount = 0; ulCount < vStrings.size(); ulCount++)
+				vStringOffsets[ulCount + 1] = vStringOffsets[ulCount] + vStrings[ulCount].length();
+
+			//  Header
+			memset(&stHeader, 0, sizeof(stHeader));
+			memcpy(stHeader.chaMagic, m_chaBinaryCatalogMagic, sizeof(stHeader.chaMagic));
+			stHeader.untVersion = m_untBinaryCatalogVersion;
+			stHeader.untStringCount = (uint32_t)vStrings.size();
+			stHeader.ullEntryCount = vEntries.size();
+			stHeader.ullCDSCount = vCDSs.size();
+			stHeader.ullEntryOffset = sizeof(stHeader);
+			stHeader.ullCDSOffset = stHeader.ullEntryOffset + sizeof(structBinaryCatalogEntry) * vEntries.size();
+			stHeader.ullStringTableOffset = stHeader.ullCDSOffset + sizeof(structBinaryCatalogCDS) * vCDSs.size();
+			stHeader.ullStringOffset = stHeader.ullStringTableOffset + sizeof(uint64_t) * vStringOffsets.size();
+
+			oFile.open(strOutputFilePathName.c_str(), ios::out | ios::trunc | ios::binary);
+
+			if (oFile.is_open())
+			{
+				oFile.write((const char*)&stHeader, sizeof(stHeader));
+				if (!vEntries.empty())
+					oFile.write((const char*)&vEntries[0], sizeof(structBinaryCatalogEntry) * vEntries.size());
+				if (!vCDSs.empty())
+					oFile.write((const char*)&vCDSs[0], sizeof(structBinaryCatalogCDS) * vCDSs.size());
+				oFile.write((const char*)&vStringOffsets[0], sizeof(uint64_t) * vStringOffsets.size());
+				for (size_t ulCount = 0; ulCount < vStrings.size(); ulCount++)
+					oFile.write(vStrings[ulCount].data(), vStrings[ulCount].length());
+
+				//  Write status
+				bool bWritten = oFile.good();
+
+				oFile.close();
+
+				if (bWritten)
+					return true;
+				else
+				{
+					ReportTimeStamp("[WriteBinaryCatalog]", "ERROR:  Catalog File [" + strOutputFilePathName + "] Write Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[WriteBinaryCatalog]", "ERROR:  Catalog File [" + strOutputFilePathName + "] Create/Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[WriteBinaryCatalog]", "ERROR:  Catalog File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteBinaryCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Compiles a catalog (text or compiled) to compiled (binary) format, and writes the compiled
+//      catalog's query index file (<compiled catalog>.qidx; see Base123_Catalog_Query.h)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathName :  file path name of the catalog to compile
+//  [string] strOutputFilePathName:  file path name of the compiled catalog
+//                                :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::CompileCatalog(string strInputFilePathName, string strOutputFilePathName)
+{
+	try
+	{
+		if (OpenCatalog(strInputFilePathName))
+		{
+			if (WriteBinaryCatalog(strOutputFilePathName))
+			{
+				//  Set entry count
+				long lSetCount = 0;
+
+				for (long lCount = 0; lCount < GetEntryCount(); lCount++)
+				{
+					if (GetEntryPointerByIndex(lCount)->GetIsSet())
+						lSetCount++;
+				}
+
+				ReportTimeStamp("[CompileCatalog]", "NOTE:  Compiled Entries = " + ConvertLongToString(lSetCount));
+
+				//  Index the compiled catalog (entries are numbered as compiled) and write its query index file
+				{
+					//  Compiled catalog
+					CBase123_Catalog b123Compiled(lSetCount > 0 ? lSetCount : 1, true);
+					//  Catalog query index
+					CBase123_Catalog_Query b123Query;
+					//  Mapped compiled catalog
+					CBase123_Mapped_File b123MappedFile;
+					//  Compiled catalog header
+					structBinaryCatalogHeader stHeader;
+					//  Query index file path name
+					string strIndexFilePathName = strOutputFilePathName + m_chaQueryIndexExtension;
+
+					if ((b123Compiled.OpenCatalog(strOutputFilePathName, omp_get_max_threads())) && (b123Query.IndexCatalog(b123Compiled, omp_get_max_threads())) &&
+						(b123MappedFile.OpenMappedFile(strOutputFilePathName)) && (GetBinaryCatalogHeader(b123MappedFile.GetData(), b123MappedFile.GetSize(), strOutputFilePathName, stHeader)) &&
+						(b123Query.WriteIndexes(strIndexFilePathName, stHeader, b123MappedFile.GetSize())))
+					{
+						ReportTimeStamp("[CompileCatalog]", "NOTE:  Query Index File [" + strIndexFilePathName + "] Written");
+					}
+					else
+					{
+						ReportTimeStamp("[CompileCatalog]", "ERROR:  Query Index File [" + strIndexFilePathName + "] Write Failed");
+
+						return false;
+					}
+				}
+
+				return true;
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[CompileCatalog]", "ERROR:  Catalog File [" + strInputFilePathName + "] Open Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CompileCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Compacts the catalog (see Base123_Catalog_Compact.h); entries are encoded in index order into
+//      the compact store, which then replaces the entries (or the lazy source); entries are decoded
+//      on first access, as for a lazy catalog, and GetColumnByIndex reads columns in place; trailing
+//      unset entries are dropped; entry indices (and so the accession index) are unchanged
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nMaxProcs:  maximum processors for openMP
+//                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::CompactCatalog(int nMaxProcs)
+{
+	//  Compact store
+	CBase123_Catalog_Compact* pb123Compact = NULL;
+	//  Entry count (through the last set entry)
+	long lEntryCount = 0;
+	//  Entry block (lazy entries, parsed in parallel)
+	vector<CBase123_Catalog_Entry> vBlock;
+	//  Entries are encoded
+	bool bEncoded = true;
+	//  Accessions, by entry (if the catalog is not indexed)
+	vector<string> vAccessions;
+
+	try
+	{
+		if (nMaxProcs < 1)
+			nMaxProcs = 1;
+
+		//  If the catalog is not yet compacted
+		if (m_pb123Compact == NULL)
+		{
+			if (m_bLazy)
+				lEntryCount = m_lLazyEntryCount;
+			else
+			{
+				for (lEntryCount = (long)m_vEntries.size(); lEntryCount > 0; lEntryCount--)
+				{
+					if (m_vEntries[lEntryCount - 1].GetIsSet())
+						break;
+				}
+			}
+
+			pb123Compact = new CBase123_Catalog_Compact();
+
+			//  Encode entries in index order
+			for (long lBlock = 0; (bEncoded) && (lBlock < lEntryCount); lBlock += m_lCompactBlockSize)
+			{
+				//  Block end
+				long lBlockEnd = min(lBlock + m_lCompactBlockSize, lEntryCount);
+
+				if (m_bLazy)
+				{
+					vBlock.resize(lBlockEnd - lBlock);
+
+					#pragma omp parallel for schedule(dynamic, 64) num_threads(nMaxProcs)
+					for (long lCount = lBlock; lCount < lBlockEnd; lCount++)
+					{
+						//  Lazy entry, if already parsed
+						CBase123_Catalog_Entry* cepEntry = m_appLazyEntries[lCount].load(memory_order_acquire);
+
+						if (cepEntry != NULL)
+							vBlock[lCount - lBlock] = *cepEntry;
+						else
+							GetLazyEntry(lCount, vBlock[lCount - lBlock]);
+					}
+
+					for (long lCount = lBlock; (bEncoded) && (lCount < lBlockEnd); lCount++)
+						bEncoded = pb123Compact->AddEntry(vBlock[lCount - lBlock]);
+				}
+				else
+				{
+					for (long lCount = lBlock; (bEncoded) && (lCount < lBlockEnd); lCount++)
+						bEncoded = pb123Compact->AddEntry(m_vEntries[lCount]);
+				}
+			}
+
+			if (bEncoded)
+			{
+				pb123Compact->ShrinkToFit();
+
+				//  Release the entries and the lazy source; the compact store replaces them
+				ReleaseLazyEntries();
+				vector<CBase123_Catalog_Entry>().swap(m_vEntries);
+
+				m_pb123Compact = pb123Compact;
+				m_appLazyEntries = new atomic<CBase123_Catalog_Entry*>[lEntryCount];
+				for (long lCount = 0; lCount < lEntryCount; lCount++)
+					m_appLazyEntries[lCount].store(NULL);
+				m_lLazyEntryCount = lEntryCount;
+				m_bLazy = true;
+
+				//  If the catalog is not indexed, index it (the entry scan is no longer available)
+				if (!m_bAccessionsIndexed)
+				{
+					vAccessions.resize(lEntryCount);
+
+					for (long lCount = 0; lCount < lEntryCount; lCount++)
+					{
+						if (m_pb123Compact->GetIsSet(lCount))
+							vAccessions[lCount] = m_pb123Compact->GetColumn(lCount, 0);
+					}
+
+					IndexAccessions(vAccessions, nMaxProcs);
+				}
+
+				ReportTimeStamp("[CompactCatalog]", "NOTE:  Compacted Entries = " + ConvertLongToString(lEntryCount) + ", Memory = " + ConvertLongToString((long)m_pb123Compact->GetMemorySize()) + " bytes");
+
+				return true;
+			}
+
+			delete pb123Compact;
+		}
+		else
+		{
+			return true;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CompactCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Queries a catalog and writes the matching entries as a list file (see Base123_Catalog_Query.h
+//      for the query syntax); if the catalog is compiled and its query index file (<catalog>.qidx)
+//      is current, the indexes are opened and each match is read from the mapped catalog, without
+//      opening the catalog; else, the catalog is opened and compacted, its query columns indexed
+//      and, if it is compiled, the query index file rewritten; each match is written as its
+//      accession, or as the accession file path name transform
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathName           :  file path name of the catalog (text or compiled)
+//  [string] strQuery                       :  query
+//  [string] strOutputListFilePathName      :  output list file path name
+//  [string] strOutputFilePathNameTransform :  output file path name transform [optional]
+//  [int] nMaxProcs                         :  maximum processors for openMP
+//                                          :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::QueryCatalog(string strInputFilePathName, string strQuery, string strOutputListFilePathName, string strOutputFilePathNameTransform, int nMaxProcs)
+{
+	//  Catalog query index
+	CBase123_Catalog_Query b123Query;
+	//  Mapped compiled catalog
+	CBase123_Mapped_File b123MappedFile;
+	//  Compiled catalog header
+	structBinaryCatalogHeader stHeader;
+	//  Query index file path name
+	string strIndexFilePathName = strInputFilePathName + m_chaQueryIndexExtension;
+	//  Matching entry indices
+	vector<long> vIndices;
+	//  Matching entry accessions
+	vector<string> vAccessions;
+	//  Output list file text
+	string strListFileText = "";
+	//  Catalog is compiled, if true
+	bool bIsCompiled = false;
+	//  Indexes are opened from the query index file, if true
+	bool bIsIndexOpened = false;
+
+	try
+	{
+		//  If output list file path name is not empty
+		if (!strOutputListFilePathName.empty())
+		{
+			//  If the catalog is compiled, open its query index file
+			if (IsBinaryCatalogFile(strInputFilePathName))
+			{
+				bIsCompiled = ((b123MappedFile.OpenMappedFile(strInputFilePathName)) && (GetBinaryCatalogHeader(b123MappedFile.GetData(), b123MappedFile.GetSize(), strInputFilePathName, stHeader)));
+
+				if (bIsCompiled)
+					bIsIndexOpened = b123Query.OpenIndexes(strIndexFilePathName, stHeader, b123MappedFile.GetSize());
+				else
+				{
+					ReportTimeStamp("[QueryCatalog]", "ERROR:  Catalog File [" + strInputFilePathName + "] Open Failed");
+
+					return false;
+				}
+			}
+
+			//  If the indexes are not opened, index the catalog
+			if (!bIsIndexOpened)
+			{
+				if (!((OpenCatalog(strInputFilePathName, nMaxProcs)) && (CompactCatalog(nMaxProcs)) && (b123Query.IndexCatalog(*this, nMaxProcs))))
+				{
+					ReportTimeStamp("[QueryCatalog]", "ERROR:  Catalog File [" + strInputFilePathName + "] Open Failed");
+
+					return false;
+				}
+
+				if (bIsCompiled)
+				{
+					if (b123Query.WriteIndexes(strIndexFilePathName, stHeader, b123MappedFile.GetSize()))
+						ReportTimeStamp("[QueryCatalog]", "NOTE:  Query Index File [" + strIndexFilePathName + "] is Missing or Stale; Rebuilt");
+				}
+			}
+
+			if (b123Query.Query(strQuery, vIndices))
+			{
+				vAccessions.resize(vIndices.size());
+
+				//  Accessions, from the mapped catalog (string field 0), or from the opened catalog
+				if (bIsIndexOpened)
+				{
+					//  Tables
+					const char* chpData = b123MappedFile.GetData();
+					const structBinaryCatalogEntry* stpEntries = (const structBinaryCatalogEntry*)(chpData + stHeader.ullEntryOffset);
+					const uint64_t* ullpStringOffsets = (const uint64_t*)(chpData + stHeader.ullStringTableOffset);
+					const char* chpStrings = chpData + stHeader.ullStringOffset;
+
+					for (size_t stCount = 0; stCount < vIndices.size(); stCount++)
+					{
+						//  String index
+						uint32_t untString = (stpEntries[vIndices[stCount]].untaFields[0] < stHeader.untStringCount) ? stpEntries[vIndices[stCount]].untaFields[0] : 0;
+
+						vAccessions[stCount].assign(chpStrings + ullpStringOffsets[untString], (size_t)(ullpStringOffsets[untString + 1] - ullpStringOffsets[untString]));
+					}
+				}
+				else
+				{
+					for (size_t stCount = 0; stCount < vIndices.size(); stCount++)
+						vAccessions[stCount] = GetColumnByIndex(vIndices[stCount], 0);
+				}
+
+				for (size_t stCount = 0; stCount < vAccessions.size(); stCount++)
+				{
+					if (!strOutputFilePathNameTransform.empty())
+						strListFileText += TransformFilePathName(vAccessions[stCount] + ".", strOutputFilePathNameTransform, "fa") + "\n";
+					else
+						strListFileText += vAccessions[stCount] + "\n";
+				}
+
+				ReportTimeStamp("[QueryCatalog]", "NOTE:  Query [" + strQuery + "] Matched Entries = " + ConvertLongToString((long)vIndices.size()) + " of " + ConvertLongToString(b123Query.GetEntryCount()));
+
+				//  Write the list
+				if (WriteFileText(strOutputListFilePathName, strListFileText))
+					return true;
+				else
+				{
+					ReportTimeStamp("[QueryCatalog]", "ERROR:  Output List File [" + strOutputListFilePathName + "] Write Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[QueryCatalog]", "ERROR:  Query [" + strQuery + "] Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[QueryCatalog]", "ERROR:  Output List File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [QueryCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Creates a BIG format genome data catalog from NCBI .dat/_na.dat format
@@ -683,7 +1468,8 @@ bool CBase123_Catalog::CreateDatCatalog(string strDatInputFilePathName, string s
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Creates a BIG format genome data catalog from NCBI .gbk format
+//  Creates a BIG format genome data catalog from NCBI .gbk format; a content manifest (accession,
+//      version and content hash, by entry) is written beside the catalog for RefreshGBKCatalog
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -708,6 +1494,10 @@ bool CBase123_Catalog::CreateGBKCatalog(string strInputFilePathNameList, string
 	vector<string> vErrorEntries;
 	//  Error file text
 	string strErrorFileText = "";
+	//  Manifest accessions, versioned accessions and content hashes, by list entry (empty, if not cataloged)
+	vector<string> vAccessions;
+	vector<string> vVersionedAccessions;
+	vector<uint64_t> vHashes;
 
 	try
 	{
@@ -729,6 +1519,11 @@ bool CBase123_Catalog::CreateGBKCatalog(string strInputFilePathNameList, string
 						//  Initialize errof file vector<string>
 						vErrorEntries.resize(vFilePathNames.size());
 
+						//  Initialize manifest vectors
+						vAccessions.resize(vFilePathNames.size());
+						vVersionedAccessions.resize(vFilePathNames.size());
+						vHashes.resize(vFilePathNames.size(), 0);
+
 						//  Initialize time stamp lock
 						omp_init_lock(&lockList);
 
@@ -757,8 +1552,8 @@ bool CBase123_Catalog::CreateGBKCatalog(string strInputFilePathNameList, string
 								//  If file path name is not empty
 								if (!vFilePathNames[lCount].empty())
 								{
-									//  GBK file text
-									string strGBKFileText = "";
+									//  GBK file (mapped)
+									CBase123_Mapped_File b123GBKFile;
 									//  Working file path name
 									string strWorkingFilePathName = "";
 
@@ -768,11 +1563,11 @@ bool CBase123_Catalog::CreateGBKCatalog(string strInputFilePathNameList, string
 									else
 										strWorkingFilePathName = vFilePathNames[lCount];
 
-									//  Read .gbk file text
-									if (GetFileText(strWorkingFilePathName, strGBKFileText))
+									//  Map .gbk file text
+									if (b123GBKFile.OpenMappedFile(strWorkingFilePathName))
 									{
 										//  Catalog the data
-										if (!CatalogGBKFile(strGBKFileText, lCount))
+										if (!CatalogGBKFile(b123GBKFile.GetData(), b123GBKFile.GetSize(), lCount))
 										{
 											vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Failed\n";
 
@@ -780,6 +1575,9 @@ bool CBase123_Catalog::CreateGBKCatalog(string strInputFilePathNameList, string
 											ReportTimeStamp("[CreateGBKCatalog]", "ERROR:  .gbk Catalog Entry [" + strWorkingFilePathName + "] Failed");
 											omp_unset_lock(&lockList);
 										}
+										//  Hash the content (for later refreshes; see RefreshGBKCatalog)
+										else if (!GetGBKFileIdentity(b123GBKFile.GetData(), b123GBKFile.GetSize(), vAccessions[lCount], vVersionedAccessions[lCount], vHashes[lCount]))
+											vAccessions[lCount] = "";
 									}
 									else
 									{
@@ -811,9 +1609,16 @@ bool CBase123_Catalog::CreateGBKCatalog(string strInputFilePathNameList, string
 								ReportTimeStamp("[CreateGBKCatalog]", "ERROR:  GBK Catalog Error File [" + strErrorFilePathName + "] Write Failed");
 						}
 
-						//  Write the catalog
+						//  Write the catalog and its content manifest
 						if (WriteCatalog(strOutputCatalogFilePathName))
-							return true;
+						{
+							if (WriteGBKManifest(strOutputCatalogFilePathName, vAccessions, vVersionedAccessions, vHashes))
+								return true;
+							else
+							{
+								ReportTimeStamp("[CreateGBKCatalog]", "ERROR:  .gbk Catalog Manifest [" + strOutputCatalogFilePathName + m_chaGBKManifestExtension + "] Write Failed");
+							}
+						}
 						else
 						{
 							ReportTimeStamp("[CreateGBKCatalog]", "ERROR:  .gbk Catalog File [" + strOutputCatalogFilePathName + "] Write Failed");
@@ -847,29 +1652,355 @@ bool CBase123_Catalog::CreateGBKCatalog(string strInputFilePathNameList, string
 	return false;
 }
 
-//  Implementation (private)
-
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Sets a catalog entry features based on a .gbk catalog feature line
+//  Refreshes a BIG format genome data catalog from a new NCBI .gbk release; each .gbk file is keyed
+//      by accession and compared (version and content hash) against the previous catalog manifest,
+//      unchanged entries are copied from the previous catalog, added and changed files are cataloged,
+//      and removed accessions are dropped; the added, changed and removed accessions are written as
+//      list files (only the added and changed need downstream processing, e.g., ListProcessFNAtoFA)
 //
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [CBase123_Catalog_Entry&] eSet:  catalog entry to set
-//  [string&] strFeatures         :  .gbk catalog feature line to parse (must be lowercase)
-//                               :  returns true, if successful; else, false
+//  [string] strPreviousCatalogFilePathName:  previous catalog file path name (with its manifest; see CreateGBKCatalog)
+//  [string] strInputFilePathNameList      :  input file path name list (in NCBI .gbk format)
+//  [string] strInputFilePathNameTransform :  input file path name transform (includes string replacements, see help)
+//  [string] strOutputCatalogFilePathName  :  output catalog file path name (may be the previous catalog)
+//  [string] strAddedListFilePathName      :  output added accession list file path name
+//  [string] strChangedListFilePathName    :  output changed accession list file path name
+//  [string] strRemovedListFilePathName    :  output removed accession list file path name
+//  [string] strOutputFilePathNameTransform:  output list file path name transform [optional]
+//  [string] strErrorFilePathName          :  error file path name
+//  [int] nMaxProcs                        :  maximum processors for openMP
+//                                         :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool CBase123_Catalog::SetGBKEntryFeatures(CBase123_Catalog_Entry& eSet, string& strFeatures)
+bool CBase123_Catalog::RefreshGBKCatalog(string strPreviousCatalogFilePathName, string strInputFilePathNameList, string strInputFilePathNameTransform, string strOutputCatalogFilePathName, string strAddedListFilePathName, string strChangedListFilePathName, string strRemovedListFilePathName, string strOutputFilePathNameTransform, string strErrorFilePathName, int nMaxProcs)
 {
-	//  Locus fields
-	vector<string> vFields;
-	try
-	{
-		if (!strFeatures.empty())
-		{
-			//  Split the locus; all double spaces create empty entries, which are not pushed onto the vector
+	//  List lock
+	omp_lock_t lockList;
+	//  Previous catalog (lazy; only unchanged entries are read)
+	CBase123_Catalog b123Previous(m_lMaxSize, true);
+	//  Previous manifest accessions, versioned accessions and content hashes
+	vector<string> vPreviousAccessions;
+	vector<string> vPreviousVersionedAccessions;
+	vector<uint64_t> vPreviousHashes;
+	//  Previous manifest was read (else, entries are keyed and compared by versioned accession, only), if true
+	bool bIsManifest = false;
+	//  Previous manifest index (key, manifest index)
+	unordered_map<string, long> umPrevious;
+	//  Previous manifest entry seen in the input list, by manifest index
+	vector<char> vIsSeen;
+	//  Input list file text
+	string strInputListFileText = "";
+	//  File path name vector<string>
+	vector<string> vFilePathNames;
+	//  Accessions, versioned accessions and content hashes, by list entry
+	vector<string> vAccessions;
+	vector<string> vVersionedAccessions;
+	vector<uint64_t> vHashes;
+	//  Refresh status, by list entry
+	vector<int> vStatus;
+	//  Error list file entry text
+	vector<string> vErrorEntries;
+	//  Error file text
+	string strErrorFileText = "";
+	//  List file text (added, changed, removed)
+	string strAddedListFileText = "";
+	string strChangedListFileText = "";
+	string strRemovedListFileText = "";
+	//  Status counts
+	long lUnchanged = 0;
+	long lAdded = 0;
+	long lChanged = 0;
+	long lRemoved = 0;
+
+	try
+	{
+		//  If input file path name
+		if (!strInputFilePathNameList.empty())
+		{
+			//  If output file path names are not empty
+			if ((!strOutputCatalogFilePathName.empty()) && (!strAddedListFilePathName.empty()) && (!strChangedListFilePathName.empty()) && (!strRemovedListFilePathName.empty()))
+			{
+				//  Open the previous catalog
+				if (b123Previous.OpenCatalog(strPreviousCatalogFilePathName, nMaxProcs))
+				{
+					//  Read the previous manifest, if present
+					if (ifstream((strPreviousCatalogFilePathName + m_chaGBKManifestExtension).c_str()).good())
+						bIsManifest = ReadGBKManifest(strPreviousCatalogFilePathName, vPreviousAccessions, vPreviousVersionedAccessions, vPreviousHashes);
+
+					//  Else, fall back to the previous catalog accessions (content changes within a version are not detected)
+					if (!bIsManifest)
+					{
+						ReportTimeStamp("[RefreshGBKCatalog]", "NOTE:  Catalog Manifest [" + strPreviousCatalogFilePathName + m_chaGBKManifestExtension + "] Not Read; Comparing Versioned Accessions, Only");
+
+						vPreviousAccessions.clear();
+						vPreviousVersionedAccessions.clear();
+						vPreviousHashes.clear();
+
+						for (long lCount = 0; lCount < b123Previous.GetEntryCount(); lCount++)
+						{
+							//  Versioned accession
+							string strAccession = b123Previous.GetColumnByIndex(lCount, 0);
+
+							if (!strAccession.empty())
+							{
+								vPreviousAccessions.push_back(strAccession);
+								vPreviousVersionedAccessions.push_back(strAccession);
+								vPreviousHashes.push_back(0);
+							}
+						}
+					}
+
+					//  Index the previous entries
+					for (long lCount = 0; lCount < vPreviousAccessions.size(); lCount++)
+						umPrevious.emplace(vPreviousAccessions[lCount], lCount);
+
+					vIsSeen.resize(vPreviousAccessions.size(), 0);
+
+					//  Get .gbk list file text
+					if (GetFileText(strInputFilePathNameList, strInputListFileText))
+					{
+						//  Split list
+						SplitString(strInputListFileText, '\n', vFilePathNames);
+
+						//  If list contains entries
+						if (vFilePathNames.size() > 0)
+						{
+							//  Initialize per entry vectors
+							vAccessions.resize(vFilePathNames.size());
+							vVersionedAccessions.resize(vFilePathNames.size());
+							vHashes.resize(vFilePathNames.size(), 0);
+							vStatus.resize(vFilePathNames.size(), m_nGBKRefreshFailed);
+							vErrorEntries.resize(vFilePathNames.size());
+
+							//  Initialize time stamp lock
+							omp_init_lock(&lockList);
+
+							//  Declare omp parallel
+							#pragma omp parallel num_threads(nMaxProcs)
+							{
+								//  omp loop
+								#pragma omp for
+								for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+								{
+									//  Test max procs
+									if (lCount == 0)
+									{
+										omp_set_lock(&lockList);
+										ReportTimeStamp("[RefreshGBKCatalog]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
+										omp_unset_lock(&lockList);
+									}
+
+									if (lCount % 10000 == 0)
+									{
+										omp_set_lock(&lockList);
+										ReportTimeStamp("[RefreshGBKCatalog]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
+										omp_unset_lock(&lockList);
+									}
+
+									//  If file path name is not empty
+									if (!vFilePathNames[lCount].empty())
+									{
+										//  GBK file (mapped)
+										CBase123_Mapped_File b123GBKFile;
+										//  Working file path name
+										string strWorkingFilePathName = "";
+
+										//  If input file path name transform is not empty
+										if (!strInputFilePathNameTransform.empty())
+											strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
+										else
+											strWorkingFilePathName = vFilePathNames[lCount];
+
+										//  Map .gbk file text
+										if (b123GBKFile.OpenMappedFile(strWorkingFilePathName))
+										{
+											//  Key and hash the content
+											if (GetGBKFileIdentity(b123GBKFile.GetData(), b123GBKFile.GetSize(), vAccessions[lCount], vVersionedAccessions[lCount], vHashes[lCount]))
+											{
+												//  Previous entry
+												unordered_map<string, long>::const_iterator itPrevious = umPrevious.find(bIsManifest ? vAccessions[lCount] : vVersionedAccessions[lCount]);
+
+												if (itPrevious == umPrevious.end())
+													vStatus[lCount] = m_nGBKRefreshAdded;
+												else
+												{
+													//  Previous entry (copy)
+													CBase123_Catalog_Entry eCopy;
+
+													vIsSeen[itPrevious->second] = 1;
+
+													//  Unchanged (same version and content), if the previous entry is copied
+													if ((vPreviousVersionedAccessions[itPrevious->second] == vVersionedAccessions[lCount]) && ((!bIsManifest) || (vPreviousHashes[itPrevious->second] == vHashes[lCount])) && (b123Previous.GetEntryByAccession(vPreviousVersionedAccessions[itPrevious->second], eCopy)) && (SetEntryAtIndex(eCopy, lCount)))
+														vStatus[lCount] = m_nGBKRefreshUnchanged;
+													else
+														vStatus[lCount] = m_nGBKRefreshChanged;
+												}
+
+												//  Catalog the added and changed data
+												if ((vStatus[lCount] != m_nGBKRefreshUnchanged) && (!CatalogGBKFile(b123GBKFile.GetData(), b123GBKFile.GetSize(), lCount)))
+												{
+													vStatus[lCount] = m_nGBKRefreshFailed;
+													vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Failed\n";
+
+													omp_set_lock(&lockList);
+													ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  .gbk Catalog Entry [" + strWorkingFilePathName + "] Failed");
+													omp_unset_lock(&lockList);
+												}
+											}
+											else
+											{
+												vErrorEntries[lCount] = strWorkingFilePathName + "~Accession Not Found\n";
+
+												omp_set_lock(&lockList);
+												ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  .gbk Input File [" + strWorkingFilePathName + "] Accession Not Found");
+												omp_unset_lock(&lockList);
+											}
+										}
+										else
+										{
+											vErrorEntries[lCount] = strWorkingFilePathName + "~Open Failed\n";
+
+											omp_set_lock(&lockList);
+											ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  .gbk Input File [" + strWorkingFilePathName + "] Open Failed");
+											omp_unset_lock(&lockList);
+										}
+									}
+								}
+							}
+
+							//  Destroy time stamp lock
+							omp_destroy_lock(&lockList);
+
+							//  Release the previous catalog (the output catalog may replace it)
+							b123Previous.CloseCatalog();
+
+							//  Fill the added and changed lists (list order); failed entries are left out of the manifest
+							for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+							{
+								//  Listed accession
+								string strListed = vVersionedAccessions[lCount];
+
+								if (!strOutputFilePathNameTransform.empty())
+									strListed = TransformFilePathName(strListed + ".", strOutputFilePathNameTransform, "fa");
+
+								if (vStatus[lCount] == m_nGBKRefreshUnchanged)
+									lUnchanged++;
+								else if (vStatus[lCount] == m_nGBKRefreshAdded)
+								{
+									strAddedListFileText += strListed + "\n";
+									lAdded++;
+								}
+								else if (vStatus[lCount] == m_nGBKRefreshChanged)
+								{
+									strChangedListFileText += strListed + "\n";
+									lChanged++;
+								}
+								else
+									vAccessions[lCount] = "";
+
+								if (!vErrorEntries[lCount].empty())
+									strErrorFileText += vErrorEntries[lCount];
+							}
+
+							//  Fill the removed list (manifest order)
+							for (long lCount = 0; lCount < vPreviousAccessions.size(); lCount++)
+							{
+								if (!vIsSeen[lCount])
+								{
+									if (!strOutputFilePathNameTransform.empty())
+										strRemovedListFileText += TransformFilePathName(vPreviousVersionedAccessions[lCount] + ".", strOutputFilePathNameTransform, "fa") + "\n";
+									else
+										strRemovedListFileText += vPreviousVersionedAccessions[lCount] + "\n";
+
+									lRemoved++;
+								}
+							}
+
+							ReportTimeStamp("[RefreshGBKCatalog]", "NOTE:  Unchanged = " + ConvertLongToString(lUnchanged) + ", Added = " + ConvertLongToString(lAdded) + ", Changed = " + ConvertLongToString(lChanged) + ", Removed = " + ConvertLongToString(lRemoved));
+
+							//  Write error file
+							if (!strErrorFilePathName.empty())
+							{
+								if (!WriteFileText(strErrorFilePathName, strErrorFileText))
+									ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  GBK Catalog Error File [" + strErrorFilePathName + "] Write Failed");
+							}
+
+							//  Write the catalog and its content manifest
+							if ((WriteCatalog(strOutputCatalogFilePathName)) && (WriteGBKManifest(strOutputCatalogFilePathName, vAccessions, vVersionedAccessions, vHashes)))
+							{
+								//  Write the lists
+								if ((WriteFileText(strAddedListFilePathName, strAddedListFileText)) && (WriteFileText(strChangedListFilePathName, strChangedListFileText)) && (WriteFileText(strRemovedListFilePathName, strRemovedListFileText)))
+									return true;
+								else
+								{
+									ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  Added/Changed/Removed List File Write Failed");
+								}
+							}
+							else
+							{
+								ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  .gbk Catalog File [" + strOutputCatalogFilePathName + "] Write Failed");
+							}
+						}
+						else
+						{
+							ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  .gbk File Path Name List Container is Not Set");
+						}
+					}
+					else
+					{
+						ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  .gbk List File Text Open Failed");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  Previous Catalog File [" + strPreviousCatalogFilePathName + "] Open Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  .gbk Catalog or List File Path Name is Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[RefreshGBKCatalog]", "ERROR:  .gbk Input File Path Name List is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [RefreshGBKCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+//  Implementation (private)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets a catalog entry features based on a .gbk catalog feature line
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [CBase123_Catalog_Entry&] eSet:  catalog entry to set
+//  [string&] strFeatures         :  .gbk catalog feature line to parse (must be lowercase)
+//                               :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::SetGBKEntryFeatures(CBase123_Catalog_Entry& eSet, string& strFeatures)
+{
+	//  Locus fields
+	vector<string> vFields;
+	try
+	{
+		if (!strFeatures.empty())
+		{
+			//  Split the locus; all double spaces create empty entries, which are not pushed onto the vector
 			SplitString(strFeatures, ' ', vFields);
 
 			//  Parse and set features, where present
@@ -994,6 +2125,8 @@ bool CBase123_Catalog::CatalogDatFile(string& strDatFileText, string& strNADatFi
 	vector<string> vCatalogEntries;
 	//  Entry CDSs, vector<string>
 	vector<string> vCDSs;
+	//  Entry CDS index (accession, CDS line index); the first line of an accession wins
+	unordered_map<string, long> umCDSIndex;
 	//  Error file entries
 	vector<string> vErrorEntries;
 	//  Error file text
@@ -1023,6 +2156,11 @@ bool CBase123_Catalog::CatalogDatFile(string& strDatFileText, string& strNADatFi
 					//  If entries is set
 					if (vCatalogEntries.size() > 0)
 					{
+						//  Index CDS lines by accession (the first column), once, for the entry loop
+						umCDSIndex.reserve(vCDSs.size());
+						for (long lCountCDSs = 0; lCountCDSs < (long)vCDSs.size(); lCountCDSs++)
+							umCDSIndex.emplace(vCDSs[lCountCDSs].substr(0, vCDSs[lCountCDSs].find('\t')), lCountCDSs);
+
 						//  Initialize errof file vector<string>
 						vErrorEntries.resize(vCatalogEntries.size());
 
@@ -1112,98 +2250,94 @@ bool CBase123_Catalog::CatalogDatFile(string& strDatFileText, string& strNADatFi
 									eAdd.SetStrandednessType("l");
 									eAdd.SetViralGroup("v");
 
-									//  Search for and process CDSs for this accession/entry
-									for (int nCountCDSs = 0; nCountCDSs < vCDSs.size(); nCountCDSs++)
+									//  CDS line for this accession/entry
+									unordered_map<string, long>::const_iterator itCDSs = umCDSIndex.find(strAccession);
+
+									//  Process CDSs for this accession/entry
+									if (itCDSs != umCDSIndex.end())
 									{
-										//  Parse CDSs for this accession
-										if (vCDSs[nCountCDSs].substr(0, strAccession.length()) == strAccession)
-										{
-											//AB000728	BAA75881	gb|AB000728:4-1128	BAA75882	(gb|AB000728:4-731, 960)	BAA75883	gb|AB000728:709-1128
-											//  CDS parts vector
-											vector<string> vCDSParts;
+										//AB000728	BAA75881	gb|AB000728:4-1128	BAA75882	(gb|AB000728:4-731, 960)	BAA75883	gb|AB000728:709-1128
+										//  CDS parts vector
+										vector<string> vCDSParts;
 
-											//  Spit the CDS into parts
-											SplitString(vCDSs[nCountCDSs], '\t', vCDSParts);
+										//  Spit the CDS into parts
+										SplitString(vCDSs[itCDSs->second], '\t', vCDSParts);
 
-											//  If there is at least one CDS, first part is the accession
-											if (vCDSParts.size() >= 3)
+										//  If there is at least one CDS, first part is the accession
+										if (vCDSParts.size() >= 3)
+										{
+											//  Iterate through CDS part(s), each part should be in a pair
+											for (int nCountPart = 1; nCountPart < vCDSParts.size() - 1; nCountPart += 2)
 											{
-												//  Iterate through CDS part(s), each part should be in a pair
-												for (int nCountPart = 1; nCountPart < vCDSParts.size() - 1; nCountPart += 2)
-												{
-													//  CDS start/stop parts
-													vector<string> vCDSStartStop;
+												//  CDS start/stop parts
+												vector<string> vCDSStartStop;
 
-													//  CDS to add
-													string strCDSNameID = "";
-													long lCDSStart = 0;
-													long lCDSStop = 0;
-													string strCDSCompleteness = "";
+												//  CDS to add
+												string strCDSNameID = "";
+												long lCDSStart = 0;
+												long lCDSStop = 0;
+												string strCDSCompleteness = "";
 
-													//  Name/ID
-													strCDSNameID = vCDSParts[nCountPart];
+												//  Name/ID
+												strCDSNameID = vCDSParts[nCountPart];
 
-													//  Split start/stop parts
-													SplitString(vCDSParts[nCountPart + 1], ':', vCDSStartStop);
+												//  Split start/stop parts
+												SplitString(vCDSParts[nCountPart + 1], ':', vCDSStartStop);
 
-													//  If start/stop part is properly Formatted
-													if (vCDSStartStop.size() == 2)
+												//  If start/stop part is properly Formatted
+												if (vCDSStartStop.size() == 2)
+												{
+													//  starts and stops, section(s)
+													vector<string> vStartsStopsSections;
+
+													//  Completeness
+													strCDSCompleteness = vCDSStartStop[1];
+
+													//  Split part into numeric section(s)
+													SplitString(vCDSStartStop[1], ',', vStartsStopsSections);
+
+													//  Iterate sections, convert to numerics
+													for (int nCountSections = 0; nCountSections < vStartsStopsSections.size(); nCountSections++)
 													{
-														//  starts and stops, section(s)
-														vector<string> vStartsStopsSections;
+														//  starts and stops, pairwise
+														vector<long> vStartsStops;
 
-														//  Completeness
-														strCDSCompleteness = vCDSStartStop[1];
+														//  Parse starts and stops into numeric pairs
+														ParseStartsStops(vStartsStopsSections[nCountSections], vStartsStops);
 
-														//  Split part into numeric section(s)
-														SplitString(vCDSStartStop[1], ',', vStartsStopsSections);
+														//  Single value, only
+														if (vStartsStops.size() == 1)
+														{
+															//  Set start/stop
+															lCDSStart = vStartsStops[0];
+															lCDSStop = vStartsStops[0];
 
-														//  Iterate sections, convert to numerics
-														for (int nCountSections = 0; nCountSections < vStartsStopsSections.size(); nCountSections++)
+															//  Add CDS to entry
+															if ((!strCDSNameID.empty()) && (lCDSStart > 0) && (lCDSStop > 0))
+																eAdd.CDSAdd(strCDSNameID, lCDSStart, lCDSStop, strCDSCompleteness);
+														}
+														//  Paired value
+														if (vStartsStops.size() == 2)
 														{
-															//  starts and stops, pairwise
-															vector<long> vStartsStops;
-
-															//  Parse starts and stops into numeric pairs
-															ParseStartsStops(vStartsStopsSections[nCountSections], vStartsStops);
-
-															//  Single value, only
-															if (vStartsStops.size() == 1)
-															{
-																//  Set start/stop
-																lCDSStart = vStartsStops[0];
-																lCDSStop = vStartsStops[0];
-
-																//  Add CDS to entry
-																if ((!strCDSNameID.empty()) && (lCDSStart > 0) && (lCDSStop > 0))
-																	eAdd.CDSAdd(strCDSNameID, lCDSStart, lCDSStop, strCDSCompleteness);
-															}
-															//  Paired value
-															if (vStartsStops.size() == 2)
-															{
-																//  Set start/stop
-																lCDSStart = vStartsStops[0];
-																lCDSStop = vStartsStops[1];
-
-																//  Add CDS to entry
-																if ((!strCDSNameID.empty()) && (lCDSStart > 0) && (lCDSStop > 0))
-																	eAdd.CDSAdd(strCDSNameID, lCDSStart, lCDSStop, strCDSCompleteness);
-															}
+															//  Set start/stop
+															lCDSStart = vStartsStops[0];
+															lCDSStop = vStartsStops[1];
+
+															//  Add CDS to entry
+															if ((!strCDSNameID.empty()) && (lCDSStart > 0) && (lCDSStop > 0))
+																eAdd.CDSAdd(strCDSNameID, lCDSStart, lCDSStop, strCDSCompleteness);
 														}
 													}
-													else
-													{
-														vErrorEntries[lCountEntries] = "Entry [" + ConvertLongToString(lCountEntries) + "] [" + strAccession + "]~CDS Format Error~" + vCDSParts[nCountPart + 1] + "\n";
+												}
+												else
+												{
+													vErrorEntries[lCountEntries] = "Entry [" + ConvertLongToString(lCountEntries) + "] [" + strAccession + "]~CDS Format Error~" + vCDSParts[nCountPart + 1] + "\n";
 
-														omp_set_lock(&lockList);
-														ReportTimeStamp("[CatalogDatFile]", "ERROR:  _na.dat Entry [" + vCatalogEntries[lCountEntries] + "] CDS Start/Stop Part [" + vCDSParts[nCountPart + 1] + "] is Not Properly Formatted");
-														omp_unset_lock(&lockList);
-													}
+													omp_set_lock(&lockList);
+													ReportTimeStamp("[CatalogDatFile]", "ERROR:  _na.dat Entry [" + vCatalogEntries[lCountEntries] + "] CDS Start/Stop Part [" + vCDSParts[nCountPart + 1] + "] is Not Properly Formatted");
+													omp_unset_lock(&lockList);
 												}
 											}
-
-											//  End search
-											break;
 										}
 									}
 
@@ -1275,25 +2409,29 @@ bool CBase123_Catalog::CatalogDatFile(string& strDatFileText, string& strNADatFi
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Catalogs a GBK file format
+//  Catalogs a GBK file format; the file text is scanned in place (lines are views into the text, only
+//      the feature values set on the entry are copied) and the ORIGIN (sequence) block is not read
 //
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string&] strGBKFileText:  file text to catalog
-//  [long] lIndex           :  index of the entry to set
-//                         :  returns true, if successful; else, false
+//  [const char*] chpGBKFileText:  file text to catalog
+//  [uint64_t] ullGBKFileLength  :  file text length, bytes
+//  [long] lIndex                :  index of the entry to set
+//                               :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
+bool CBase123_Catalog::CatalogGBKFile(const char* chpGBKFileText, uint64_t ullGBKFileLength, long lIndex)
 {
-	// File text lines vector
-	vector<string> vLines;
+	//  File text line (view into the file text)
+	structGBKView stLine;
+	//  Next file text line (view into the file text)
+	structGBKView stNextLine;
 	//  Entry to catalog
 	CBase123_Catalog_Entry eAdd;
 	//  Name/id
 	string strNameID = "";
-	//  The lower-case line
+	//  The lower-case line (or feature value)
 	string strLCLine = "";
 	//  CDSs
 	vector<structCDS> vCDSs;
@@ -1303,34 +2441,39 @@ bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
 	bool bIsCDS = false;
 	//  Virus, if true
 	bool bIsVirus = false;
+	//  Origin (end catalog), if true
+	bool bIsOrigin = false;
 
 	try
 	{
 		//  If the gbk file text is not empty
-		if (!strGBKFileText.empty())
+		if ((chpGBKFileText != NULL) && (ullGBKFileLength > 0))
 		{
-			//  Split file text
-			SplitString(strGBKFileText, '\n', vLines);
+			//  File text scanner (the sequence block is skipped)
+			CBase123_GBK_Parser b123Parser(chpGBKFileText, (size_t)ullGBKFileLength, false);
 
 			//  If lines exist
-			if (vLines.size() > 0)
+			if (b123Parser.GetNextLine(stLine))
 			{
 				//  Iterate through lines, add entry to catalog
-				for (int nCount = 0; nCount < vLines.size(); nCount++)
+				do
 				{
-					//  One-time line conversion to lower-case
-					strLCLine = ConvertStringToLowerCase(vLines[nCount]);
+					//  End catalog, after this line
+					bIsOrigin = CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Origin);
 
 					//  LOCUS       NC_010314               1090 bp ss-DNA     circular VRL 20-OCT-2015
-					if (strLCLine.substr(0, m_strGBKFeature_Locus.length()) == m_strGBKFeature_Locus)
+					if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Locus))
 					{
 						//  Locus fields
 						vector<string> vFields;
 						//  Sequence length
 						long lLength = 0;
 
+						//  One-time line conversion to lower-case
+						strLCLine = CBase123_GBK_Parser::GetLowerCaseText(stLine, 0, string::npos);
+
 						//  Split the locus; all double spaces create empty entries, which are not pushed onto the vector
-						SplitString(vLines[nCount], ' ', vFields);
+						SplitString(CBase123_GBK_Parser::GetText(stLine, 0, string::npos), ' ', vFields);
 
 						//  If the fields vector is not empty
 						if (vFields.size() >= 3)
@@ -1370,30 +2513,23 @@ bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
 					}
 
 					//  Process features, definition and organism, and set name/id
-					if ((strLCLine.substr(0, m_strGBKFeature_Definition.length()) == m_strGBKFeature_Definition) || (strLCLine.substr(0, m_strGBKFeature_Organism.length()) == m_strGBKFeature_Organism))
+					if ((CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Definition)) || (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Organism)))
 					{
-						//  Next line
-						string strNextLine = "";
 						//  First name/id line, if true
 						bool bFirstNameIDLine = true;
 						//  Organism line, if true
 						bool bIsOrganismLine = false;
 
-						if (strLCLine.substr(0, m_strGBKFeature_Organism.length()) == m_strGBKFeature_Organism)
+						if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Organism))
 							bIsOrganismLine = true;
 
 						//  Set initial name (all entry features have same length)
-						strNameID = vLines[nCount].substr(m_strGBKFeature_Definition.length(), vLines[nCount].length() - (m_strGBKFeature_Definition.length()));
+						strNameID = CBase123_GBK_Parser::GetText(stLine, m_strGBKFeature_Definition.length(), string::npos);
 
 						//  Concatenate organism line(s) (definition and organism lines are the same length)
-						strNextLine = vLines[nCount + 1];
-						while (strNextLine.substr(0, 1) == " ")
+						b123Parser.PeekNextLine(stNextLine);
+						while ((stNextLine.stLength > 0) && (stNextLine.chpText[0] == ' '))
 						{
-							//  If first  name/id line
-							//  Increment count due to initial + 1
-							if (bFirstNameIDLine)
-								nCount++;
-
 							//  Organism lines, only
 							if (bIsOrganismLine)
 							{
@@ -1412,17 +2548,20 @@ bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
 								strNameID += " ";
 
 							//  Concatenate name/id
-							strNameID += strNextLine.substr(12, strNextLine.length() - 12);
+							strNameID += CBase123_GBK_Parser::GetText(stNextLine, 12, string::npos);
 
-							//  Increment count
-							nCount++;
-							//  Get next line
-							strNextLine = vLines[nCount];
+							//  Next line
+							b123Parser.GetNextLine(stNextLine);
+							b123Parser.PeekNextLine(stNextLine);
 
 							//  Reset first flag
 							bFirstNameIDLine = false;
 						}
 
+						//  The line following concatenated lines is passed over
+						if (!bFirstNameIDLine)
+							b123Parser.GetNextLine(stNextLine);
+
 						//  Append closing square bracket
 						if ((bIsOrganismLine) && (!bFirstNameIDLine))
 							strNameID += "]";
@@ -1451,61 +2590,57 @@ bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
 							eAdd.SetTranscriptStatus("y");
 					}
 					//  Process features, version, and set versioned accession
-					else if (strLCLine.substr(0, m_strGBKFeature_Version.length()) == m_strGBKFeature_Version)
+					else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Version))
 					{
 						//  Versioned accession
-						string strVersionLine = "";
 						vector<string> vVersion;
 
-						//  Set feature, mask feature and cut final double-quote [...length() + 1]
-						strVersionLine = vLines[nCount].substr(m_strGBKFeature_Version.length(), vLines[nCount].length() - (m_strGBKFeature_Version.length()));
-
 						//  In case other features are set with this line (e.g., GI#), split and set only first entry
-						SplitString(strVersionLine, ' ', vVersion);
+						SplitString(CBase123_GBK_Parser::GetText(stLine, m_strGBKFeature_Version.length(), string::npos), ' ', vVersion);
 
 						//  If vector contains at least one entry
 						if (vVersion.size() >= 1)
 							eAdd.SetAccession(ReplaceInString(vVersion[0], ".", "_", false));
 					}
 					//  Process features, host
-					else if (strLCLine.substr(0, m_strGBKFeature_Host.length()) == m_strGBKFeature_Host)
+					else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Host))
 					{
 						//  Set feature, mask feature and cut final double-quote [...length() + 1]
-						eAdd.SetHost(strLCLine.substr(m_strGBKFeature_Host.length(), strLCLine.length() - (m_strGBKFeature_Host.length() + 1)));
+						eAdd.SetHost(CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_Host.length(), stLine.stLength - (m_strGBKFeature_Host.length() + 1)));
 					}
 					//  Process features, collection date (superior to locus date)
-					else if (strLCLine.substr(0, m_strGBKFeature_CollectionDate.length()) == m_strGBKFeature_CollectionDate)
+					else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_CollectionDate))
 					{
 						//  Set feature, mask feature and cut final double-quote [...length() + 1]
-						eAdd.SetDate(strLCLine.substr(m_strGBKFeature_CollectionDate.length(), strLCLine.length() - (m_strGBKFeature_CollectionDate.length() + 1)));
+						eAdd.SetDate(CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_CollectionDate.length(), stLine.stLength - (m_strGBKFeature_CollectionDate.length() + 1)));
 					}
 					//  Process features, chromosome/segment
-					else if (strLCLine.substr(0, m_strGBKFeature_Chromosome.length()) == m_strGBKFeature_Chromosome)
+					else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Chromosome))
 					{
 						//  Set feature, mask feature and cut final double-quote [...length() + 1] (both are same length)
-						eAdd.SetChromosomeSegment(strLCLine.substr(m_strGBKFeature_Chromosome.length(), strLCLine.length() - (m_strGBKFeature_Chromosome.length() + 1)));
+						eAdd.SetChromosomeSegment(CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_Chromosome.length(), stLine.stLength - (m_strGBKFeature_Chromosome.length() + 1)));
 					}
 					//  Process features, chromosome/segment
-					else if (strLCLine.substr(0, m_strGBKFeature_Segment.length()) == m_strGBKFeature_Segment)
+					else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Segment))
 					{
 						//  Set feature, mask feature and cut final double-quote [...length() + 1] (both are same length)
-						eAdd.SetChromosomeSegment(strLCLine.substr(m_strGBKFeature_Segment.length(), strLCLine.length() - (m_strGBKFeature_Segment.length() + 1)));
+						eAdd.SetChromosomeSegment(CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_Segment.length(), stLine.stLength - (m_strGBKFeature_Segment.length() + 1)));
 					}
 					//  Process features, country (superior to locus locale)
-					else if (strLCLine.substr(0, m_strGBKFeature_Country.length()) == m_strGBKFeature_Country)
+					else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Country))
 					{
 						//  Set feature, mask feature and cut final double-quote [...length() + 1]
-						eAdd.SetLocale(strLCLine.substr(m_strGBKFeature_Country.length(), strLCLine.length() - (m_strGBKFeature_Country.length() + 1)));
+						eAdd.SetLocale(CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_Country.length(), stLine.stLength - (m_strGBKFeature_Country.length() + 1)));
 					}
 					//  Process CDS features
-					else if (strLCLine.substr(0, m_strGBKFeature_CDS.length()) == m_strGBKFeature_CDS)
+					else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_CDS))
 						bIsCDS = true;
 
 					//  CDS entry
 					if (bIsCDS)
 					{
 						//  Process features, stop and add previous CDS, start new CDS
-						if (strLCLine.substr(0, m_strGBKFeature_CDS.length()) == m_strGBKFeature_CDS)
+						if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_CDS))
 						{
 							//  Completeness
 							string strCompleteness = "";
@@ -1515,7 +2650,7 @@ bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
 							vector<string> vCDSJoins;
 
 							//  Set completeness
-							strCompleteness = strLCLine.substr(m_strGBKFeature_CDS.length(), strLCLine.length() - m_strGBKFeature_CDS.length());
+							strCompleteness = CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_CDS.length(), string::npos);
 
 							//  Clear join characters
 							if (strCompleteness.find("join") != string::npos)
@@ -1539,8 +2674,7 @@ bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
 							SplitString(strCompleteness, ',', vCDSJoins);
 
 							//  Set completeness
-							strCompleteness = vLines[nCount].substr(m_strGBKFeature_CDS.length(), vLines[nCount].length() - m_strGBKFeature_CDS.length());
-
+							strCompleteness = CBase123_GBK_Parser::GetText(stLine, m_strGBKFeature_CDS.length(), string::npos);
 							//  Iterate the splices/joins, if any
 							for (int nCountJoins = 0; nCountJoins < vCDSJoins.size(); nCountJoins++)
 							{
@@ -1573,57 +2707,65 @@ bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
 							vCDSJoins.clear();
 						}
 						//  Process features, CDS gene (name/id)
-						else if (strLCLine.substr(0, m_strGBKFeature_Gene.length()) == m_strGBKFeature_Gene)
+						else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Gene))
 						{
 							if (strCDSNameID.empty())
-								strCDSNameID = "Gene:  " + strLCLine.substr(m_strGBKFeature_Gene.length(), strLCLine.length() - (m_strGBKFeature_Gene.length() + 1));
+								strCDSNameID = "Gene:  " + CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_Gene.length(), stLine.stLength - (m_strGBKFeature_Gene.length() + 1));
 							else
-								strCDSNameID += " [Gene:  " + strLCLine.substr(m_strGBKFeature_Gene.length(), strLCLine.length() - (m_strGBKFeature_Gene.length() + 1)) + "]";
+								strCDSNameID += " [Gene:  " + CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_Gene.length(), stLine.stLength - (m_strGBKFeature_Gene.length() + 1)) + "]";
 						}
 						//  Process features, CDS product (name/id)
-						else if (strLCLine.substr(0, m_strGBKFeature_Product.length()) == m_strGBKFeature_Product)
+						else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Product))
 						{
-							//  Next line
-							string strNextLine = "";
+							//  Multi-line product, if true
+							bool bIsMultiLine = false;
 
-							strNextLine = ConvertStringToLowerCase(vLines[nCount + 1]);
+							b123Parser.PeekNextLine(stNextLine);
 
-							if (strNextLine.substr(0, m_strGBKFeature_NextFeature.length()) == m_strGBKFeature_NextFeature)
-								strLCLine = strLCLine.substr(m_strGBKFeature_Product.length(), strLCLine.length() - (m_strGBKFeature_Product.length() + 1));
+							if (CBase123_GBK_Parser::GetHasPrefix(stNextLine, m_strGBKFeature_NextFeature))
+								strLCLine = CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_Product.length(), stLine.stLength - (m_strGBKFeature_Product.length() + 1));
 							else
 							{
-								nCount++;
-								strLCLine = strLCLine.substr(m_strGBKFeature_Product.length(), strLCLine.length() - (m_strGBKFeature_Product.length()));
+								bIsMultiLine = true;
+								strLCLine = CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_Product.length(), string::npos);
 							}
 
-							while (strNextLine.substr(0, m_strGBKFeature_NextFeature.length()) != m_strGBKFeature_NextFeature)
+							while ((stNextLine.stLength > 0) && (!CBase123_GBK_Parser::GetHasPrefix(stNextLine, m_strGBKFeature_NextFeature)))
 							{
-								string strHoldLine = strNextLine;
+								//  Held line
+								structGBKView stHoldLine;
 
-								nCount++;
-								strNextLine = ConvertStringToLowerCase(vLines[nCount]);
+								b123Parser.GetNextLine(stHoldLine);
+								b123Parser.PeekNextLine(stNextLine);
 
-								if (strNextLine.substr(0, m_strGBKFeature_NextFeature.length()) == m_strGBKFeature_NextFeature)
-									strLCLine += " " + strHoldLine.substr(21, strHoldLine.length() - 22);
+								if (CBase123_GBK_Parser::GetHasPrefix(stNextLine, m_strGBKFeature_NextFeature))
+									strLCLine += " " + CBase123_GBK_Parser::GetLowerCaseText(stHoldLine, 21, stHoldLine.stLength - 22);
 								else
-									strLCLine += " " + strHoldLine.substr(21, strHoldLine.length() - 21);
+									strLCLine += " " + CBase123_GBK_Parser::GetLowerCaseText(stHoldLine, 21, string::npos);
 							}
 
+							//  The feature following a multi-line product is passed over
+							if (bIsMultiLine)
+								b123Parser.GetNextLine(stNextLine);
+
 							if (strCDSNameID.empty())
 								strCDSNameID = "Product:  " + strLCLine;
 							else
 								strCDSNameID += " [Product:  " + strLCLine + "]";
+
+							//  End catalog, on the product (not the line)
+							bIsOrigin = (strLCLine.compare(0, m_strGBKFeature_Origin.length(), m_strGBKFeature_Origin) == 0);
 						}
 						//  Process features, CDS gene id (name/id)
-						else if (strLCLine.substr(0, m_strGBKFeature_GeneID.length()) == m_strGBKFeature_GeneID)
+						else if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_GeneID))
 						{
 							if (strCDSNameID.empty())
-								strCDSNameID = "GeneID:  " + strLCLine.substr(m_strGBKFeature_GeneID.length(), strLCLine.length() - (m_strGBKFeature_GeneID.length() + 1));
+								strCDSNameID = "GeneID:  " + CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_GeneID.length(), stLine.stLength - (m_strGBKFeature_GeneID.length() + 1));
 							else
-								strCDSNameID += " [GeneID:  " + strLCLine.substr(m_strGBKFeature_GeneID.length(), strLCLine.length() - (m_strGBKFeature_GeneID.length() + 1)) + "]";
+								strCDSNameID += " [GeneID:  " + CBase123_GBK_Parser::GetLowerCaseText(stLine, m_strGBKFeature_GeneID.length(), stLine.stLength - (m_strGBKFeature_GeneID.length() + 1)) + "]";
 						}
 						//  Process features, translation, add the current CDS
-						else if ((strLCLine.substr(0, m_strGBKFeature_Translation.length()) == m_strGBKFeature_Translation) || (strLCLine.substr(0, m_strGBKFeature_Origin.length()) == m_strGBKFeature_Origin))
+						else if ((CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Translation)) || (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Origin)))
 						{
 							//  If the previous CDS is Not null, add it
 							if (!strCDSNameID.empty())
@@ -1652,11 +2794,10 @@ bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
 					}
 
 					//  End catalog
-					if (strLCLine.substr(0, m_strGBKFeature_Origin.length()) == m_strGBKFeature_Origin)
+					if (bIsOrigin)
 						break;
-
-					strLCLine = "";
 				}
+				while (b123Parser.GetNextLine(stLine));
 
 				//  If virus, attempt to set viral group
 				if (bIsVirus)
@@ -1738,79 +2879,83 @@ bool CBase123_Catalog::CatalogGBKFile(string& strGBKFileText, long lIndex)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Parses a .dat CDS starts/stops string into numerics
+//  Gets the identity of a GBK file:  its accession (LOCUS), versioned accession (VERSION, as set by
+//      CatalogGBKFile) and a 64-bit FNV-1a hash of its content (every non-empty line, header,
+//      features and sequence, without line terminators, so \n and \r\n files hash alike)
 //
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string&] strParts          :  starts/stops string to parse
-//  [vector<long>&] vStartsStops:  starts/stops vector<long> to return
-//                             :  returns true, if successful; else, false
+//  [const char*] chpGBKFileText   :  file text
+//  [uint64_t] ullGBKFileLength     :  file text length, bytes
+//  [string&] strAccession          :  the accession
+//  [string&] strVersionedAccession :  the versioned accession (the accession, if no VERSION)
+//  [uint64_t&] ullHash             :  the content hash
+//                                  :  returns true, if an accession was found; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool CBase123_Catalog::ParseStartsStops(string& strParts, vector<long>& vStartsStops)
+bool CBase123_Catalog::GetGBKFileIdentity(const char* chpGBKFileText, uint64_t ullGBKFileLength, string& strAccession, string& strVersionedAccession, uint64_t& ullHash)
 {
-	//  Numeric, string representation
-	string strNumeric = "";
-	//  Numeric, long representation
-	long lNumeric = 0;
-	//  On numeric, if true; else, on string
-	bool bOnNumeric = false;
+	//  File text line (view into the file text)
+	structGBKView stLine;
+	//  Line fields
+	vector<string> vFields;
 
 	try
 	{
-		//  Clear vector
-		vStartsStops.clear();
+		strAccession = "";
+		strVersionedAccession = "";
+		ullHash = m_ullGBKHashBasis;
 
-		//  If parts is not empty
-		if (!strParts.empty())
+		//  If the gbk file text is not empty
+		if ((chpGBKFileText != NULL) && (ullGBKFileLength > 0))
 		{
-			//  Iterate through parts string, parse out numbers by pairs
-			for (int nCount = 0; nCount <= strParts.length(); nCount++)
+			//  File text scanner (the sequence block is read)
+			CBase123_GBK_Parser b123Parser(chpGBKFileText, (size_t)ullGBKFileLength, true);
+
+			while (b123Parser.GetNextLine(stLine))
 			{
-				//  On numeric
-				if ((nCount < strParts.length()) && 
-					((strParts[nCount] == '0') || (strParts[nCount] == '1') || (strParts[nCount] == '2') || (strParts[nCount] == '3') || (strParts[nCount] == '4') ||
-					(strParts[nCount] == '5') || (strParts[nCount] == '6') || (strParts[nCount] == '7') || (strParts[nCount] == '8') || (strParts[nCount] == '9')))
+				//  Hash the line, then a line terminator
+				for (size_t stChar = 0; stChar < stLine.stLength; stChar++)
 				{
-					bOnNumeric = true;
+					ullHash ^= (unsigned char)stLine.chpText[stChar];
+					ullHash *= m_ullGBKHashPrime;
 				}
-				//  Off numeric
-				else
-				{
-					//  If the numeric string is not empty
-					if (!strNumeric.empty())
-					{
-						//  Convert numeric string to long
-						stringstream(strNumeric) >> lNumeric;
 
-						//  Add the numeric to the vector<long>
-						vStartsStops.push_back(lNumeric);
-					}
+				ullHash ^= (unsigned char)'\n';
+				ullHash *= m_ullGBKHashPrime;
 
-					//  Clear numeric
-					strNumeric = "";
-					lNumeric = 0;
+				//  LOCUS       NC_010314               1090 bp ss-DNA     circular VRL 20-OCT-2015
+				if ((strAccession.empty()) && (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Locus)))
+				{
+					SplitString(CBase123_GBK_Parser::GetText(stLine, 0, string::npos), ' ', vFields);
 
-					//  Off numeric
-					bOnNumeric = false;
+					if (vFields.size() >= 2)
+						strAccession = vFields[1];
 				}
+				//  VERSION     NC_010314.1  GI:170783574
+				else if ((strVersionedAccession.empty()) && (CBase123_GBK_Parser::GetHasPrefix(stLine, m_strGBKFeature_Version)))
+				{
+					SplitString(CBase123_GBK_Parser::GetText(stLine, m_strGBKFeature_Version.length(), string::npos), ' ', vFields);
 
-				//  Concatenate numeric
-				if (bOnNumeric)
-					strNumeric += strParts[nCount];
+					if (vFields.size() >= 1)
+						strVersionedAccession = ReplaceInString(vFields[0], ".", "_", false);
+				}
 			}
 
-			return true;
+			if (strVersionedAccession.empty())
+				strVersionedAccession = strAccession;
+
+			return (!strAccession.empty());
 		}
 		else
 		{
-			ReportTimeStamp("[ParseStartsStops]", "ERROR:  CDS Starts/Stops is Empty");
+			ReportTimeStamp("[GetGBKFileIdentity]", "ERROR:  GBK File Text is Empty");
 		}
 	}
 	catch (exception ex)
 	{
-		cout << "ERROR [ParseStartsStops] Exception Code:  " << ex.what() << "\n";
+		cout << "ERROR [GetGBKFileIdentity] Exception Code:  " << ex.what() << "\n";
 	}
 
 	return false;
@@ -1818,25 +2963,226 @@ bool CBase123_Catalog::ParseStartsStops(string& strParts, vector<long>& vStartsS
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Gets the entries header header
+//  Reads a GBK catalog content manifest (catalog file path name + manifest extension); one line per
+//      entry:  accession~versioned accession~content hash (16 hexadecimal digits)
 //
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  :  returns the entries header string
+//  [string] strCatalogFilePathName        :  catalog file path name
+//  [vector<string>&] vAccessions          :  the accessions
+//  [vector<string>&] vVersionedAccessions :  the versioned accessions
+//  [vector<uint64_t>&] vHashes            :  the content hashes
+//                                         :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-string CBase123_Catalog::GetEntryHeader()
+bool CBase123_Catalog::ReadGBKManifest(string strCatalogFilePathName, vector<string>& vAccessions, vector<string>& vVersionedAccessions, vector<uint64_t>& vHashes)
 {
-	//  The header string to return
-	string strHeader = "";
+	//  Manifest file text
+	string strManifestFileText = "";
+	//  Manifest lines
+	vector<string> vLines;
+	//  Line fields
+	vector<string> vFields;
 
 	try
 	{
-		strHeader = "Accession~";
-		strHeader += "Name/ID~";
-		strHeader += "Length~";
-		strHeader += "Molecule Type [dna/rna]~";
+		vAccessions.clear();
+		vVersionedAccessions.clear();
+		vHashes.clear();
+
+		if (GetFileText(strCatalogFilePathName + m_chaGBKManifestExtension, strManifestFileText))
+		{
+			SplitString(strManifestFileText, '\n', vLines);
+
+			for (size_t stCount = 0; stCount < vLines.size(); stCount++)
+			{
+				SplitString(vLines[stCount], '~', vFields);
+
+				if (vFields.size() == 3)
+				{
+					vAccessions.push_back(vFields[0]);
+					vVersionedAccessions.push_back(vFields[1]);
+					vHashes.push_back((uint64_t)strtoull(vFields[2].c_str(), NULL, 16));
+				}
+				else
+				{
+					ReportTimeStamp("[ReadGBKManifest]", "ERROR:  Manifest Line [" + vLines[stCount] + "] is Not Properly Formatted");
+
+					return false;
+				}
+			}
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[ReadGBKManifest]", "ERROR:  Manifest File [" + strCatalogFilePathName + m_chaGBKManifestExtension + "] Open Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReadGBKManifest] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes a GBK catalog content manifest (see ReadGBKManifest); entries without an accession are
+//      not written
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strCatalogFilePathName        :  catalog file path name
+//  [vector<string>&] vAccessions          :  the accessions
+//  [vector<string>&] vVersionedAccessions :  the versioned accessions
+//  [vector<uint64_t>&] vHashes            :  the content hashes
+//                                         :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::WriteGBKManifest(string strCatalogFilePathName, vector<string>& vAccessions, vector<string>& vVersionedAccessions, vector<uint64_t>& vHashes)
+{
+	//  Manifest file text
+	stringstream ssManifestFileText;
+	//  Manifest file text (to write)
+	string strManifestFileText = "";
+
+	try
+	{
+		if ((vAccessions.size() == vVersionedAccessions.size()) && (vAccessions.size() == vHashes.size()))
+		{
+			for (size_t stCount = 0; stCount < vAccessions.size(); stCount++)
+			{
+				if (!vAccessions[stCount].empty())
+					ssManifestFileText << vAccessions[stCount] << '~' << vVersionedAccessions[stCount] << '~' << hex << setw(16) << setfill('0') << vHashes[stCount] << dec << '\n';
+			}
+
+			strManifestFileText = ssManifestFileText.str();
+
+			if (WriteFileText(strCatalogFilePathName + m_chaGBKManifestExtension, strManifestFileText))
+				return true;
+			else
+			{
+				ReportTimeStamp("[WriteGBKManifest]", "ERROR:  Manifest File [" + strCatalogFilePathName + m_chaGBKManifestExtension + "] Write Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[WriteGBKManifest]", "ERROR:  Manifest Vector Sizes Differ");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteGBKManifest] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Parses a .dat CDS starts/stops string into numerics
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strParts          :  starts/stops string to parse
+//  [vector<long>&] vStartsStops:  starts/stops vector<long> to return
+//                             :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::ParseStartsStops(string& strParts, vector<long>& vStartsStops)
+{
+	//  Numeric, string representation
+	string strNumeric = "";
+	//  Numeric, long representation
+	long lNumeric = 0;
+	//  On numeric, if true; else, on string
+	bool bOnNumeric = false;
+
+	try
+	{
+		//  Clear vector
+		vStartsStops.clear();
+
+		//  If parts is not empty
+		if (!strParts.empty())
+		{
+			//  Iterate through parts string, parse out numbers by pairs
+			for (int nCount = 0; nCount <= strParts.length(); nCount++)
+			{
+				//  On numeric
+				if ((nCount < strParts.length()) && 
+					((strParts[nCount] == '0') || (strParts[nCount] == '1') || (strParts[nCount] == '2') || (strParts[nCount] == '3') || (strParts[nCount] == '4') ||
+					(strParts[nCount] == '5') || (strParts[nCount] == '6') || (strParts[nCount] == '7') || (strParts[nCount] == '8') || (strParts[nCount] == '9')))
+				{
+					bOnNumeric = true;
+				}
+				//  Off numeric
+				else
+				{
+					//  If the numeric string is not empty
+					if (!strNumeric.empty())
+					{
+						//  Convert numeric string to long
+						stringstream(strNumeric) >> lNumeric;
+
+						//  Add the numeric to the vector<long>
+						vStartsStops.push_back(lNumeric);
+					}
+
+					//  Clear numeric
+					strNumeric = "";
+					lNumeric = 0;
+
+					//  Off numeric
+					bOnNumeric = false;
+				}
+
+				//  Concatenate numeric
+				if (bOnNumeric)
+					strNumeric += strParts[nCount];
+			}
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[ParseStartsStops]", "ERROR:  CDS Starts/Stops is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ParseStartsStops] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the entries header header
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the entries header string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string CBase123_Catalog::GetEntryHeader()
+{
+	//  The header string to return
+	string strHeader = "";
+
+	try
+	{
+		strHeader = "Accession~";
+		strHeader += "Name/ID~";
+		strHeader += "Length~";
+		strHeader += "Molecule Type [dna/rna]~";
 		strHeader += "Strandedness [ss/ds]~";
 		strHeader += "Strandedness Type [l/c]~";
 		strHeader += "Strandedness Direction [+/-]~";
@@ -1907,6 +3253,67 @@ string CBase123_Catalog::GetCDSHeader()
 	return strHeader;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Initializes the catalog (GBK features, entries and lazy state)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lMaxSize:  maximum size expected for this catalog (indexed upper limit)
+//  [bool] bLazy   :  true, if entries are parsed on first access; else, false
+//                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::InitializeCatalog(long lMaxSize, bool bLazy)
+{
+	try
+	{
+		//  GBK Features MUST be in lowercase for comparisons
+		m_strGBKFeature_Locus = "locus       ";
+		m_strGBKFeature_Organism = "  organism  ";
+		m_strGBKFeature_Definition = "definition  ";
+		m_strGBKFeature_Version = "version     ";
+		m_strGBKFeature_Host = "                     /host=\"";
+		m_strGBKFeature_Chromosome = "                     /chromosome=\"";
+		m_strGBKFeature_Segment = "                     /segment=\"";
+		m_strGBKFeature_Country = "                     /country=\"";
+		m_strGBKFeature_CollectionDate = "                     /collection_date=\"";
+		m_strGBKFeature_CDS = "     cds             ";
+		m_strGBKFeature_Gene = "                     /gene=\"";
+		m_strGBKFeature_Product = "                     /product=\"";
+		m_strGBKFeature_NextFeature = "                     /";
+		m_strGBKFeature_GeneID = "                     /db_xref=\"geneid:";
+		m_strGBKFeature_Translation = "                     /translation=\"";
+		m_strGBKFeature_Origin = "origin";
+
+		m_bLazy = bLazy;
+		m_lMaxSize = lMaxSize;
+		m_lLazyEntryCount = 0;
+		m_appLazyEntries = NULL;
+		m_pb123Compact = NULL;
+		memset(&m_stLazyHeader, 0, sizeof(m_stLazyHeader));
+
+		for (int nLock = 0; nLock < m_nLazyEntryLocks; nLock++)
+			omp_init_lock(&m_laLazyLocks[nLock]);
+
+		//  A lazy catalog holds only the entries opened (no preallocation)
+		m_vEntries.clear();
+		if (!m_bLazy)
+			m_vEntries.resize(lMaxSize);
+
+		m_bAccessionsIndexed = false;
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [InitializeCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Clears catalog entries
@@ -1921,7 +3328,11 @@ bool CBase123_Catalog::ClearEntries()
 {
 	try
 	{
+		ReleaseLazyEntries();
+
 		m_vEntries.clear();
+		m_vAccessionIndex.clear();
+		m_bAccessionsIndexed = false;
 
 		return true;
 	}
@@ -1930,5 +3341,668 @@ bool CBase123_Catalog::ClearEntries()
 		cout << "ERROR [ClearEntries] Exception Code:  " << ex.what() << "\n";
 	}
 
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Indexes the set entries by accession, in parallel (first entry wins for a repeated accession)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nMaxProcs:  maximum processors for openMP
+//                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::IndexAccessions(int nMaxProcs)
+{
+	//  Accessions, by entry (empty, if not indexed)
+	vector<string> vAccessions(m_vEntries.size());
+
+	try
+	{
+		#pragma omp parallel for schedule(dynamic, 1024) num_threads(nMaxProcs)
+		for (long lCount = 0; lCount < (long)m_vEntries.size(); lCount++)
+		{
+			if (m_vEntries[lCount].GetIsSet())
+				vAccessions[lCount] = m_vEntries[lCount].GetAccession();
+		}
+
+		return IndexAccessions(vAccessions, nMaxProcs);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [IndexAccessions] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Indexes accessions by entry index, in parallel (first entry wins for a repeated accession);
+//      accessions are hashed concurrently, then each index shard is filled by one thread
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<string>&] vAccessions:  accessions, by entry index (empty accessions are not indexed)
+//  [int] nMaxProcs              :  maximum processors for openMP
+//                               :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::IndexAccessions(vector<string>& vAccessions, int nMaxProcs)
+{
+	//  Accession shards, by entry (-1, if not indexed)
+	vector<int> vShards(vAccessions.size(), -1);
+
+	try
+	{
+		m_vAccessionIndex.clear();
+		m_vAccessionIndex.resize(m_nAccessionIndexShards);
+
+		#pragma omp parallel for schedule(dynamic, 1024) num_threads(nMaxProcs)
+		for (long lCount = 0; lCount < (long)vAccessions.size(); lCount++)
+		{
+			if (!vAccessions[lCount].empty())
+				vShards[lCount] = (int)(hash<string>()(vAccessions[lCount]) % m_nAccessionIndexShards);
+		}
+
+		#pragma omp parallel for schedule(dynamic) num_threads(nMaxProcs)
+		for (int nShard = 0; nShard < m_nAccessionIndexShards; nShard++)
+		{
+			for (long lCount = 0; lCount < (long)vAccessions.size(); lCount++)
+			{
+				if (vShards[lCount] == nShard)
+					m_vAccessionIndex[nShard].emplace(vAccessions[lCount], lCount);
+			}
+		}
+
+		m_bAccessionsIndexed = true;
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [IndexAccessions] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Locates the non-empty lines of catalog text, in parallel; the text is split into chunks at line
+//      boundaries, its lines counted per chunk to place each line in its slot, then located
+//      concurrently (empty and carriage-return only lines are skipped, as SplitString does)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const char*] chpText             :  catalog text
+//  [uint64_t] ullLength              :  catalog text length
+//  [int] nMaxProcs                   :  maximum processors for openMP
+//  [vector<uint64_t>&] vLineStarts   :  line starts to return (byte offsets)
+//  [vector<uint64_t>&] vLineEnds     :  line ends to return (byte offsets, exclusive of the newline)
+//                                    :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::GetCatalogLines(const char* chpText, uint64_t ullLength, int nMaxProcs, vector<uint64_t>& vLineStarts, vector<uint64_t>& vLineEnds)
+{
+	//  Chunk count
+	long lChunks = (long)nMaxProcs * 4;
+	//  Chunk starts (byte offsets; last is the text length)
+	vector<uint64_t> vChunkStarts;
+	//  Chunk first line indices (last is the line count)
+	vector<long> vChunkLines(lChunks + 1, 0);
+
+	try
+	{
+		vLineStarts.clear();
+		vLineEnds.clear();
+
+		//  Chunk at line boundaries (a chunk starts after a newline)
+		vChunkStarts.push_back(0);
+		for (long lChunk = 1; lChunk < lChunks; lChunk++)
+		{
+			//  Chunk start
+			uint64_t ullStart = ullLength * lChunk / lChunks;
+
+			if (ullStart < vChunkStarts.back())
+				ullStart = vChunkStarts.back();
+
+			while ((ullStart < ullLength) && (ullStart > 0) && (chpText[ullStart - 1] != '\n'))
+				ullStart++;
+
+			vChunkStarts.push_back(ullStart);
+		}
+		vChunkStarts.push_back(ullLength);
+
+		//  Count lines per chunk, then locate them (pass 0 counts, pass 1 sets)
+		for (int nPass = 0; nPass < 2; nPass++)
+		{
+			#pragma omp parallel for schedule(dynamic) num_threads(nMaxProcs)
+			for (long lChunk = 0; lChunk < lChunks; lChunk++)
+			{
+				//  Line start
+				uint64_t ullLine = vChunkStarts[lChunk];
+				//  Line index
+				long lLine = vChunkLines[lChunk];
+
+				while (ullLine < vChunkStarts[lChunk + 1])
+				{
+					//  Line end
+					const char* chpEnd = (const char*)memchr(chpText + ullLine, '\n', (size_t)(vChunkStarts[lChunk + 1] - ullLine));
+					uint64_t ullEnd = (chpEnd != NULL) ? (uint64_t)(chpEnd - chpText) : vChunkStarts[lChunk + 1];
+
+					for (uint64_t ullCount = ullLine; ullCount < ullEnd; ullCount++)
+					{
+						//  If line is not empty
+						if (chpText[ullCount] != '\r')
+						{
+							if (nPass == 0)
+								vChunkLines[lChunk + 1]++;
+							else
+							{
+								vLineStarts[lLine] = ullLine;
+								vLineEnds[lLine] = ullEnd;
+								lLine++;
+							}
+
+							break;
+						}
+					}
+
+					ullLine = ullEnd + 1;
+				}
+			}
+
+			if (nPass == 0)
+			{
+				for (long lChunk = 0; lChunk < lChunks; lChunk++)
+					vChunkLines[lChunk + 1] += vChunkLines[lChunk];
+
+				vLineStarts.resize(vChunkLines[lChunks]);
+				vLineEnds.resize(vChunkLines[lChunks]);
+			}
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetCatalogLines] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets (resets) a catalog entry from one text catalog line (carriage returns are removed)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [CBase123_Catalog_Entry&] ceSet:  catalog entry to set
+//  [const char*] chpLine          :  catalog line
+//  [size_t] ulLength              :  catalog line length
+//                                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::SetEntryFromLine(CBase123_Catalog_Entry& ceSet, const char* chpLine, size_t ulLength)
+{
+	//  Line text
+	string strLine(chpLine, ulLength);
+
+	try
+	{
+		if (strLine.find('\r') != string::npos)
+			strLine.erase(remove(strLine.begin(), strLine.end(), '\r'), strLine.end());
+
+		ceSet = CBase123_Catalog_Entry();
+		ceSet.SetEntry(strLine);
+		ceSet.SetIsSet(true);
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SetEntryFromLine] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets and validates the header of a mapped compiled (binary) catalog; the section bounds, the
+//      string table and every entry's CDS range must lie within the file
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const char*] chpData                 :  mapped image
+//  [uint64_t] ullSize                    :  mapped image size
+//  [string] strInputFilePathName         :  file path name of the compiled catalog (for reporting)
+//  [structBinaryCatalogHeader&] stHeader :  header to return
+//                                        :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::GetBinaryCatalogHeader(const char* chpData, uint64_t ullSize, string strInputFilePathName, structBinaryCatalogHeader& stHeader)
+{
+	try
+	{
+		memset(&stHeader, 0, sizeof(stHeader));
+		if (ullSize >= sizeof(stHeader))
+			memcpy(&stHeader, chpData, sizeof(stHeader));
+
+		//  If the header and the section bounds are consistent with the file
+		if ((ullSize >= sizeof(stHeader)) && (stHeader.untVersion == m_untBinaryCatalogVersion) && (stHeader.untStringCount > 0) &&
+			(stHeader.ullEntryOffset + sizeof(structBinaryCatalogEntry) * stHeader.ullEntryCount <= stHeader.ullCDSOffset) &&
+			(stHeader.ullCDSOffset + sizeof(structBinaryCatalogCDS) * stHeader.ullCDSCount <= stHeader.ullStringTableOffset) &&
+			(stHeader.ullStringTableOffset + sizeof(uint64_t) * ((uint64_t)stHeader.untStringCount + 1) <= stHeader.ullStringOffset) &&
+			(stHeader.ullStringOffset <= ullSize))
+		{
+			//  Tables
+			const structBinaryCatalogEntry* stpEntries = (const structBinaryCatalogEntry*)(chpData + stHeader.ullEntryOffset);
+			const uint64_t* ullpStringOffsets = (const uint64_t*)(chpData + stHeader.ullStringTableOffset);
+
+			if (stHeader.ullStringOffset + ullpStringOffsets[stHeader.untStringCount] <= ullSize)
+			{
+				for (uint64_t ullCount = 0; ullCount < stHeader.ullEntryCount; ullCount++)
+				{
+					if (stpEntries[ullCount].ullCDSStart + stpEntries[ullCount].untCDSCount > stHeader.ullCDSCount)
+					{
+						ReportTimeStamp("[GetBinaryCatalogHeader]", "ERROR:  Catalog File [" + strInputFilePathName + "] Entry [" + ConvertLongToString((long)ullCount) + "] CDS Range is Out of Bounds");
+
+						return false;
+					}
+				}
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[GetBinaryCatalogHeader]", "ERROR:  Catalog File [" + strInputFilePathName + "] String Table is Truncated");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[GetBinaryCatalogHeader]", "ERROR:  Catalog File [" + strInputFilePathName + "] Header is Not Properly Formatted");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetBinaryCatalogHeader] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets a catalog entry directly from a compiled (binary) catalog's entry, CDS and string tables
+//      (no line splitting or field parsing); the header must have been validated
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [CBase123_Catalog_Entry&] ceSet       :  catalog entry to set
+//  [const char*] chpData                 :  mapped image
+//  [structBinaryCatalogHeader&] stHeader :  validated header
+//  [long] lIndex                         :  entry index
+//                                        :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::SetEntryFromBinary(CBase123_Catalog_Entry& ceSet, const char* chpData, structBinaryCatalogHeader& stHeader, long lIndex)
+{
+	try
+	{
+		//  Tables
+		const structBinaryCatalogEntry* stpEntries = (const structBinaryCatalogEntry*)(chpData + stHeader.ullEntryOffset);
+		const structBinaryCatalogCDS* stpCDSs = (const structBinaryCatalogCDS*)(chpData + stHeader.ullCDSOffset);
+		const uint64_t* ullpStringOffsets = (const uint64_t*)(chpData + stHeader.ullStringTableOffset);
+		const char* chpStrings = chpData + stHeader.ullStringOffset;
+		//  Entry record
+		const structBinaryCatalogEntry& stEntry = stpEntries[lIndex];
+		//  Entry CDSs
+		vector<structCDS>* pvCDSs = ceSet.GetCDSCollectionPointer();
+
+		ceSet.SetLength((long)stEntry.llLength);
+
+		for (int nField = 0; nField < m_nBinaryCatalogFields; nField++)
+		{
+			//  String index
+			uint32_t untString = (stEntry.untaFields[nField] < stHeader.untStringCount) ? stEntry.untaFields[nField] : 0;
+
+			ceSet.SetColumn(nField < 2 ? nField : nField + 1, chpStrings + ullpStringOffsets[untString], (size_t)(ullpStringOffsets[untString + 1] - ullpStringOffsets[untString]));
+		}
+
+		pvCDSs->clear();
+		pvCDSs->resize(stEntry.untCDSCount);
+
+		for (uint32_t untCDS = 0; untCDS < stEntry.untCDSCount; untCDS++)
+		{
+			//  CDS record
+			const structBinaryCatalogCDS& stCDS = stpCDSs[stEntry.ullCDSStart + untCDS];
+			//  String indices
+			uint32_t untIsComplement = (stCDS.untIsComplement < stHeader.untStringCount) ? stCDS.untIsComplement : 0;
+			uint32_t untNameID = (stCDS.untNameID < stHeader.untStringCount) ? stCDS.untNameID : 0;
+			uint32_t untCompleteness = (stCDS.untCompleteness < stHeader.untStringCount) ? stCDS.untCompleteness : 0;
+
+			(*pvCDSs)[untCDS].lStart = (long)stCDS.llStart;
+			(*pvCDSs)[untCDS].lStop = (long)stCDS.llStop;
+			(*pvCDSs)[untCDS].strIsComplement.assign(chpStrings + ullpStringOffsets[untIsComplement], (size_t)(ullpStringOffsets[untIsComplement + 1] - ullpStringOffsets[untIsComplement]));
+			(*pvCDSs)[untCDS].strNameID.assign(chpStrings + ullpStringOffsets[untNameID], (size_t)(ullpStringOffsets[untNameID + 1] - ullpStringOffsets[untNameID]));
+			(*pvCDSs)[untCDS].strCompleteness.assign(chpStrings + ullpStringOffsets[untCompleteness], (size_t)(ullpStringOffsets[untCompleteness + 1] - ullpStringOffsets[untCompleteness]));
+		}
+
+		ceSet.SetIsSet(true);
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SetEntryFromBinary] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Opens a compiled (binary) catalog; maps the file and sets entries directly from the entry, CDS
+//      and string tables (no line splitting or field parsing), in parallel
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathName:  file path name of the compiled catalog
+//  [int] nMaxProcs              :  maximum processors for openMP
+//                               :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::OpenBinaryCatalog(string strInputFilePathName, int nMaxProcs)
+{
+	//  Mapped catalog
+	CBase123_Mapped_File b123MappedFile;
+	//  Header
+	structBinaryCatalogHeader stHeader;
+
+	try
+	{
+		if (b123MappedFile.OpenMappedFile(strInputFilePathName))
+		{
+			//  Mapped image
+			const char* chpData = b123MappedFile.GetData();
+
+			if (GetBinaryCatalogHeader(chpData, b123MappedFile.GetSize(), strInputFilePathName, stHeader))
+			{
+				if (stHeader.ullEntryCount <= m_vEntries.size())
+				{
+					#pragma omp parallel for schedule(dynamic, 256) num_threads(nMaxProcs)
+					for (long lCount = 0; lCount < (long)stHeader.ullEntryCount; lCount++)
+						SetEntryFromBinary(m_vEntries[lCount], chpData, stHeader, lCount);
+
+					m_bAccessionsIndexed = false;
+
+					return IndexAccessions(nMaxProcs);
+				}
+				else
+				{
+					ReportTimeStamp("[OpenBinaryCatalog]", "ERROR:  Catalog Entry Count [" + ConvertLongToString((long)stHeader.ullEntryCount) + "] Exceeds Index Range [0:" + ConvertLongToString((long)m_vEntries.size()) + "]");
+				}
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[OpenBinaryCatalog]", "ERROR:  Catalog File [" + strInputFilePathName + "] Open Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [OpenBinaryCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Opens a lazy catalog (text or compiled); maps the file and keeps it mapped, locates the entry
+//      lines (text) or validates the entry tables (compiled), then indexes the accessions, in
+//      parallel; no entry is parsed until first accessed (see GetEntryPointerByIndex)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathName:  file path name of the catalog
+//  [int] nMaxProcs              :  maximum processors for openMP
+//                               :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::OpenLazyCatalog(string strInputFilePathName, int nMaxProcs)
+{
+	//  Accessions, by entry
+	vector<string> vAccessions;
+	//  Entry count
+	long lEntryCount = -1;
+
+	try
+	{
+		ReleaseLazyEntries();
+		m_vAccessionIndex.clear();
+		m_bAccessionsIndexed = false;
+
+		//  If file text is not empty
+		if (m_b123LazyFile.OpenMappedFile(strInputFilePathName))
+		{
+			//  Mapped image
+			const char* chpData = m_b123LazyFile.GetData();
+
+			//  If the catalog is compiled, accessions are string field 0
+			if (IsBinaryCatalogFile(strInputFilePathName))
+			{
+				if (GetBinaryCatalogHeader(chpData, m_b123LazyFile.GetSize(), strInputFilePathName, m_stLazyHeader))
+				{
+					//  Tables
+					const structBinaryCatalogEntry* stpEntries = (const structBinaryCatalogEntry*)(chpData + m_stLazyHeader.ullEntryOffset);
+					const uint64_t* ullpStringOffsets = (const uint64_t*)(chpData + m_stLazyHeader.ullStringTableOffset);
+					const char* chpStrings = chpData + m_stLazyHeader.ullStringOffset;
+
+					lEntryCount = (long)m_stLazyHeader.ullEntryCount;
+					vAccessions.resize(lEntryCount);
+
+					#pragma omp parallel for schedule(dynamic, 1024) num_threads(nMaxProcs)
+					for (long lCount = 0; lCount < lEntryCount; lCount++)
+					{
+						//  String index
+						uint32_t untString = (stpEntries[lCount].untaFields[0] < m_stLazyHeader.untStringCount) ? stpEntries[lCount].untaFields[0] : 0;
+
+						vAccessions[lCount].assign(chpStrings + ullpStringOffsets[untString], (size_t)(ullpStringOffsets[untString + 1] - ullpStringOffsets[untString]));
+					}
+				}
+			}
+			else
+			{
+				GetCatalogLines(chpData, m_b123LazyFile.GetSize(), nMaxProcs, m_vLazyLineStarts, m_vLazyLineEnds);
+
+				//  If lines are filled
+				if (m_vLazyLineStarts.size() > 0)
+				{
+					//  Line 0, the header, is dropped
+					m_vLazyLineStarts.erase(m_vLazyLineStarts.begin());
+					m_vLazyLineEnds.erase(m_vLazyLineEnds.begin());
+
+					lEntryCount = (long)m_vLazyLineStarts.size();
+					vAccessions.resize(lEntryCount);
+
+					#pragma omp parallel for schedule(dynamic, 1024) num_threads(nMaxProcs)
+					for (long lCount = 0; lCount < lEntryCount; lCount++)
+						vAccessions[lCount] = GetCatalogLineAccession(chpData + m_vLazyLineStarts[lCount], (size_t)(m_vLazyLineEnds[lCount] - m_vLazyLineStarts[lCount]));
+				}
+				else
+				{
+					ReportTimeStamp("[OpenLazyCatalog]", "ERROR:  Catalog File [" + strInputFilePathName + "] Container is Not Set");
+				}
+			}
+
+			//  If entries are located
+			if (lEntryCount >= 0)
+			{
+				if (lEntryCount <= m_lMaxSize)
+				{
+					m_appLazyEntries = new atomic<CBase123_Catalog_Entry*>[lEntryCount];
+					for (long lCount = 0; lCount < lEntryCount; lCount++)
+						m_appLazyEntries[lCount].store(NULL);
+
+					m_lLazyEntryCount = lEntryCount;
+
+					return IndexAccessions(vAccessions, nMaxProcs);
+				}
+				else
+				{
+					ReportTimeStamp("[OpenLazyCatalog]", "ERROR:  Catalog Entry Count [" + ConvertLongToString(lEntryCount) + "] Exceeds Index Range [0:" + ConvertLongToString(m_lMaxSize) + "]");
+				}
+			}
+
+			ReleaseLazyEntries();
+		}
+		else
+		{
+			ReportTimeStamp("[OpenLazyCatalog]", "ERROR:  Catalog File [" + strInputFilePathName + "] Text is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [OpenLazyCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Parses a lazy catalog entry from the lazy source (compact store, compiled tables or text line),
+//      without keeping it
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex                  :  entry index
+//  [CBase123_Catalog_Entry&] ceGet:  catalog entry to return
+//                                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::GetLazyEntry(long lIndex, CBase123_Catalog_Entry& ceGet)
+{
+	try
+	{
+		if (m_pb123Compact != NULL)
+			return m_pb123Compact->GetEntry(lIndex, ceGet);
+
+		if (m_stLazyHeader.untVersion == m_untBinaryCatalogVersion)
+			return SetEntryFromBinary(ceGet, m_b123LazyFile.GetData(), m_stLazyHeader, lIndex);
+
+		return SetEntryFromLine(ceGet, m_b123LazyFile.GetData() + m_vLazyLineStarts[lIndex], (size_t)(m_vLazyLineEnds[lIndex] - m_vLazyLineStarts[lIndex]));
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetLazyEntry] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Makes a lazy catalog eager (every entry parsed and held in the catalog, up to the maximum size),
+//      so that it can be changed; the accession index remains valid (entry indices are unchanged)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::MaterializeLazyEntries()
+{
+	try
+	{
+		if (m_bLazy)
+		{
+			m_vEntries.clear();
+			m_vEntries.resize(max(m_lMaxSize, m_lLazyEntryCount));
+
+			for (long lCount = 0; lCount < m_lLazyEntryCount; lCount++)
+			{
+				//  Lazy entry, if already parsed
+				CBase123_Catalog_Entry* cepEntry = m_appLazyEntries[lCount].load(memory_order_acquire);
+
+				if (cepEntry != NULL)
+					m_vEntries[lCount] = *cepEntry;
+				else
+					GetLazyEntry(lCount, m_vEntries[lCount]);
+			}
+
+			ReleaseLazyEntries();
+
+			m_bLazy = false;
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [MaterializeLazyEntries] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Releases a lazy catalog's entries and source (the mapped file and the line offsets, or the compact store)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog::ReleaseLazyEntries()
+{
+	try
+	{
+		if (m_appLazyEntries != NULL)
+		{
+			for (long lCount = 0; lCount < m_lLazyEntryCount; lCount++)
+				delete m_appLazyEntries[lCount].load();
+
+			delete[] m_appLazyEntries;
+			m_appLazyEntries = NULL;
+		}
+
+		if (m_pb123Compact != NULL)
+		{
+			delete m_pb123Compact;
+			m_pb123Compact = NULL;
+		}
+
+		m_lLazyEntryCount = 0;
+		m_vLazyLineStarts.clear();
+		m_vLazyLineEnds.clear();
+		memset(&m_stLazyHeader, 0, sizeof(m_stLazyHeader));
+		m_b123LazyFile.CloseMappedFile();
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReleaseLazyEntries] Exception Code:  " << ex.what() << "\n";
+	}
+
 	return false;
 }
\ No newline at end of file
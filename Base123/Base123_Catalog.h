@@ -16,7 +16,36 @@
 
 using namespace std;
 
+#include <atomic>
 #include <deque>
+#include <unordered_map>
+#include <omp.h>
+
+#include "Base123_Catalog_Binary.h"
+#include "Base123_Mapped_File.h"
+
+class CBase123_Catalog_Compact;
+
+//  Accession index shard count
+const int m_nAccessionIndexShards = 64;
+//  Lazy entry materialization lock count (entries are striped across locks by index)
+const int m_nLazyEntryLocks = 64;
+//  Compaction block size (entries parsed in parallel, then encoded in order)
+const long m_lCompactBlockSize = 4096;
+//  GBK content manifest extension (appended to the catalog file path name; see CreateGBKCatalog)
+const char m_chaGBKManifestExtension[] = ".manifest";
+//  GBK content hash (64-bit FNV-1a):  offset basis
+const uint64_t m_ullGBKHashBasis = 14695981039346656037ULL;
+//  GBK content hash (64-bit FNV-1a):  prime
+const uint64_t m_ullGBKHashPrime = 1099511628211ULL;
+//  GBK refresh status:  unchanged (entry copied from the previous catalog)
+const int m_nGBKRefreshUnchanged = 0;
+//  GBK refresh status:  added (accession not in the previous catalog)
+const int m_nGBKRefreshAdded = 1;
+//  GBK refresh status:  changed (version or content hash differs)
+const int m_nGBKRefreshChanged = 2;
+//  GBK refresh status:  failed (file not opened or not cataloged)
+const int m_nGBKRefreshFailed = 3;
 
 class CBase123_Catalog
 {
@@ -26,6 +55,7 @@ public:
 
 	//  Constructor
 	CBase123_Catalog(long lMaxSize);
+	CBase123_Catalog(long lMaxSize, bool bLazy);
 	//  Destructor
 	virtual ~CBase123_Catalog();
 
@@ -33,6 +63,11 @@ public:
 
 public:
 
+	long GetEntryCount();
+	CBase123_Catalog_Entry* GetEntryPointerByIndex(long lIndex);
+	string GetColumnByIndex(long lIndex, int nColumn);
+	long GetIndexByAccession(string& strAccession);
+	CBase123_Catalog_Entry* GetEntryPointerByAccession(string& strAccession);
 	vector<structCDS>* GetCDSCollectionPointerByAccession(string strAccession);
 	bool GetCDSCollectionByAccession(string strAccession, vector<structCDS>& vCDSs);
 	vector<structCDS>* GetCDSCollectionPointerByIndex(long lIndex);
@@ -44,22 +79,43 @@ public:
 	string GetDemographicsHeader();
 	bool RemoveEntry(int nIndex);
 	bool OpenCatalog(string strInputFilePathName);
+	bool OpenCatalog(string strInputFilePathName, int nMaxProcs);
 	bool CloseCatalog();
 	bool WriteCatalog(string strOutputFilePathName);
+	bool WriteBinaryCatalog(string strOutputFilePathName);
+	bool CompileCatalog(string strInputFilePathName, string strOutputFilePathName);
+	bool CompactCatalog(int nMaxProcs);
+	bool QueryCatalog(string strInputFilePathName, string strQuery, string strOutputListFilePathName, string strOutputFilePathNameTransform, int nMaxProcs);
 	bool CreateDatCatalog(string strDatInputFilePathName, string strNADatInputFilePathName, string strOutputCatalogFilePathName, string strErrorFilePathName, int nMaxProcs);
 	bool CreateGBKCatalog(string strInputFilePathNameList, string strInputFilePathNameTransform, string strOutputCatalogFilePathName, string strErrorFilePathName, int nMaxProcs);
+	bool RefreshGBKCatalog(string strPreviousCatalogFilePathName, string strInputFilePathNameList, string strInputFilePathNameTransform, string strOutputCatalogFilePathName, string strAddedListFilePathName, string strChangedListFilePathName, string strRemovedListFilePathName, string strOutputFilePathNameTransform, string strErrorFilePathName, int nMaxProcs);
 
 	//  Implementation (private)
 
 private:
 
 	bool SetGBKEntryFeatures(CBase123_Catalog_Entry& eSet, string& strFeatures);
-	bool CatalogGBKFile(string& strFileText, long lIndex);
+	bool CatalogGBKFile(const char* chpGBKFileText, uint64_t ullGBKFileLength, long lIndex);
+	bool GetGBKFileIdentity(const char* chpGBKFileText, uint64_t ullGBKFileLength, string& strAccession, string& strVersionedAccession, uint64_t& ullHash);
+	bool ReadGBKManifest(string strCatalogFilePathName, vector<string>& vAccessions, vector<string>& vVersionedAccessions, vector<uint64_t>& vHashes);
+	bool WriteGBKManifest(string strCatalogFilePathName, vector<string>& vAccessions, vector<string>& vVersionedAccessions, vector<uint64_t>& vHashes);
 	bool CatalogDatFile(string& strDatFileText, string& strNADatFileText, string strErrorFilePathName, int nMaxProcs);
 	bool ParseStartsStops(string& strParts, vector<long>& vStartsStops);
 	string GetEntryHeader();
 	string GetCDSHeader();
+	bool InitializeCatalog(long lMaxSize, bool bLazy);
 	bool ClearEntries();
+	bool IndexAccessions(int nMaxProcs);
+	bool IndexAccessions(vector<string>& vAccessions, int nMaxProcs);
+	bool GetCatalogLines(const char* chpText, uint64_t ullLength, int nMaxProcs, vector<uint64_t>& vLineStarts, vector<uint64_t>& vLineEnds);
+	bool SetEntryFromLine(CBase123_Catalog_Entry& ceSet, const char* chpLine, size_t ulLength);
+	bool GetBinaryCatalogHeader(const char* chpData, uint64_t ullSize, string strInputFilePathName, structBinaryCatalogHeader& stHeader);
+	bool SetEntryFromBinary(CBase123_Catalog_Entry& ceSet, const char* chpData, structBinaryCatalogHeader& stHeader, long lIndex);
+	bool OpenBinaryCatalog(string strInputFilePathName, int nMaxProcs);
+	bool OpenLazyCatalog(string strInputFilePathName, int nMaxProcs);
+	bool GetLazyEntry(long lIndex, CBase123_Catalog_Entry& ceGet);
+	bool MaterializeLazyEntries();
+	bool ReleaseLazyEntries();
 
 	//  GBK Features
 	string m_strGBKFeature_Locus;
@@ -81,5 +137,29 @@ private:
 
 	//  Catalog entries
 	vector<CBase123_Catalog_Entry> m_vEntries;
+	//  Accession index (accession, entry index), sharded by accession hash; valid only while m_bAccessionsIndexed
+	vector<unordered_map<string, long>> m_vAccessionIndex;
+	//  Accession index is current (cleared by any entry change)
+	atomic<bool> m_bAccessionsIndexed;
+
+	//  Lazy mode (entries are parsed from the mapped catalog on first access)
+	bool m_bLazy;
+	//  Maximum size (lazy mode entry limit)
+	long m_lMaxSize;
+	//  Lazy entry count
+	long m_lLazyEntryCount;
+	//  Lazy entries, by index (NULL until first access)
+	atomic<CBase123_Catalog_Entry*>* m_appLazyEntries;
+	//  Lazy source:  mapped catalog file
+	CBase123_Mapped_File m_b123LazyFile;
+	//  Lazy source:  compiled catalog header (version 0, if the catalog is text)
+	structBinaryCatalogHeader m_stLazyHeader;
+	//  Lazy source:  text entry line starts and ends (byte offsets), by index
+	vector<uint64_t> m_vLazyLineStarts;
+	vector<uint64_t> m_vLazyLineEnds;
+	//  Lazy source:  compact store (NULL, unless compacted; see CompactCatalog)
+	CBase123_Catalog_Compact* m_pb123Compact;
+	//  Lazy materialization locks
+	omp_lock_t m_laLazyLocks[m_nLazyEntryLocks];
 };
 
@@ -0,0 +1,89 @@
+// Base123_Catalog_Binary.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123 compiled (binary) catalog layout (header); a compiled catalog is memory mapped and read
+//      in place, without line splitting or field parsing; every string field is an index into one
+//      interned string table, so repetitive fields (host, molecule type, locale, viral group, ...)
+//      are stored once; all sections are offset-indexed from the file start; layout:
+//
+//      structBinaryCatalogHeader
+//      structBinaryCatalogEntry[entry count]   (fixed size, catalog order)
+//      structBinaryCatalogCDS[CDS count]       (packed, each entry's CDSs contiguous)
+//      uint64_t[string count + 1]              (string offsets into the string bytes; string n
+//                                               spans offsets n to n + 1; string 0 is empty)
+//      string bytes
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstdint>
+
+//  Compiled catalog magic
+const char m_chaBinaryCatalogMagic[8] = { 'B', '1', '2', '3', 'C', 'A', 'T', 'B' };
+//  Compiled catalog version
+const uint32_t m_untBinaryCatalogVersion = 1;
+//  Compiled catalog string fields per entry (every header column except length, in column order)
+const int m_nBinaryCatalogFields = 20;
+
+//  Compiled catalog header
+struct structBinaryCatalogHeader
+{
+	//  Magic
+	char chaMagic[8];
+	//  Version
+	uint32_t untVersion;
+	//  String count
+	uint32_t untStringCount;
+	//  Entry count
+	uint64_t ullEntryCount;
+	//  CDS count
+	uint64_t ullCDSCount;
+	//  Entry table offset
+	uint64_t ullEntryOffset;
+	//  CDS table offset
+	uint64_t ullCDSOffset;
+	//  String offset table offset
+	uint64_t ullStringTableOffset;
+	//  String bytes offset
+	uint64_t ullStringOffset;
+};
+
+//  Compiled catalog entry
+struct structBinaryCatalogEntry
+{
+	//  Sequence length
+	int64_t llLength;
+	//  First CDS (CDS table index)
+	uint64_t ullCDSStart;
+	//  CDS count
+	uint32_t untCDSCount;
+	//  String fields (string table indices, column order)
+	uint32_t untaFields[m_nBinaryCatalogFields];
+	//  Reserved (alignment)
+	uint32_t untReserved;
+};
+
+//  Compiled catalog CDS
+struct structBinaryCatalogCDS
+{
+	//  Start
+	int64_t llStart;
+	//  Stop
+	int64_t llStop;
+	//  Is complement (string table index)
+	uint32_t untIsComplement;
+	//  Name/ID (string table index)
+	uint32_t untNameID;
+	//  Completeness (string table index)
+	uint32_t untCompleteness;
+	//  Reserved (alignment)
+	uint32_t untReserved;
+};
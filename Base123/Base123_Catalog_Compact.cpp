@@ -0,0 +1,586 @@
+// Base123_Catalog_Compact.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Catalog_Compact class holds catalog entries in a compact, struct-of-arrays layout; see
+//      Base123_Catalog_Compact.h
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Catalog_Entry.h"
+#include "Base123_Catalog_Compact.h"
+#include "Base123_Utilities.h"
+
+#include <cstring>
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_Catalog_Compact class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Catalog_Compact::CBase123_Catalog_Compact()
+{
+	try
+	{
+		ClearEntries();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CBase123_Catalog_Compact] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_Catalog_Compact class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Catalog_Compact::~CBase123_Catalog_Compact()
+{
+	try
+	{
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [~CBase123_Catalog_Compact] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Adds (encodes) a catalog entry; the entry is appended at the next index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [CBase123_Catalog_Entry&] ceAdd:  catalog entry to add
+//                                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Compact::AddEntry(CBase123_Catalog_Entry& ceAdd)
+{
+	//  Entry index
+	uint64_t ullIndex = m_vLengths.size();
+	//  Entry CDSs
+	vector<structCDS>* pvCDSs = ceAdd.GetCDSCollectionPointer();
+	//  Categorical bitfield
+	uint32_t untCategories = ceAdd.GetIsSet() ? m_untCompactIsSet : 0;
+	//  Free text string IDs
+	uint32_t untaTexts[m_nCompactTexts];
+	//  Overflow values of this entry (committed with the entry)
+	unordered_map<uint64_t, uint32_t> umOverflow;
+
+	try
+	{
+		//  If every string this entry could add keeps string IDs in range
+		if (m_vStringOffsets.size() + m_nCompactTexts + m_nCompactCategories + pvCDSs->size() * 3 < m_untCompactMaxStrings)
+		{
+			for (int nCategory = 0; nCategory < m_nCompactCategories; nCategory++)
+				untCategories |= EncodeCategory(m_staCompactCategories[nCategory], ceAdd.GetColumn(m_staCompactCategories[nCategory].nColumn), (ullIndex << 5) | nCategory, umOverflow) << m_staCompactCategories[nCategory].nShift;
+
+			for (int nText = 0; nText < m_nCompactTexts; nText++)
+				untaTexts[nText] = InternString(ceAdd.GetColumn(m_naCompactTextColumns[nText]));
+
+			for (size_t ulCDS = 0; ulCDS < pvCDSs->size(); ulCDS++)
+			{
+				//  CDS
+				structCompactCDS stCDS;
+
+				stCDS.llStart = (*pvCDSs)[ulCDS].lStart;
+				stCDS.llStop = (*pvCDSs)[ulCDS].lStop;
+				stCDS.untNameID = InternString((*pvCDSs)[ulCDS].strNameID);
+				stCDS.untCompleteness = InternString((*pvCDSs)[ulCDS].strCompleteness);
+				stCDS.untIsComplement = EncodeCategory(m_stCompactCDSComplement, (*pvCDSs)[ulCDS].strIsComplement, ((uint64_t)m_vCDSs.size() << 5) | 31, umOverflow);
+
+				m_vCDSs.push_back(stCDS);
+			}
+
+			m_vLengths.push_back(ceAdd.GetLength());
+			m_vCategories.push_back(untCategories);
+			for (int nText = 0; nText < m_nCompactTexts; nText++)
+				m_vaTexts[nText].push_back(untaTexts[nText]);
+			m_vCDSOffsets.push_back(m_vCDSs.size());
+			m_umOverflow.insert(umOverflow.begin(), umOverflow.end());
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[AddEntry]", "ERROR:  Compact Catalog String Count Exceeds Limit [" + ConvertLongToString((long)m_untCompactMaxStrings) + "]");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AddEntry] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets (decodes) the catalog entry at the indicated index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex                  :  index to get
+//  [CBase123_Catalog_Entry&] ceGet:  catalog entry to return
+//                                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Compact::GetEntry(long lIndex, CBase123_Catalog_Entry& ceGet)
+{
+	try
+	{
+		//  If the index is in range
+		if ((lIndex >= 0) && (lIndex < GetEntryCount()))
+		{
+			//  Entry CDSs
+			vector<structCDS>* pvCDSs = NULL;
+
+			ceGet = CBase123_Catalog_Entry();
+			ceGet.SetLength((long)m_vLengths[lIndex]);
+			pvCDSs = ceGet.GetCDSCollectionPointer();
+
+			for (int nText = 0; nText < m_nCompactTexts; nText++)
+			{
+				//  String ID
+				uint32_t untString = m_vaTexts[nText][lIndex];
+
+				ceGet.SetColumn(m_naCompactTextColumns[nText], m_strStringBytes.data() + m_vStringOffsets[untString], (size_t)(m_vStringOffsets[untString + 1] - m_vStringOffsets[untString]));
+			}
+
+			for (int nCategory = 0; nCategory < m_nCompactCategories; nCategory++)
+			{
+				//  Category
+				const structCompactCategory& stCategory = m_staCompactCategories[nCategory];
+				//  Category value
+				string strValue = DecodeCategory(stCategory, (m_vCategories[lIndex] >> stCategory.nShift) & ((1u << stCategory.nWidth) - 1), ((uint64_t)lIndex << 5) | nCategory);
+
+				ceGet.SetColumn(stCategory.nColumn, strValue.data(), strValue.length());
+			}
+
+			pvCDSs->resize((size_t)(m_vCDSOffsets[lIndex + 1] - m_vCDSOffsets[lIndex]));
+
+			for (size_t ulCDS = 0; ulCDS < pvCDSs->size(); ulCDS++)
+				GetCDS(lIndex, (long)ulCDS, (*pvCDSs)[ulCDS]);
+
+			ceGet.SetIsSet(GetIsSet(lIndex));
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[GetEntry]", "ERROR:  Index [" + ConvertLongToString(lIndex) + "] is Out of Range [0:" + ConvertLongToString(GetEntryCount() - 1) + "]");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetEntry] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the entry count
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the entry count
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_Catalog_Compact::GetEntryCount()
+{
+	return (long)m_vLengths.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets whether the entry at the indicated index is set
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex:  entry index
+//               :  returns true, if the entry is set; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Compact::GetIsSet(long lIndex)
+{
+	if ((lIndex >= 0) && (lIndex < GetEntryCount()))
+		return ((m_vCategories[lIndex] & m_untCompactIsSet) != 0);
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the sequence length of the entry at the indicated index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex:  entry index
+//               :  returns the sequence length, if the index is in range; else, 0
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_Catalog_Compact::GetLength(long lIndex)
+{
+	if ((lIndex >= 0) && (lIndex < GetEntryCount()))
+		return (long)m_vLengths[lIndex];
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets one header column (catalog column order) of the entry at the indicated index, without
+//      decoding the entry; as CBase123_Catalog_Entry::GetColumn
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex :  entry index
+//  [int] nColumn :  column index [0:20]
+//                :  returns the column value, if the index and column are in range; else, an empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string CBase123_Catalog_Compact::GetColumn(long lIndex, int nColumn)
+{
+	try
+	{
+		if ((lIndex >= 0) && (lIndex < GetEntryCount()))
+		{
+			if (nColumn == 2)
+				return ConvertLongToString((long)m_vLengths[lIndex]);
+
+			for (int nText = 0; nText < m_nCompactTexts; nText++)
+			{
+				if (m_naCompactTextColumns[nText] == nColumn)
+				{
+					//  String ID
+					uint32_t untString = m_vaTexts[nText][lIndex];
+
+					return string(m_strStringBytes.data() + m_vStringOffsets[untString], (size_t)(m_vStringOffsets[untString + 1] - m_vStringOffsets[untString]));
+				}
+			}
+
+			for (int nCategory = 0; nCategory < m_nCompactCategories; nCategory++)
+			{
+				//  Category
+				const structCompactCategory& stCategory = m_staCompactCategories[nCategory];
+
+				if (stCategory.nColumn == nColumn)
+					return DecodeCategory(stCategory, (m_vCategories[lIndex] >> stCategory.nShift) & ((1u << stCategory.nWidth) - 1), ((uint64_t)lIndex << 5) | nCategory);
+			}
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetColumn] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return "";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the CDS count of the entry at the indicated index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex:  entry index
+//               :  returns the CDS count, if the index is in range; else, 0
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_Catalog_Compact::GetCDSCount(long lIndex)
+{
+	if ((lIndex >= 0) && (lIndex < GetEntryCount()))
+		return (long)(m_vCDSOffsets[lIndex + 1] - m_vCDSOffsets[lIndex]);
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets (decodes) one CDS of the entry at the indicated index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex        :  entry index
+//  [long] lCDS          :  CDS index, within the entry
+//  [structCDS&] stGet   :  CDS to return
+//                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Compact::GetCDS(long lIndex, long lCDS, structCDS& stGet)
+{
+	try
+	{
+		if ((lCDS >= 0) && (lCDS < GetCDSCount(lIndex)))
+		{
+			//  CDS array index
+			uint64_t ullCDS = m_vCDSOffsets[lIndex] + lCDS;
+			//  CDS
+			const structCompactCDS& stCDS = m_vCDSs[ullCDS];
+
+			stGet.lStart = (long)stCDS.llStart;
+			stGet.lStop = (long)stCDS.llStop;
+			stGet.strNameID.assign(m_strStringBytes.data() + m_vStringOffsets[stCDS.untNameID], (size_t)(m_vStringOffsets[stCDS.untNameID + 1] - m_vStringOffsets[stCDS.untNameID]));
+			stGet.strCompleteness.assign(m_strStringBytes.data() + m_vStringOffsets[stCDS.untCompleteness], (size_t)(m_vStringOffsets[stCDS.untCompleteness + 1] - m_vStringOffsets[stCDS.untCompleteness]));
+			stGet.strIsComplement = DecodeCategory(m_stCompactCDSComplement, stCDS.untIsComplement, (ullCDS << 5) | 31);
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[GetCDS]", "ERROR:  Entry [" + ConvertLongToString(lIndex) + "] CDS [" + ConvertLongToString(lCDS) + "] is Out of Range [0:" + ConvertLongToString(GetCDSCount(lIndex) - 1) + "]");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetCDS] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the memory held by the compact catalog (approximate; hash table nodes are estimated)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the memory size, bytes
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Catalog_Compact::GetMemorySize()
+{
+	//  Memory size to return
+	uint64_t ullSize = 0;
+
+	ullSize += m_vLengths.capacity() * sizeof(int64_t);
+	ullSize += m_vCategories.capacity() * sizeof(uint32_t);
+	for (int nText = 0; nText < m_nCompactTexts; nText++)
+		ullSize += m_vaTexts[nText].capacity() * sizeof(uint32_t);
+	ullSize += m_vCDSOffsets.capacity() * sizeof(uint64_t);
+	ullSize += m_vCDSs.capacity() * sizeof(structCompactCDS);
+	ullSize += m_vStringOffsets.capacity() * sizeof(uint64_t);
+	ullSize += m_strStringBytes.capacity();
+	ullSize += m_ummStringIndex.size() * (sizeof(size_t) + sizeof(uint32_t) + 2 * sizeof(void*)) + m_ummStringIndex.bucket_count() * sizeof(void*);
+	ullSize += m_umOverflow.size() * (sizeof(uint64_t) + sizeof(uint32_t) + 2 * sizeof(void*)) + m_umOverflow.bucket_count() * sizeof(void*);
+
+	return ullSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Releases spare capacity and the string pool index, once the catalog is complete (a later
+//      AddEntry rebuilds the index)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Compact::ShrinkToFit()
+{
+	try
+	{
+		m_vLengths.shrink_to_fit();
+		m_vCategories.shrink_to_fit();
+		for (int nText = 0; nText < m_nCompactTexts; nText++)
+			m_vaTexts[nText].shrink_to_fit();
+		m_vCDSOffsets.shrink_to_fit();
+		m_vCDSs.shrink_to_fit();
+		m_vStringOffsets.shrink_to_fit();
+		m_strStringBytes.shrink_to_fit();
+
+		unordered_multimap<size_t, uint32_t>().swap(m_ummStringIndex);
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ShrinkToFit] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Clears the compact catalog
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Compact::ClearEntries()
+{
+	try
+	{
+		vector<int64_t>().swap(m_vLengths);
+		vector<uint32_t>().swap(m_vCategories);
+		for (int nText = 0; nText < m_nCompactTexts; nText++)
+			vector<uint32_t>().swap(m_vaTexts[nText]);
+		vector<uint64_t>().swap(m_vCDSOffsets);
+		vector<structCompactCDS>().swap(m_vCDSs);
+		vector<uint64_t>().swap(m_vStringOffsets);
+		string().swap(m_strStringBytes);
+		unordered_multimap<size_t, uint32_t>().swap(m_ummStringIndex);
+		unordered_map<uint64_t, uint32_t>().swap(m_umOverflow);
+
+		//  Entry 0 CDSs start at 0; string 0 is empty
+		m_vCDSOffsets.push_back(0);
+		m_vStringOffsets.push_back(0);
+		InternString("");
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ClearEntries] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+//  Implementation (private)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Interns a string into the string pool
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const string&] strValue:  string to intern
+//                          :  returns the string ID
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint32_t CBase123_Catalog_Compact::InternString(const string& strValue)
+{
+	//  String hash
+	size_t ulHash = hash<string>()(strValue);
+	//  String count
+	uint32_t untCount = (uint32_t)m_vStringOffsets.size() - 1;
+
+	//  Rebuild the index, if released by ShrinkToFit
+	if ((m_ummStringIndex.empty()) && (untCount > 0))
+	{
+		m_ummStringIndex.reserve(untCount);
+		for (uint32_t untString = 0; untString < untCount; untString++)
+			m_ummStringIndex.emplace(hash<string>()(m_strStringBytes.substr((size_t)m_vStringOffsets[untString], (size_t)(m_vStringOffsets[untString + 1] - m_vStringOffsets[untString]))), untString);
+	}
+
+	//  Index entries with this hash
+	pair<unordered_multimap<size_t, uint32_t>::iterator, unordered_multimap<size_t, uint32_t>::iterator> prIndex = m_ummStringIndex.equal_range(ulHash);
+
+	for (unordered_multimap<size_t, uint32_t>::iterator itIndex = prIndex.first; itIndex != prIndex.second; itIndex++)
+	{
+		//  String length
+		size_t ulLength = (size_t)(m_vStringOffsets[itIndex->second + 1] - m_vStringOffsets[itIndex->second]);
+
+		if ((ulLength == strValue.length()) && (memcmp(m_strStringBytes.data() + m_vStringOffsets[itIndex->second], strValue.data(), ulLength) == 0))
+			return itIndex->second;
+	}
+
+	m_strStringBytes += strValue;
+	m_vStringOffsets.push_back(m_strStringBytes.length());
+	m_ummStringIndex.emplace(ulHash, untCount);
+
+	return untCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Encodes a categorical value against its vocabulary; a value outside the vocabulary is interned
+//      and held in the overflow table
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const structCompactCategory&] stCategory      :  category
+//  [const string&] strValue                       :  value to encode
+//  [uint64_t] ullOverflowKey                      :  overflow table key
+//  [unordered_map<uint64_t, uint32_t>&] umOverflow:  overflow table to set
+//                                                 :  returns the category code
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint32_t CBase123_Catalog_Compact::EncodeCategory(const structCompactCategory& stCategory, const string& strValue, uint64_t ullOverflowKey, unordered_map<uint64_t, uint32_t>& umOverflow)
+{
+	if (strValue.empty())
+		return 0;
+
+	for (uint32_t untValue = 0; stCategory.chpaValues[untValue] != NULL; untValue++)
+	{
+		if (strValue == stCategory.chpaValues[untValue])
+			return untValue + 1;
+	}
+
+	umOverflow[ullOverflowKey] = InternString(strValue);
+
+	return (1u << stCategory.nWidth) - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Decodes a categorical value
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const structCompactCategory&] stCategory:  category
+//  [uint32_t] untCode                       :  category code
+//  [uint64_t] ullOverflowKey                :  overflow table key
+//                                           :  returns the value
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string CBase123_Catalog_Compact::DecodeCategory(const structCompactCategory& stCategory, uint32_t untCode, uint64_t ullOverflowKey)
+{
+	if (untCode == 0)
+		return "";
+
+	if (untCode == (1u << stCategory.nWidth) - 1)
+	{
+		//  Overflow entry
+		unordered_map<uint64_t, uint32_t>::iterator itOverflow = m_umOverflow.find(ullOverflowKey);
+
+		if (itOverflow != m_umOverflow.end())
+			return string(m_strStringBytes.data() + m_vStringOffsets[itOverflow->second], (size_t)(m_vStringOffsets[itOverflow->second + 1] - m_vStringOffsets[itOverflow->second]));
+
+		return "";
+	}
+
+	return stCategory.chpaValues[untCode - 1];
+}
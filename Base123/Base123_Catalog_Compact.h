@@ -0,0 +1,140 @@
+// Base123_Catalog_Compact.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Catalog_Compact class (header) holds catalog entries in a compact, struct-of-arrays
+//      layout; categorical columns (molecule type, strandedness, direction, intermediates, ...) are
+//      coded against small fixed vocabularies and packed into one 32-bit bitfield per entry, free
+//      text columns (accession, name/ID, host, locale, ...) are interned string IDs, and the CDSs of
+//      all entries share one contiguous array, indexed by per-entry offsets; entries are decoded to
+//      CBase123_Catalog_Entry on request, so the entry API is unchanged
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//  Compact categorical column; a value is coded by its vocabulary position (code 0 is empty; the
+//      all-ones code marks a value outside the vocabulary, interned and held in the overflow table)
+struct structCompactCategory
+{
+	//  Entry column (catalog column order)
+	int nColumn;
+	//  Bitfield shift
+	int nShift;
+	//  Bitfield width
+	int nWidth;
+	//  Vocabulary (codes 1+; NULL terminated)
+	const char* chpaValues[8];
+};
+
+//  Compact categorical column count
+const int m_nCompactCategories = 12;
+//  Compact categorical columns (29 bits of the entry bitfield)
+const structCompactCategory m_staCompactCategories[m_nCompactCategories] =
+{
+	{ 3, 0, 2, { "dna", "rna" } },
+	{ 4, 2, 2, { "ss", "ds" } },
+	{ 5, 4, 2, { "c", "l" } },
+	{ 6, 6, 3, { "+", "-", "+/-" } },
+	{ 7, 9, 2, { "y", "n" } },
+	{ 8, 11, 2, { "y", "n" } },
+	{ 9, 13, 2, { "y", "n" } },
+	{ 10, 15, 3, { "c", "nc", "p" } },
+	{ 14, 18, 3, { "m", "f", "u" } },
+	{ 18, 21, 2, { "y", "n" } },
+	{ 19, 23, 2, { "y", "n" } },
+	{ 20, 25, 4, { "i", "ii", "iii", "iv", "v", "vi", "vii" } }
+};
+//  Compact CDS is-complement category (CDS bitfield)
+const structCompactCategory m_stCompactCDSComplement = { -1, 0, 2, { "y", "n" } };
+//  Compact entry bitfield:  is set
+const uint32_t m_untCompactIsSet = 0x80000000;
+
+//  Compact free text column count
+const int m_nCompactTexts = 8;
+//  Compact free text columns (interned)
+const int m_naCompactTextColumns[m_nCompactTexts] = { 0, 1, 11, 12, 13, 15, 16, 17 };
+
+//  Compact string ID limit (CDS completeness IDs are 30 bits)
+const uint32_t m_untCompactMaxStrings = 0x40000000;
+
+//  Compact CDS
+struct structCompactCDS
+{
+	//  Start
+	int64_t llStart;
+	//  Stop
+	int64_t llStop;
+	//  Name/ID (string ID)
+	uint32_t untNameID;
+	//  Completeness (string ID)
+	uint32_t untCompleteness : 30;
+	//  Is complement (category code)
+	uint32_t untIsComplement : 2;
+};
+
+class CBase123_Catalog_Compact
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_Catalog_Compact();
+	//  Destructor
+	virtual ~CBase123_Catalog_Compact();
+
+	//  Interface (public)
+
+public:
+
+	bool AddEntry(CBase123_Catalog_Entry& ceAdd);
+	bool GetEntry(long lIndex, CBase123_Catalog_Entry& ceGet);
+	long GetEntryCount();
+	bool GetIsSet(long lIndex);
+	long GetLength(long lIndex);
+	string GetColumn(long lIndex, int nColumn);
+	long GetCDSCount(long lIndex);
+	bool GetCDS(long lIndex, long lCDS, structCDS& stGet);
+	uint64_t GetMemorySize();
+	bool ShrinkToFit();
+	bool ClearEntries();
+
+	//  Implementation (private)
+
+private:
+
+	uint32_t InternString(const string& strValue);
+	uint32_t EncodeCategory(const structCompactCategory& stCategory, const string& strValue, uint64_t ullOverflowKey, unordered_map<uint64_t, uint32_t>& umOverflow);
+	string DecodeCategory(const structCompactCategory& stCategory, uint32_t untCode, uint64_t ullOverflowKey);
+
+	//  Sequence lengths, by entry
+	vector<int64_t> m_vLengths;
+	//  Categorical bitfields (and is set), by entry
+	vector<uint32_t> m_vCategories;
+	//  Free text string IDs, by free text column, by entry
+	vector<uint32_t> m_vaTexts[m_nCompactTexts];
+	//  CDS offsets, by entry (entry n spans offsets n to n + 1)
+	vector<uint64_t> m_vCDSOffsets;
+	//  CDSs, all entries
+	vector<structCompactCDS> m_vCDSs;
+	//  String pool offsets (string n spans offsets n to n + 1; string 0 is empty)
+	vector<uint64_t> m_vStringOffsets;
+	//  String pool bytes
+	string m_strStringBytes;
+	//  String pool index (string hash, string ID); rebuilt on demand after ShrinkToFit
+	unordered_multimap<size_t, uint32_t> m_ummStringIndex;
+	//  Categorical values outside their vocabulary ((entry << 5) | category, or (CDS << 5) | 31; string ID)
+	unordered_map<uint64_t, uint32_t> m_umOverflow;
+};
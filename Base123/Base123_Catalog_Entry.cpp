@@ -16,6 +16,7 @@
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Utilities.h"
 
+#include <cstdlib>
 #include <sstream>
 
 //  Initialization
@@ -1760,6 +1761,87 @@ void CBase123_Catalog_Entry::ClearCDS()
 	}
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets one header column (catalog column order, as written by GetEntryLine)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nColumn:  column index [0:20]
+//               :  returns the column string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string CBase123_Catalog_Entry::GetColumn(int nColumn)
+{
+	switch (nColumn)
+	{
+	case 0: return m_strAccession;
+	case 1: return m_strNameID;
+	case 2: return ConvertLongToString(m_lLength);
+	case 3: return m_strMoleculeType;
+	case 4: return m_strStrandedness;
+	case 5: return m_strStrandednessType;
+	case 6: return m_strStrandednessDirection;
+	case 7: return m_strDNAIntermediate;
+	case 8: return m_strRNAIntermediate;
+	case 9: return m_strRetroTranscriptase;
+	case 10: return m_strCompleteness;
+	case 11: return m_strDate;
+	case 12: return m_strHost;
+	case 13: return m_strHostAge;
+	case 14: return m_strHostGender;
+	case 15: return m_strChromosomeSegment;
+	case 16: return m_strSeroType;
+	case 17: return m_strLocale;
+	case 18: return m_strSatelliteStatus;
+	case 19: return m_strTranscriptStatus;
+	case 20: return m_strViralGroup;
+	}
+
+	return "";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sets one header column (catalog column order) as stored, without scrubbing, as SetEntry does
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nColumn          :  column index [0:20]
+//  [const char*] chpValue :  column value
+//  [size_t] ulLength      :  column value length
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void CBase123_Catalog_Entry::SetColumn(int nColumn, const char* chpValue, size_t ulLength)
+{
+	switch (nColumn)
+	{
+	case 0: m_strAccession.assign(chpValue, ulLength); break;
+	case 1: m_strNameID.assign(chpValue, ulLength); break;
+	case 2: m_lLength = strtol(string(chpValue, ulLength).c_str(), NULL, 10); break;
+	case 3: m_strMoleculeType.assign(chpValue, ulLength); break;
+	case 4: m_strStrandedness.assign(chpValue, ulLength); break;
+	case 5: m_strStrandednessType.assign(chpValue, ulLength); break;
+	case 6: m_strStrandednessDirection.assign(chpValue, ulLength); break;
+	case 7: m_strDNAIntermediate.assign(chpValue, ulLength); break;
+	case 8: m_strRNAIntermediate.assign(chpValue, ulLength); break;
+	case 9: m_strRetroTranscriptase.assign(chpValue, ulLength); break;
+	case 10: m_strCompleteness.assign(chpValue, ulLength); break;
+	case 11: m_strDate.assign(chpValue, ulLength); break;
+	case 12: m_strHost.assign(chpValue, ulLength); break;
+	case 13: m_strHostAge.assign(chpValue, ulLength); break;
+	case 14: m_strHostGender.assign(chpValue, ulLength); break;
+	case 15: m_strChromosomeSegment.assign(chpValue, ulLength); break;
+	case 16: m_strSeroType.assign(chpValue, ulLength); break;
+	case 17: m_strLocale.assign(chpValue, ulLength); break;
+	case 18: m_strSatelliteStatus.assign(chpValue, ulLength); break;
+	case 19: m_strTranscriptStatus.assign(chpValue, ulLength); break;
+	case 20: m_strViralGroup.assign(chpValue, ulLength); break;
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Gets the entry
@@ -1849,7 +1931,7 @@ bool CBase123_Catalog_Entry::SetEntry(string strEntry)
 				{
 					m_strAccession = vHeader[0];
 					m_strNameID = vHeader[1];
-					ConvertLongToString(m_lLength) = vHeader[2];
+					stringstream(vHeader[2]) >> m_lLength;
 					m_strMoleculeType = vHeader[3];
 					m_strStrandedness = vHeader[4];
 					m_strStrandednessType = vHeader[5];
@@ -97,6 +97,8 @@ public:
 	string GetEntry();
 	string GetDemographics();
 	bool SetEntry(string strEntry);
+	string GetColumn(int nColumn);
+	void SetColumn(int nColumn, const char* chpValue, size_t ulLength);
 
 	//  Implementation (private)
 	string GetEntryLine();
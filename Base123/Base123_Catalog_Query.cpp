@@ -0,0 +1,989 @@
+// Base123_Catalog_Query.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Catalog_Query class indexes catalog columns (value bitmaps, sorted ranges) and evaluates
+//      AND/OR queries over them; see Base123_Catalog_Query.h
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Catalog_Entry.h"
+#include "Base123_Catalog.h"
+#include "Base123_Catalog_Query.h"
+#include "Base123_Mapped_File.h"
+#include "Base123_Utilities.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <omp.h>
+
+#ifdef _WIN64
+	#include <intrin.h>
+#endif
+
+//  Month names (dd-mon-yyyy dates)
+static const char* m_chpaQueryMonths[12] = { "jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec" };
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the index of the lowest set bit of a non-zero 64-bit word
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullWord:  word to scan (non-zero)
+//                    :  returns lowest set bit index
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+static int GetLowestBit64(uint64_t ullWord)
+{
+	#ifdef _WIN64
+		unsigned long ulIndex = 0;
+		_BitScanForward64(&ulIndex, ullWord);
+		return (int)ulIndex;
+	#else
+		return __builtin_ctzll(ullWord);
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the set bits of a bitmap as entries, ascending
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<uint64_t>&] vBitmap   :  entry bitmap
+//  [vector<uint32_t>&] vEntries  :  entries to return
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+static void GetBitmapEntries(vector<uint64_t>& vBitmap, vector<uint32_t>& vEntries)
+{
+	vEntries.clear();
+
+	for (size_t stWord = 0; stWord < vBitmap.size(); stWord++)
+	{
+		//  Word bits
+		uint64_t ullWord = vBitmap[stWord];
+
+		while (ullWord != 0)
+		{
+			vEntries.push_back((uint32_t)(stWord * 64 + GetLowestBit64(ullWord)));
+			ullWord &= ullWord - 1;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reads bytes from a mapped query index file, within its bounds
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const char*] chpData    :  mapped image
+//  [uint64_t] ullSize       :  mapped image size
+//  [uint64_t&] ullOffset    :  read offset (advanced past the bytes read)
+//  [void*] vpOut            :  bytes to return
+//  [uint64_t] ullBytes      :  byte count
+//                           :  returns true, if the bytes lie within the file; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+static bool ReadQueryIndexBytes(const char* chpData, uint64_t ullSize, uint64_t& ullOffset, void* vpOut, uint64_t ullBytes)
+{
+	if ((ullOffset > ullSize) || (ullBytes > ullSize - ullOffset))
+		return false;
+
+	if (ullBytes > 0)
+		memcpy(vpOut, chpData + ullOffset, (size_t)ullBytes);
+
+	ullOffset += ullBytes;
+
+	return true;
+}
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_Catalog_Query class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Catalog_Query::CBase123_Catalog_Query()
+{
+	try
+	{
+		ClearIndexes();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CBase123_Catalog_Query] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_Catalog_Query class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Catalog_Query::~CBase123_Catalog_Query()
+{
+	try
+	{
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [~CBase123_Catalog_Query] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Indexes the catalog; the query columns of all entries are read once (in parallel), then the value
+//      bitmaps and sorted ranges are built; unset entries (no accession) match no query
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [CBase123_Catalog&] b123Catalog:  catalog to index (open)
+//  [int] nMaxProcs                :  maximum processors for openMP
+//                                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Query::IndexCatalog(CBase123_Catalog& b123Catalog, int nMaxProcs)
+{
+	//  Categorical column values (lower-case), by query field, by entry
+	vector<string> vaValues[m_nQueryFields];
+	//  Sequence lengths, by entry
+	vector<int64_t> vLengths;
+	//  Dates, by entry (0, if none)
+	vector<int64_t> vDates;
+	//  Set entries, by entry
+	vector<char> vIsSet;
+	//  Range (value, entry) pairs
+	vector<pair<int64_t, long>> vRange;
+
+	try
+	{
+		if (nMaxProcs < 1)
+			nMaxProcs = 1;
+
+		ClearIndexes();
+
+		m_lEntryCount = b123Catalog.GetEntryCount();
+		m_stBitmapWords = (size_t)((m_lEntryCount + 63) / 64);
+		m_vSetBitmap.assign(m_stBitmapWords, 0);
+
+		for (int nField = 0; nField < m_nQueryFields; nField++)
+			vaValues[nField].resize(m_lEntryCount);
+		vLengths.assign(m_lEntryCount, 0);
+		vDates.assign(m_lEntryCount, 0);
+		vIsSet.assign(m_lEntryCount, 0);
+
+		//  Read the query columns
+		#pragma omp parallel for schedule(dynamic, 256) num_threads(nMaxProcs)
+		for (long lCount = 0; lCount < m_lEntryCount; lCount++)
+		{
+			if (!b123Catalog.GetColumnByIndex(lCount, 0).empty())
+			{
+				vIsSet[lCount] = 1;
+
+				for (int nField = 0; nField < m_nQueryFields; nField++)
+					vaValues[nField][lCount] = ConvertStringToLowerCase(b123Catalog.GetColumnByIndex(lCount, m_staQueryFields[nField].nColumn));
+
+				vLengths[lCount] = strtoll(b123Catalog.GetColumnByIndex(lCount, m_nQueryLengthColumn).c_str(), NULL, 10);
+				vDates[lCount] = GetQueryDate(b123Catalog.GetColumnByIndex(lCount, m_nQueryDateColumn), false);
+			}
+		}
+
+		//  Value bitmaps
+		for (long lCount = 0; lCount < m_lEntryCount; lCount++)
+		{
+			if (vIsSet[lCount])
+			{
+				m_vSetBitmap[lCount >> 6] |= (1ULL << (lCount & 63));
+
+				for (int nField = 0; nField < m_nQueryFields; nField++)
+				{
+					//  Value bitmap
+					vector<uint64_t>& vBitmap = m_umaValueBitmaps[nField][vaValues[nField][lCount]];
+
+					if (vBitmap.empty())
+						vBitmap.assign(m_stBitmapWords, 0);
+
+					vBitmap[lCount >> 6] |= (1ULL << (lCount & 63));
+				}
+			}
+		}
+
+		//  Sorted lengths
+		for (long lCount = 0; lCount < m_lEntryCount; lCount++)
+		{
+			if (vIsSet[lCount])
+				vRange.push_back(make_pair(vLengths[lCount], lCount));
+		}
+
+		sort(vRange.begin(), vRange.end());
+
+		m_vLengthValues.resize(vRange.size());
+		m_vLengthIndices.resize(vRange.size());
+		for (size_t stCount = 0; stCount < vRange.size(); stCount++)
+		{
+			m_vLengthValues[stCount] = vRange[stCount].first;
+			m_vLengthIndices[stCount] = vRange[stCount].second;
+		}
+
+		//  Sorted dates
+		vRange.clear();
+		for (long lCount = 0; lCount < m_lEntryCount; lCount++)
+		{
+			if ((vIsSet[lCount]) && (vDates[lCount] > 0))
+				vRange.push_back(make_pair(vDates[lCount], lCount));
+		}
+
+		sort(vRange.begin(), vRange.end());
+
+		m_vDateValues.resize(vRange.size());
+		m_vDateIndices.resize(vRange.size());
+		for (size_t stCount = 0; stCount < vRange.size(); stCount++)
+		{
+			m_vDateValues[stCount] = vRange[stCount].first;
+			m_vDateIndices[stCount] = vRange[stCount].second;
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [IndexCatalog] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Queries the indexed catalog (see Base123_Catalog_Query.h for the query syntax)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strQuery        :  query
+//  [vector<long>&] vIndices :  matching entry indices, in catalog order
+//                           :  returns true, if successful (the query is well formed); else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Query::Query(string strQuery, vector<long>& vIndices)
+{
+	//  Query clauses (OR)
+	vector<string> vClauses;
+	//  Query result bitmap
+	vector<uint64_t> vResult;
+
+	try
+	{
+		vIndices.clear();
+
+		SplitString(strQuery, '|', vClauses);
+
+		//  If the query is not empty
+		if (vClauses.size() > 0)
+		{
+			vResult.assign(m_stBitmapWords, 0);
+
+			for (size_t stClause = 0; stClause < vClauses.size(); stClause++)
+			{
+				//  Clause terms (AND)
+				vector<string> vTerms;
+				//  Clause bitmap
+				vector<uint64_t> vClause = m_vSetBitmap;
+
+				SplitString(vClauses[stClause], '&', vTerms);
+
+				for (size_t stTerm = 0; stTerm < vTerms.size(); stTerm++)
+				{
+					//  Term bitmap
+					vector<uint64_t> vTerm;
+
+					if (!GetTermBitmap(vTerms[stTerm], vTerm))
+						return false;
+
+					for (size_t stWord = 0; stWord < m_stBitmapWords; stWord++)
+						vClause[stWord] &= vTerm[stWord];
+				}
+
+				for (size_t stWord = 0; stWord < m_stBitmapWords; stWord++)
+					vResult[stWord] |= vClause[stWord];
+			}
+
+			//  Matching entries
+			for (size_t stWord = 0; stWord < m_stBitmapWords; stWord++)
+			{
+				//  Word bits
+				uint64_t ullWord = vResult[stWord];
+
+				while (ullWord != 0)
+				{
+					vIndices.push_back((long)(stWord * 64 + GetLowestBit64(ullWord)));
+					ullWord &= ullWord - 1;
+				}
+			}
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[Query]", "ERROR:  Query is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [Query] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes the indexes to a query index file, keyed to the compiled catalog they index (see
+//      Base123_Catalog_Query.h for the layout); categorical bitmaps are written as entry lists
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strOutputFilePathName                :  query index file path name
+//  [structBinaryCatalogHeader&] stCatalogHeader  :  compiled catalog header
+//  [uint64_t] ullCatalogSize                     :  compiled catalog file size
+//                                                :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Query::WriteIndexes(string strOutputFilePathName, structBinaryCatalogHeader& stCatalogHeader, uint64_t ullCatalogSize)
+{
+	//  Header
+	structQueryIndexHeader stHeader;
+	//  Entries (value entries, or range entries)
+	vector<uint32_t> vEntries;
+	//  Output file
+	ofstream oFile;
+
+	try
+	{
+		//  If the file path name is not empty
+		if (!strOutputFilePathName.empty())
+		{
+			//  If the indexes cover the compiled catalog
+			if ((uint64_t)m_lEntryCount == stCatalogHeader.ullEntryCount)
+			{
+				memset(&stHeader, 0, sizeof(stHeader));
+				memcpy(stHeader.chaMagic, m_chaQueryIndexMagic, sizeof(stHeader.chaMagic));
+				stHeader.untVersion = m_untQueryIndexVersion;
+				stHeader.untFieldCount = m_nQueryFields;
+				stHeader.ullCatalogSize = ullCatalogSize;
+				memcpy(&stHeader.stCatalogHeader, &stCatalogHeader, sizeof(stHeader.stCatalogHeader));
+				stHeader.ullEntryCount = (uint64_t)m_lEntryCount;
+				stHeader.ullLengthCount = m_vLengthValues.size();
+				stHeader.ullDateCount = m_vDateValues.size();
+
+				oFile.open(strOutputFilePathName.c_str(), ios::out | ios::trunc | ios::binary);
+
+				if (oFile.is_open())
+				{
+					oFile.write((const char*)&stHeader, sizeof(stHeader));
+					if (m_stBitmapWords > 0)
+						oFile.write((const char*)&m_vSetBitmap[0], sizeof(uint64_t) * m_stBitmapWords);
+
+					//  Categorical values, by query field
+					for (int nField = 0; nField < m_nQueryFields; nField++)
+					{
+						//  Value count
+						uint64_t ullValueCount = m_umaValueBitmaps[nField].size();
+
+						oFile.write((const char*)&ullValueCount, sizeof(ullValueCount));
+
+						for (auto itValue = m_umaValueBitmaps[nField].begin(); itValue != m_umaValueBitmaps[nField].end(); itValue++)
+						{
+							//  Value length and entry count
+							uint32_t untValueLength = (uint32_t)itValue->first.length();
+							uint32_t untEntryCount = 0;
+
+							GetBitmapEntries(itValue->second, vEntries);
+							untEntryCount = (uint32_t)vEntries.size();
+
+							oFile.write((const char*)&untValueLength, sizeof(untValueLength));
+							oFile.write((const char*)&untEntryCount, sizeof(untEntryCount));
+							oFile.write(itValue->first.data(), untValueLength);
+							if (!vEntries.empty())
+								oFile.write((const char*)&vEntries[0], sizeof(uint32_t) * vEntries.size());
+						}
+					}
+
+					//  Sorted lengths
+					vEntries.assign(m_vLengthIndices.begin(), m_vLengthIndices.end());
+					if (!vEntries.empty())
+					{
+						oFile.write((const char*)&m_vLengthValues[0], sizeof(int64_t) * m_vLengthValues.size());
+						oFile.write((const char*)&vEntries[0], sizeof(uint32_t) * vEntries.size());
+					}
+
+					//  Sorted dates
+					vEntries.assign(m_vDateIndices.begin(), m_vDateIndices.end());
+					if (!vEntries.empty())
+					{
+						oFile.write((const char*)&m_vDateValues[0], sizeof(int64_t) * m_vDateValues.size());
+						oFile.write((const char*)&vEntries[0], sizeof(uint32_t) * vEntries.size());
+					}
+
+					//  Write status
+					bool bWritten = oFile.good();
+
+					oFile.close();
+
+					if (bWritten)
+						return true;
+					else
+					{
+						ReportTimeStamp("[WriteIndexes]", "ERROR:  Query Index File [" + strOutputFilePathName + "] Write Failed");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[WriteIndexes]", "ERROR:  Query Index File [" + strOutputFilePathName + "] Create/Open Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[WriteIndexes]", "ERROR:  Indexed Entry Count [" + ConvertLongToString(m_lEntryCount) + "] Does Not Match Compiled Catalog Entry Count [" + ConvertLongToString((long)stCatalogHeader.ullEntryCount) + "]");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[WriteIndexes]", "ERROR:  Query Index File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteIndexes] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Opens the indexes from a query index file; the file must be keyed to the compiled catalog given
+//      (same header and size), so a catalog recompiled since the indexes were written is not queried
+//      with stale indexes; a missing, stale or malformed file is not reported (the caller rebuilds)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathName                 :  query index file path name
+//  [structBinaryCatalogHeader&] stCatalogHeader  :  compiled catalog header
+//  [uint64_t] ullCatalogSize                     :  compiled catalog file size
+//                                                :  returns true, if the indexes are opened; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Query::OpenIndexes(string strInputFilePathName, structBinaryCatalogHeader& stCatalogHeader, uint64_t ullCatalogSize)
+{
+	//  Mapped query index file
+	CBase123_Mapped_File b123MappedFile;
+	//  Header
+	structQueryIndexHeader stHeader;
+	//  Read offset
+	uint64_t ullOffset = 0;
+	//  Entries (value entries, or range entries)
+	vector<uint32_t> vEntries;
+	//  Indexes are valid, if true
+	bool bIsValid = false;
+
+	try
+	{
+		ClearIndexes();
+
+		//  If the query index file is present
+		if ((IsFilePresent(strInputFilePathName)) && (b123MappedFile.OpenMappedFile(strInputFilePathName)))
+		{
+			//  Mapped image
+			const char* chpData = b123MappedFile.GetData();
+			uint64_t ullSize = b123MappedFile.GetSize();
+
+			memset(&stHeader, 0, sizeof(stHeader));
+
+			//  If the query index file is keyed to the compiled catalog
+			if ((ReadQueryIndexBytes(chpData, ullSize, ullOffset, &stHeader, sizeof(stHeader))) &&
+				(memcmp(stHeader.chaMagic, m_chaQueryIndexMagic, sizeof(stHeader.chaMagic)) == 0) &&
+				(stHeader.untVersion == m_untQueryIndexVersion) && (stHeader.untFieldCount == (uint32_t)m_nQueryFields) &&
+				(stHeader.ullCatalogSize == ullCatalogSize) && (memcmp(&stHeader.stCatalogHeader, &stCatalogHeader, sizeof(stCatalogHeader)) == 0) &&
+				(stHeader.ullEntryCount == stCatalogHeader.ullEntryCount) &&
+				(stHeader.ullLengthCount <= stHeader.ullEntryCount) && (stHeader.ullDateCount <= stHeader.ullEntryCount))
+			{
+				m_lEntryCount = (long)stHeader.ullEntryCount;
+				m_stBitmapWords = (size_t)((m_lEntryCount + 63) / 64);
+				m_vSetBitmap.assign(m_stBitmapWords, 0);
+
+				bIsValid = ReadQueryIndexBytes(chpData, ullSize, ullOffset, m_vSetBitmap.data(), sizeof(uint64_t) * m_stBitmapWords);
+
+				//  Categorical values, by query field
+				for (int nField = 0; (bIsValid) && (nField < m_nQueryFields); nField++)
+				{
+					//  Value count
+					uint64_t ullValueCount = 0;
+
+					bIsValid = ReadQueryIndexBytes(chpData, ullSize, ullOffset, &ullValueCount, sizeof(ullValueCount)) && (ullValueCount <= stHeader.ullEntryCount);
+
+					for (uint64_t ullValue = 0; (bIsValid) && (ullValue < ullValueCount); ullValue++)
+					{
+						//  Value length and entry count
+						uint32_t untValueLength = 0;
+						uint32_t untEntryCount = 0;
+						//  Value
+						string strValue = "";
+
+						bIsValid = (ReadQueryIndexBytes(chpData, ullSize, ullOffset, &untValueLength, sizeof(untValueLength))) &&
+							(ReadQueryIndexBytes(chpData, ullSize, ullOffset, &untEntryCount, sizeof(untEntryCount))) &&
+							(untValueLength <= ullSize - ullOffset) && (untEntryCount <= stHeader.ullEntryCount);
+
+						if (bIsValid)
+						{
+							strValue.assign(chpData + ullOffset, untValueLength);
+							ullOffset += untValueLength;
+
+							vEntries.resize(untEntryCount);
+							bIsValid = ReadQueryIndexBytes(chpData, ullSize, ullOffset, vEntries.data(), sizeof(uint32_t) * vEntries.size());
+						}
+
+						if (bIsValid)
+						{
+							//  Value bitmap
+							vector<uint64_t>& vBitmap = m_umaValueBitmaps[nField][strValue];
+
+							vBitmap.assign(m_stBitmapWords, 0);
+
+							for (size_t stCount = 0; (bIsValid) && (stCount < vEntries.size()); stCount++)
+							{
+								bIsValid = (vEntries[stCount] < stHeader.ullEntryCount);
+
+								if (bIsValid)
+									vBitmap[vEntries[stCount] >> 6] |= (1ULL << (vEntries[stCount] & 63));
+							}
+						}
+					}
+				}
+
+				//  Sorted lengths
+				if (bIsValid)
+				{
+					m_vLengthValues.resize((size_t)stHeader.ullLengthCount);
+					vEntries.resize((size_t)stHeader.ullLengthCount);
+
+					bIsValid = (ReadQueryIndexBytes(chpData, ullSize, ullOffset, m_vLengthValues.data(), sizeof(int64_t) * m_vLengthValues.size())) &&
+						(ReadQueryIndexBytes(chpData, ullSize, ullOffset, vEntries.data(), sizeof(uint32_t) * vEntries.size()));
+
+					m_vLengthIndices.assign(vEntries.begin(), vEntries.end());
+					for (size_t stCount = 0; (bIsValid) && (stCount < vEntries.size()); stCount++)
+						bIsValid = (vEntries[stCount] < stHeader.ullEntryCount);
+				}
+
+				//  Sorted dates
+				if (bIsValid)
+				{
+					m_vDateValues.resize((size_t)stHeader.ullDateCount);
+					vEntries.resize((size_t)stHeader.ullDateCount);
+
+					bIsValid = (ReadQueryIndexBytes(chpData, ullSize, ullOffset, m_vDateValues.data(), sizeof(int64_t) * m_vDateValues.size())) &&
+						(ReadQueryIndexBytes(chpData, ullSize, ullOffset, vEntries.data(), sizeof(uint32_t) * vEntries.size()));
+
+					m_vDateIndices.assign(vEntries.begin(), vEntries.end());
+					for (size_t stCount = 0; (bIsValid) && (stCount < vEntries.size()); stCount++)
+						bIsValid = (vEntries[stCount] < stHeader.ullEntryCount);
+				}
+
+				//  If the whole file is read
+				if ((bIsValid) && (ullOffset == ullSize))
+					return true;
+			}
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [OpenIndexes] Exception Code:  " << ex.what() << "\n";
+	}
+
+	ClearIndexes();
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the indexed entry count
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the entry count
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_Catalog_Query::GetEntryCount()
+{
+	return m_lEntryCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets a date as a sortable number (yyyymmdd); accepts catalog dates (dd-mon-yyyy, mon-yyyy,
+//      yyyy) and yyyy[-mm[-dd]]; parts not given are 00 (lower bound) or 99 (upper bound), so a
+//      partial date bound covers the whole year or month
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strDate      :  date to convert
+//  [bool] bIsUpperBound  :  fill parts not given as an upper bound, if true; else, as a lower bound
+//                        :  returns the date (yyyymmdd), if a year is found; else, 0
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_Catalog_Query::GetQueryDate(string strDate, bool bIsUpperBound)
+{
+	//  Date parts
+	vector<string> vParts;
+	//  Date part
+	string strPart = "";
+	//  Year, month and day
+	long lYear = 0;
+	long lMonth = 0;
+	long lDay = 0;
+	//  Year part position
+	int nYearPart = -1;
+	//  Month is named (dd-mon-yyyy), if true
+	bool bIsNamedMonth = false;
+
+	try
+	{
+		//  Split the date on '-', '/' and ' '
+		for (size_t stCount = 0; stCount <= strDate.length(); stCount++)
+		{
+			if ((stCount == strDate.length()) || (strDate[stCount] == '-') || (strDate[stCount] == '/') || (strDate[stCount] == ' '))
+			{
+				if (!strPart.empty())
+					vParts.push_back(strPart);
+
+				strPart = "";
+			}
+			else
+				strPart += (char)tolower((unsigned char)strDate[stCount]);
+		}
+
+		//  Year and named month
+		for (int nPart = 0; nPart < (int)vParts.size(); nPart++)
+		{
+			if ((vParts[nPart].length() == 4) && (isdigit((unsigned char)vParts[nPart][0])))
+			{
+				lYear = strtol(vParts[nPart].c_str(), NULL, 10);
+				nYearPart = nPart;
+			}
+			else if ((vParts[nPart].length() >= 3) && (isalpha((unsigned char)vParts[nPart][0])))
+			{
+				for (int nMonth = 0; nMonth < 12; nMonth++)
+				{
+					if (vParts[nPart].compare(0, 3, m_chpaQueryMonths[nMonth]) == 0)
+					{
+						lMonth = nMonth + 1;
+						bIsNamedMonth = true;
+					}
+				}
+			}
+		}
+
+		//  If a year is found
+		if (lYear > 0)
+		{
+			//  Day (dd-mon-yyyy), or month and day (yyyy-mm-dd)
+			for (int nPart = 0; nPart < (int)vParts.size(); nPart++)
+			{
+				if ((nPart != nYearPart) && (vParts[nPart].length() <= 2) && (isdigit((unsigned char)vParts[nPart][0])))
+				{
+					if (bIsNamedMonth)
+					{
+						if (lDay == 0)
+							lDay = strtol(vParts[nPart].c_str(), NULL, 10);
+					}
+					else if (nPart > nYearPart)
+					{
+						if (lMonth == 0)
+							lMonth = strtol(vParts[nPart].c_str(), NULL, 10);
+						else if (lDay == 0)
+							lDay = strtol(vParts[nPart].c_str(), NULL, 10);
+					}
+				}
+			}
+
+			if ((lMonth < 1) || (lMonth > 12))
+				lMonth = bIsUpperBound ? 99 : 0;
+			if ((lDay < 1) || (lDay > 31))
+				lDay = bIsUpperBound ? 99 : 0;
+
+			return lYear * 10000 + lMonth * 100 + lDay;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetQueryDate] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return 0;
+}
+
+//  Implementation (private)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the entry bitmap of one query term
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strTerm               :  query term (<field>=<value>)
+//  [vector<uint64_t>&] vBitmap    :  matching entries bitmap
+//                                 :  returns true, if successful (the term is well formed); else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Query::GetTermBitmap(string strTerm, vector<uint64_t>& vBitmap)
+{
+	//  Field and value
+	string strField = "";
+	string strValue = "";
+	//  Range bounds
+	string strMin = "";
+	string strMax = "";
+	int64_t llMin = LLONG_MIN;
+	int64_t llMax = LLONG_MAX;
+	//  Separator position
+	size_t stSeparator = 0;
+
+	try
+	{
+		vBitmap.assign(m_stBitmapWords, 0);
+
+		stSeparator = strTerm.find('=');
+
+		//  If the term is properly formatted
+		if (stSeparator != string::npos)
+		{
+			strField = ConvertStringToLowerCase(GetTrimmedString(strTerm.substr(0, stSeparator)));
+			strValue = ConvertStringToLowerCase(GetTrimmedString(strTerm.substr(stSeparator + 1)));
+
+			//  Range fields
+			if ((strField == "length") || (strField == "date"))
+			{
+				stSeparator = strValue.find(':');
+
+				if (stSeparator != string::npos)
+				{
+					strMin = GetTrimmedString(strValue.substr(0, stSeparator));
+					strMax = GetTrimmedString(strValue.substr(stSeparator + 1));
+				}
+				else
+				{
+					strMin = strValue;
+					strMax = strValue;
+				}
+
+				if (strField == "length")
+				{
+					if (((strMin.empty()) || (stringstream(strMin) >> llMin)) && ((strMax.empty()) || (stringstream(strMax) >> llMax)))
+						return GetRangeBitmap(m_vLengthValues, m_vLengthIndices, llMin, llMax, vBitmap);
+					else
+					{
+						ReportTimeStamp("[GetTermBitmap]", "ERROR:  Query Term [" + strTerm + "] Length is Not a Number");
+					}
+				}
+				else
+				{
+					if (!strMin.empty())
+						llMin = GetQueryDate(strMin, false);
+					if (!strMax.empty())
+						llMax = GetQueryDate(strMax, true);
+
+					if ((llMin != 0) && (llMax != 0))
+						return GetRangeBitmap(m_vDateValues, m_vDateIndices, llMin, llMax, vBitmap);
+					else
+					{
+						ReportTimeStamp("[GetTermBitmap]", "ERROR:  Query Term [" + strTerm + "] Date is Not Recognized");
+					}
+				}
+			}
+			//  Categorical fields
+			else
+			{
+				for (int nField = 0; nField < m_nQueryFields; nField++)
+				{
+					if (strField == m_staQueryFields[nField].chpName)
+					{
+						//  Value prefix
+						if ((!strValue.empty()) && (strValue[strValue.length() - 1] == '*'))
+						{
+							strValue.erase(strValue.length() - 1);
+
+							for (auto itValue = m_umaValueBitmaps[nField].begin(); itValue != m_umaValueBitmaps[nField].end(); itValue++)
+							{
+								if (itValue->first.compare(0, strValue.length(), strValue) == 0)
+								{
+									for (size_t stWord = 0; stWord < m_stBitmapWords; stWord++)
+										vBitmap[stWord] |= itValue->second[stWord];
+								}
+							}
+						}
+						//  Value
+						else
+						{
+							auto itValue = m_umaValueBitmaps[nField].find(strValue);
+
+							if (itValue != m_umaValueBitmaps[nField].end())
+								vBitmap = itValue->second;
+						}
+
+						return true;
+					}
+				}
+
+				ReportTimeStamp("[GetTermBitmap]", "ERROR:  Query Term [" + strTerm + "] Field is Not Recognized");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[GetTermBitmap]", "ERROR:  Query Term [" + strTerm + "] is Not Properly Formatted");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetTermBitmap] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the entry bitmap of a sorted range (binary search for the bounds)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<int64_t>&] vValues  :  values, ascending
+//  [vector<long>&] vIndices    :  entries, by value
+//  [int64_t] llMin             :  minimum value (inclusive)
+//  [int64_t] llMax             :  maximum value (inclusive)
+//  [vector<uint64_t>&] vBitmap :  matching entries bitmap
+//                              :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Query::GetRangeBitmap(vector<int64_t>& vValues, vector<long>& vIndices, int64_t llMin, int64_t llMax, vector<uint64_t>& vBitmap)
+{
+	//  Range
+	vector<int64_t>::iterator itFirst;
+	vector<int64_t>::iterator itLast;
+
+	try
+	{
+		vBitmap.assign(m_stBitmapWords, 0);
+
+		if (llMin <= llMax)
+		{
+			itFirst = lower_bound(vValues.begin(), vValues.end(), llMin);
+			itLast = upper_bound(itFirst, vValues.end(), llMax);
+
+			for (size_t stCount = itFirst - vValues.begin(); stCount < (size_t)(itLast - vValues.begin()); stCount++)
+				vBitmap[vIndices[stCount] >> 6] |= (1ULL << (vIndices[stCount] & 63));
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetRangeBitmap] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Clears the indexes
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Catalog_Query::ClearIndexes()
+{
+	try
+	{
+		m_lEntryCount = 0;
+		m_stBitmapWords = 0;
+		m_vSetBitmap.clear();
+
+		for (int nField = 0; nField < m_nQueryFields; nField++)
+			m_umaValueBitmaps[nField].clear();
+
+		m_vLengthValues.clear();
+		m_vLengthIndices.clear();
+		m_vDateValues.clear();
+		m_vDateIndices.clear();
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ClearIndexes] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets a string without leading and trailing spaces and tabs
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strIn:  string to trim
+//                :  returns the trimmed string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string CBase123_Catalog_Query::GetTrimmedString(string strIn)
+{
+	//  Trimmed bounds
+	size_t stFirst = strIn.find_first_not_of(" \t");
+	size_t stLast = strIn.find_last_not_of(" \t");
+
+	if (stFirst != string::npos)
+		return strIn.substr(stFirst, stLast - stFirst + 1);
+
+	return "";
+}
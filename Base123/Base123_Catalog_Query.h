@@ -0,0 +1,146 @@
+// Base123_Catalog_Query.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Catalog_Query class (header) indexes catalog columns for queries; each categorical field
+//      (molecule type, strandedness, completeness, host, viral group) holds one entry bitmap per value,
+//      and length and date are held as sorted (value, entry) arrays, so a query term is a hash lookup
+//      or a binary search and terms are combined with bitmap AND/OR; query syntax:
+//
+//      <term>[&<term>...][|<term>[&<term>...]...]   (& binds tighter than |)
+//      <term> = <field>=<value>                     (categorical; <value>* matches a value prefix)
+//             | length=[<min>]:[<max>]              (inclusive; either bound may be omitted)
+//             | date=[<min>]:[<max>]                (inclusive; yyyy[-mm[-dd]] or dd-mon-yyyy)
+//
+//      the indexes of a compiled catalog are saved beside it (<catalog>.qidx) and loaded by later
+//      queries, so the catalog is not reparsed; the index file is keyed to the compiled catalog
+//      header and size, and a stale or missing index file is rebuilt (and rewritten) on query;
+//      index file layout:
+//
+//      structQueryIndexHeader
+//      uint64_t[bitmap words]                   (set entries bitmap)
+//      by query field:  uint64_t value count, then by value:  uint32_t value length, uint32_t
+//                       entry count, value bytes, uint32_t[entry count] (entries, ascending)
+//      int64_t[length count], uint32_t[length count]   (sorted lengths, and their entries)
+//      int64_t[date count], uint32_t[date count]       (sorted dates, and their entries)
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Base123_Catalog_Binary.h"
+
+class CBase123_Catalog;
+
+//  Query categorical field
+struct structQueryField
+{
+	//  Field name (query syntax)
+	const char* chpName;
+	//  Entry column (catalog column order)
+	int nColumn;
+};
+
+//  Query categorical field count
+const int m_nQueryFields = 5;
+//  Query categorical fields
+const structQueryField m_staQueryFields[m_nQueryFields] =
+{
+	{ "molecule_type", 3 },
+	{ "strandedness", 4 },
+	{ "completeness", 10 },
+	{ "host", 12 },
+	{ "viral_group", 20 }
+};
+//  Query range field:  sequence length (entry column)
+const int m_nQueryLengthColumn = 2;
+//  Query range field:  date (entry column)
+const int m_nQueryDateColumn = 11;
+
+//  Query index file magic
+const char m_chaQueryIndexMagic[8] = { 'B', '1', '2', '3', 'Q', 'I', 'D', 'X' };
+//  Query index file version
+const uint32_t m_untQueryIndexVersion = 1;
+//  Query index file extension (appended to the compiled catalog file path name)
+const char m_chaQueryIndexExtension[] = ".qidx";
+
+//  Query index file header
+struct structQueryIndexHeader
+{
+	//  Magic
+	char chaMagic[8];
+	//  Version
+	uint32_t untVersion;
+	//  Query field count
+	uint32_t untFieldCount;
+	//  Compiled catalog file size
+	uint64_t ullCatalogSize;
+	//  Compiled catalog header
+	structBinaryCatalogHeader stCatalogHeader;
+	//  Entry count
+	uint64_t ullEntryCount;
+	//  Sorted length count
+	uint64_t ullLengthCount;
+	//  Sorted date count
+	uint64_t ullDateCount;
+};
+
+class CBase123_Catalog_Query
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_Catalog_Query();
+	//  Destructor
+	virtual ~CBase123_Catalog_Query();
+
+	//  Interface (public)
+
+public:
+
+	bool IndexCatalog(CBase123_Catalog& b123Catalog, int nMaxProcs);
+	bool Query(string strQuery, vector<long>& vIndices);
+	bool WriteIndexes(string strOutputFilePathName, structBinaryCatalogHeader& stCatalogHeader, uint64_t ullCatalogSize);
+	bool OpenIndexes(string strInputFilePathName, structBinaryCatalogHeader& stCatalogHeader, uint64_t ullCatalogSize);
+	long GetEntryCount();
+
+	static long GetQueryDate(string strDate, bool bIsUpperBound);
+
+	//  Implementation (private)
+
+private:
+
+	bool GetTermBitmap(string strTerm, vector<uint64_t>& vBitmap);
+	bool GetRangeBitmap(vector<int64_t>& vValues, vector<long>& vIndices, int64_t llMin, int64_t llMax, vector<uint64_t>& vBitmap);
+	bool ClearIndexes();
+
+	static string GetTrimmedString(string strIn);
+
+	//  Entry count (bitmap size, bits)
+	long m_lEntryCount;
+	//  Bitmap size, words
+	size_t m_stBitmapWords;
+	//  Set entries bitmap
+	vector<uint64_t> m_vSetBitmap;
+	//  Categorical bitmaps (lower-case value, entry bitmap), by query field
+	unordered_map<string, vector<uint64_t>> m_umaValueBitmaps[m_nQueryFields];
+	//  Sequence lengths, ascending, and their entries
+	vector<int64_t> m_vLengthValues;
+	vector<long> m_vLengthIndices;
+	//  Dates (yyyymmdd; unknown parts 00), ascending, and their entries (entries without a date are not held)
+	vector<int64_t> m_vDateValues;
+	vector<long> m_vDateIndices;
+};
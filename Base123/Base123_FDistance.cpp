@@ -21,7 +21,14 @@
 #include "Base123_Utilities.h"
 #include "Base123_FDistance_16.h"
 #include "Base123_FDistance_32.h"
+#include "Base123_FDistance_AA.h"
+#include "Base123_Background_Export.h"
+#include "Base123_Results_Store.h"
+#include "Base123_Sequence_Profile.h"
+#include "Base123_Shuffler.h"
+#include "Base123_FRESH.h"
 #include "Base123_FDistance.h"
+#include "Base123_MPI.h"
 
 #include <math.h>
 #include <sstream>
@@ -33,25 +40,24 @@
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string] strInputFilePathName  :  input FA format file path name
-//  [bool] bUseStrictFilter        :  use strict filter, if true; else, use lax filter
-//  [int] nMaxPolyLimit            :  maximum poly-character limit
-//  [string&] strAcceptListFileText:  output list file text
-//  [string&] strRejectListFileText:  output list file text
-//                                :  returns true, if successful; else, false
+//  [string] strInputFilePathName           :  input FA format file path name
+//  [CBase123_Sequence_Archive&] b123Archive:  sequence archive (if open, the file is read from the archive)
+//  [bool] bUseStrictFilter                 :  use strict filter, if true; else, use lax filter
+//  [int] nMaxPolyLimit                     :  maximum poly-character limit
+//  [string&] strAcceptListFileText         :  output list file text
+//  [string&] strRejectListFileText         :  output list file text
+//                                          :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool FilterFileForFDistance(string strInputFilePathName, bool bUseStrictFilter, int nMaxPolyLimit, string& strAcceptListFileText, string& strRejectListFileText)
+bool FilterFileForFDistance(string strInputFilePathName, CBase123_Sequence_Archive& b123Archive, bool bUseStrictFilter, int nMaxPolyLimit, string& strAcceptListFileText, string& strRejectListFileText)
 {
 	//  Input file text
 	string strInputFileText = "";
-	//  File header and text
-	vector<string> vFileParts;
-	//  Reject entry
-	string strRejectEntry = "";
-	//  Poly string
-	string strPoly = "";
+	//  Sequence profile
+	structSequenceProfile stProfile;
+	//  Strict filter characters, in reject entry order
+	const string strStrictCharacters = "nrykmswbdhv";
 	//  Accepted, if true; else, rejected
 	bool bAccept = true;
 
@@ -61,13 +67,10 @@ bool FilterFileForFDistance(string strInputFilePathName, bool bUseStrictFilter,
 		if (!strInputFilePathName.empty())
 		{
 			//  Get file text
-			if (GetFileText(strInputFilePathName, strInputFileText))
+			if (b123Archive.GetFAFileText(strInputFilePathName, strInputFileText))
 			{
-				//  Get file parts
-				SplitString(strInputFileText, '\n', vFileParts);
-
-				//  If  the file parts are not empty
-				if ((vFileParts.size() >= 2) && (!vFileParts[1].empty()))
+				//  Profile the sequence line in a single pass (no line split)
+				if (GetFASequenceProfile(strInputFileText, stProfile) && (stProfile.ullLength > 0))
 				{
 					//  Set reject entry leader
 					string strRejectEntry = strInputFilePathName;
@@ -90,7 +93,7 @@ bool FilterFileForFDistance(string strInputFilePathName, bool bUseStrictFilter,
 					// "File~Gap (y/n)~Poly-n (y/n)~
 					// "Strict - n(y / n)~Strict - r(y / n)~Strict - y(y / n)~Strict - k(y / n)~Strict - m(y / n)~Strict - s(y / n)~Strict - w(y / n)~Strict - b(y / n)~Strict - d(y / n)~Strict - h(y / n)~Strict - v(y / n)\n";
 
-					if (vFileParts[1].find_first_of("-") != string::npos)
+					if (GetProfileGapCount(stProfile) > 0)
 					{
 						bAccept = false;
 						strRejectEntry += "~y";
@@ -98,8 +101,8 @@ bool FilterFileForFDistance(string strInputFilePathName, bool bUseStrictFilter,
 					else
 						strRejectEntry += "~n";
 
-					strPoly = PadString("", "n", nMaxPolyLimit, false);
-					if (vFileParts[1].find(strPoly) != string::npos)
+					//  A poly limit of zero rejects every sequence, as the empty poly-n string always matched
+					if ((nMaxPolyLimit <= 0) || (GetProfileLongestRun(stProfile, 'n') >= (uint64_t)nMaxPolyLimit))
 					{
 						bAccept = false;
 						strRejectEntry += "~y";
@@ -109,93 +112,16 @@ bool FilterFileForFDistance(string strInputFilePathName, bool bUseStrictFilter,
 
 					if (bUseStrictFilter)
 					{
-						if (vFileParts[1].find_first_of("n") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("r") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("y") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("k") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("m") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("s") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("w") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("b") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("d") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("h") != string::npos)
-						{
-							bAccept = false;
-							strRejectEntry += "~y";
-						}
-						else
-							strRejectEntry += "~n";
-
-						if (vFileParts[1].find_first_of("v") != string::npos)
+						for (size_t ulCount = 0; ulCount < strStrictCharacters.length(); ulCount++)
 						{
-							bAccept = false;
-							strRejectEntry += "~y";
+							if (stProfile.ullaCounts[(unsigned char)strStrictCharacters[ulCount]] > 0)
+							{
+								bAccept = false;
+								strRejectEntry += "~y";
+							}
+							else
+								strRejectEntry += "~n";
 						}
-						else
-							strRejectEntry += "~n";
 					}
 
 					if (bAccept)
@@ -241,13 +167,16 @@ bool FilterFileForFDistance(string strInputFilePathName, bool bUseStrictFilter,
 //  [string] strAcceptOutputListFilePathName:  accept output list file path name
 //  [string] strRejectOutputListFilePathName:  reject output list file path name
 //  [int] nMaxProcs                         :  maximum processors for openMP
+//  [string] strArchiveFilePathName         :  sequence archive file path name [optional; if set, files are read from the archive]
 //                                         :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
 bool ListFilterForFDistance(string strInputFilePathNameList, string strInputFilePathNameTransform, bool bUseStrictFilter, int nMaxPolyLimit, string strAcceptOutputListFilePathName,
-	string strRejectOutputListFilePathName, int nMaxProcs)
+	string strRejectOutputListFilePathName, int nMaxProcs, string strArchiveFilePathName)
 {
+	//  Sequence archive (files are read, unless opened)
+	CBase123_Sequence_Archive b123Archive;
 	//  List lock
 	omp_lock_t lockList;
 	//  List file text
@@ -267,6 +196,14 @@ bool ListFilterForFDistance(string strInputFilePathNameList, string strInputFile
 
 	try
 	{
+		//  Open the sequence archive, if set
+		if ((!strArchiveFilePathName.empty()) && (!b123Archive.OpenArchive(strArchiveFilePathName)))
+		{
+			ReportTimeStamp("[ListFilterForFDistance]", "ERROR:  Sequence Archive [" + strArchiveFilePathName + "] Open Failed");
+
+			return false;
+		}
+
 		//  If input file path name list is not empty
 		if (!strInputFilePathNameList.empty())
 		{
@@ -321,7 +258,7 @@ bool ListFilterForFDistance(string strInputFilePathNameList, string strInputFile
 									strWorkingFilePathName = vFilePathNames[lCount];
 
 								//  Filter file for F-Distance suitability
-								if (!FilterFileForFDistance(strWorkingFilePathName, bUseStrictFilter, nMaxPolyLimit, vAcceptListEntries[lCount], vRejectListEntries[lCount]))
+								if (!FilterFileForFDistance(strWorkingFilePathName, b123Archive, bUseStrictFilter, nMaxPolyLimit, vAcceptListEntries[lCount], vRejectListEntries[lCount]))
 								{
 									vRejectListEntries[lCount] += strWorkingFilePathName;
 
@@ -584,10 +521,10 @@ bool ListContabulateFDistanceOutput(string strInputFilePathNameList, string strI
 					if (lMaxCatalogSize > 0)
 					{
 						//  Catalog
-						CBase123_Catalog bCatalog(lMaxCatalogSize);
+						CBase123_Catalog bCatalog(lMaxCatalogSize, true);
 
 						//  Open catalog
-						if (bCatalog.OpenCatalog(strCatalogFilePathName))
+						if (bCatalog.OpenCatalog(strCatalogFilePathName, nMaxProcs))
 						{
 							//  Get list file text
 							if (GetFileText(strInputFilePathNameList, strInputListFileText))
@@ -657,13 +594,13 @@ bool ListContabulateFDistanceOutput(string strInputFilePathNameList, string strI
 													//  If accession is not empty
 													if (!strAccession.empty())
 													{
-														CBase123_Catalog_Entry bceGet;
+														CBase123_Catalog_Entry* pbceGet = bCatalog.GetEntryPointerByAccession(strAccession);
 
 														//  If catalog search succeeds
-														if (bCatalog.GetEntryByAccession(strAccession, bceGet))
+														if (pbceGet != NULL)
 														{
 															//  Get entry demographics
-															vOutputTableEntries[lCount] = bceGet.GetDemographics();
+															vOutputTableEntries[lCount] = pbceGet->GetDemographics();
 
 															//  If entry demographics is not empty
 															if (!vOutputTableEntries[lCount].empty())
@@ -955,6 +892,337 @@ bool ListClearFDistanceOutput(string strInputFilePathNameList, string strInputFi
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Shuffles and scores a foreground genome file list in one pass against the resident background;
+//      each genome and its shuffle replicates are scored in memory (only the genome's .fdist file
+//      is written) and collected as results for contabulation
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputListFilePathName     :  foreground input file path name list (genomes, BIG .fa format)
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [CBase123_Catalog&] b123Catalog       :  Base123 foreground genome catalog to use
+//  [CBase123_Sequence_Archive&] b123Archive:  sequence archive (if open, files are read from the archive)
+//  [bool] bBidirectional                 :  process bidirectional, if true
+//  [int] nNMerLength                     :  nMer length to analyze (8 or 16)
+//  [bool] bAllowUnknowns                 :  process unknown chracters, if true
+//  [string] strOutputFileNameSuffix      :  output file name suffix
+//  [string] strErrorFilePathName         :  error file path name
+//  [int] nShuffleCount                   :  shuffle replicates per genome
+//  [bool] bStoreShuffles                 :  write each replicate sequence (<base>.sh_N.fa), if true
+//  [uint64_t] ullShuffleSeed             :  shuffle seed (each replicate is seeded by seed, accession and replicate index)
+//  [vector<string>&] vOutputTableEntries :  genome F-Distance table entries to set, one element per list entry
+//  [vector<structFDistanceResult>&] vResults:  genome and replicate results to append (rank 0)
+//  [int] nMaxProcs                       :  maximum processors for openMP
+//                                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessShuffleFDistanceList(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, CBase123_Sequence_Archive& b123Archive, bool bBidirectional, int nNMerLength, bool bAllowUnknowns,
+	string strOutputFileNameSuffix, string strErrorFilePathName, int nShuffleCount, bool bStoreShuffles, uint64_t ullShuffleSeed, vector<string>& vOutputTableEntries, vector<structFDistanceResult>& vResults, int nMaxProcs)
+{
+	//  List lock
+	omp_lock_t lockList;
+	//  Input list file text
+	string strInputListFileText = "";
+	//  File path name vector<string>
+	vector<string> vFilePathNames;
+	//  Replicate table entries, <replicate>|<table entry> lines, one element per list entry
+	vector<string> vShuffleEntries;
+	//  Error file text
+	vector<string> vErrorEntries;
+	//  Error output file text
+	string strErrorFileText = "";
+	//  List chunk start index
+	long lChunkStart = 0;
+	//  List chunk end index (exclusive)
+	long lChunkEnd = 0;
+	//  Foreground scoring function, by nMer length
+	bool (*fnProcessForeground)(string&, string&, string&, bool, bool, int, string&, vector<structCDS>*, string&) = NULL;
+	//  Path delimiter
+	char chrPathDelimiter = strPathDelimiter;
+
+	try
+	{
+		if (nNMerLength == 8)
+			fnProcessForeground = ProcessForeground16;
+		else if (nNMerLength == 16)
+			fnProcessForeground = ProcessForeground32;
+
+		//  If input list file path name is not empty
+		if (!strInputListFilePathName.empty())
+		{
+			//  If nMer length and shuffle count are set
+			if ((fnProcessForeground != NULL) && (nShuffleCount > 0))
+			{
+				//  Get list file text
+				if (GetFileText(strInputListFilePathName, strInputListFileText))
+				{
+					//  Split file path names
+					SplitString(strInputListFileText, '\n', vFilePathNames);
+
+					//  If vector contains file path names
+					if (vFilePathNames.size() > 0)
+					{
+						//  Initialize output, replicate and error vectors
+						vOutputTableEntries.resize(vFilePathNames.size());
+						vShuffleEntries.resize(vFilePathNames.size());
+						vErrorEntries.resize(vFilePathNames.size());
+
+						//  Initialize time stamp lock
+						omp_init_lock(&lockList);
+
+						//  Open the list in chunks; the whole list is one chunk, unless distributed across MPI ranks
+						OpenListChunksMPI((long)vFilePathNames.size(), true, (long)nMaxProcs);
+
+						//  Process the chunks of this rank
+						while (GetNextListChunkMPI(lChunkStart, lChunkEnd))
+						{
+							//  Chunk size
+							long lChunkSize = lChunkEnd - lChunkStart;
+							//  Working file path names
+							vector<string> vWorkingFilePathNames(lChunkSize);
+							//  FA headers
+							vector<string> vHeaders(lChunkSize);
+							//  Accessions
+							vector<string> vAccessions(lChunkSize);
+							//  Sequences (empty, if the entry failed to load)
+							vector<string> vSequences(lChunkSize);
+							//  Circular, if true
+							vector<bool> vCircular(lChunkSize, false);
+							//  Sorted CDS starts and stops
+							vector<vector<structStartStop>> vStartsStops(lChunkSize);
+							//  Replicate table entries
+							vector<string> vReplicateEntries(lChunkSize * nShuffleCount);
+							//  Replicate error entries
+							vector<string> vReplicateErrors(lChunkSize * nShuffleCount);
+
+							//  Load the chunk's genomes
+							#pragma omp parallel for num_threads(nMaxProcs)
+							for (long lCount = lChunkStart; lCount < lChunkEnd; lCount++)
+							{
+								//  Chunk index
+								long lEntry = lCount - lChunkStart;
+								//  Sequence file text
+								string strSequenceFileText = "";
+								//  Catalog entry
+								CBase123_Catalog_Entry* pceGet = NULL;
+
+								//  Update for timestamp every 10,000 files
+								if (lCount % 10000 == 0)
+								{
+									omp_set_lock(&lockList);
+									ReportTimeStamp("[ProcessShuffleFDistanceList]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
+									omp_unset_lock(&lockList);
+								}
+
+								//  If input file path name transform is not empty
+								if (!strInputFilePathNameTransform.empty())
+									vWorkingFilePathNames[lEntry] = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
+								else
+									vWorkingFilePathNames[lEntry] = vFilePathNames[lCount];
+
+								if (!b123Archive.GetFAFileText(vWorkingFilePathNames[lEntry], strSequenceFileText))
+									vErrorEntries[lCount] = vWorkingFilePathNames[lEntry] + "~File Open Failed\n";
+								else if ((vAccessions[lEntry] = GetAccessionFromFileHeader(strSequenceFileText)).empty())
+									vErrorEntries[lCount] = vWorkingFilePathNames[lEntry] + "~Empty Accession\n";
+								else if ((pceGet = b123Catalog.GetEntryPointerByAccession(vAccessions[lEntry])) == NULL)
+									vErrorEntries[lCount] = vWorkingFilePathNames[lEntry] + "~Catalog Accession Search Failed\n";
+								else if (!ParseStartsAndStops((long)GetSequenceFromFAFile(strSequenceFileText).length(), *pceGet->GetCDSCollectionPointer(), vStartsStops[lEntry]))
+									vErrorEntries[lCount] = vWorkingFilePathNames[lEntry] + "~CDS Parse Failed\n";
+								else
+								{
+									vHeaders[lEntry] = strSequenceFileText.substr(0, strSequenceFileText.find('\n'));
+									vSequences[lEntry] = GetSequenceFromFAFile(strSequenceFileText);
+									vCircular[lEntry] = (pceGet->GetStrandednessType() == "c");
+
+									if (vSequences[lEntry].empty())
+										vErrorEntries[lCount] = vWorkingFilePathNames[lEntry] + "~Empty Sequence\n";
+								}
+
+								if (!vErrorEntries[lCount].empty())
+								{
+									omp_set_lock(&lockList);
+									ReportTimeStamp("[ProcessShuffleFDistanceList]", "ERROR:  Input Sequence File [" + vWorkingFilePathNames[lEntry] + "] Load Failed");
+									omp_unset_lock(&lockList);
+								}
+							}
+
+							//  Score the genomes and their replicates; one work item per genome/replicate
+							#pragma omp parallel for schedule(dynamic) num_threads(nMaxProcs)
+							for (long lItem = 0; lItem < lChunkSize * (nShuffleCount + 1); lItem++)
+							{
+								//  Chunk index
+								long lEntry = lItem / (nShuffleCount + 1);
+								//  Replicate (-1, the genome)
+								int nReplicate = (int)(lItem % (nShuffleCount + 1)) - 1;
+								//  Sequence to score (scoring reverse complements it in place)
+								string strScore = "";
+								//  Output file path name (genome only)
+								string strOutputFilePathName = "";
+								//  CDS table entries (unused)
+								string strCDSTableEntries = "";
+
+								if (vSequences[lEntry].empty())
+									continue;
+
+								if (nReplicate == m_nResultsStoreGenome)
+								{
+									strScore = vSequences[lEntry];
+									strOutputFilePathName = GetFDistanceOutputFilePathName(vWorkingFilePathNames[lEntry], strOutputFileNameSuffix);
+								}
+								else
+								{
+									//  FA shuffle
+									CBase123_Shuffler bshuffle(ullShuffleSeed, vAccessions[lEntry], nReplicate);
+
+									//  shuffle the sequence
+									strScore = bshuffle.shuffleSequence(vSequences[lEntry], vStartsStops[lEntry]);
+
+									//  Verify shuffle quality
+									if ((strScore.empty()) || (strScore.length() != vSequences[lEntry].length()))
+									{
+										vReplicateErrors[lEntry * nShuffleCount + nReplicate] = vAccessions[lEntry] + "~Length Check Failed [sh_" + ConvertIntToString(nReplicate) + "]\n";
+
+										continue;
+									}
+
+									//  Store the replicate sequence, if requested
+									if (bStoreShuffles)
+									{
+										//  Output file text
+										string strOutputFileText = vHeaders[lEntry] + "\n" + strScore;
+										//  Shuffle file path name
+										string strShuffleFilePathName = GetBasePath(vWorkingFilePathNames[lEntry]) + chrPathDelimiter + GetFileNameExceptLastExtension(vWorkingFilePathNames[lEntry]) + ".sh_" + ConvertIntToString(nReplicate) + ".fa";
+
+										if (!WriteFileText(strShuffleFilePathName, strOutputFileText))
+											vReplicateErrors[lEntry * nShuffleCount + nReplicate] = strShuffleFilePathName + "~Write Failed\n";
+									}
+								}
+
+								// If sequence is circular
+								if (vCircular[lEntry])
+									strScore += strScore.substr(0, nNMerLength - 1);
+
+								if (nReplicate == m_nResultsStoreGenome)
+								{
+									if (!fnProcessForeground(strOutputFilePathName, vAccessions[lEntry], strScore, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[lChunkStart + lEntry], NULL, strCDSTableEntries))
+									{
+										vErrorEntries[lChunkStart + lEntry] = vWorkingFilePathNames[lEntry] + "~Foreground Analysis Failed\n";
+
+										omp_set_lock(&lockList);
+										ReportTimeStamp("[ProcessShuffleFDistanceList]", "ERROR:  Foreground Sequence [" + vWorkingFilePathNames[lEntry] + "] Process Failed");
+										omp_unset_lock(&lockList);
+									}
+								}
+								else if (!fnProcessForeground(strOutputFilePathName, vAccessions[lEntry], strScore, bBidirectional, bAllowUnknowns, nNMerLength, vReplicateEntries[lEntry * nShuffleCount + nReplicate], NULL, strCDSTableEntries))
+								{
+									vReplicateEntries[lEntry * nShuffleCount + nReplicate] = "";
+									vReplicateErrors[lEntry * nShuffleCount + nReplicate] += vAccessions[lEntry] + "~Foreground Analysis Failed [sh_" + ConvertIntToString(nReplicate) + "]\n";
+								}
+							}
+
+							//  Collect the chunk's replicate entries and errors
+							for (long lEntry = 0; lEntry < lChunkSize; lEntry++)
+							{
+								for (int nReplicate = 0; nReplicate < nShuffleCount; nReplicate++)
+								{
+									if (!vReplicateEntries[lEntry * nShuffleCount + nReplicate].empty())
+										vShuffleEntries[lChunkStart + lEntry] += ConvertIntToString(nReplicate) + "|" + vReplicateEntries[lEntry * nShuffleCount + nReplicate] + "\n";
+
+									vErrorEntries[lChunkStart + lEntry] += vReplicateErrors[lEntry * nShuffleCount + nReplicate];
+								}
+							}
+						}
+
+						//  Close the chunked list
+						CloseListChunksMPI();
+
+						//  Gather table, replicate and error entries on rank 0
+						GatherListEntriesMPI(vOutputTableEntries);
+						GatherListEntriesMPI(vShuffleEntries);
+						GatherListEntriesMPI(vErrorEntries);
+
+						//  Destroy time stamp lock
+						omp_destroy_lock(&lockList);
+
+						//  Collect the genome and replicate results (rank 0)
+						if (IsRootMPI())
+						{
+							for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+							{
+								//  Replicate lines
+								vector<string> vShuffleLines;
+								//  Result
+								structFDistanceResult stResult;
+
+								if ((!vOutputTableEntries[lCount].empty()) && (ParseFDistanceTableEntry(vOutputTableEntries[lCount], m_nResultsStoreGenome, stResult)))
+									vResults.push_back(stResult);
+
+								SplitString(vShuffleEntries[lCount], '\n', vShuffleLines);
+
+								for (long lLine = 0; lLine < vShuffleLines.size(); lLine++)
+								{
+									//  Replicate delimiter position
+									size_t ulPosition = vShuffleLines[lLine].find('|');
+									//  Replicate table entry
+									string strTableEntry = vShuffleLines[lLine].substr(ulPosition + 1);
+
+									if ((ulPosition != string::npos) && (ParseFDistanceTableEntry(strTableEntry, atoi(vShuffleLines[lLine].substr(0, ulPosition).c_str()), stResult)))
+										vResults.push_back(stResult);
+								}
+							}
+						}
+
+						//  Write error file (rank 0)
+						if ((!strErrorFilePathName.empty()) && (IsRootMPI()))
+						{
+							//  Add header
+							strErrorFileText = "File Path Name~Error\n";
+
+							//  Iterate error entries and concatenate error file text
+							for (long lCount = 0; lCount < vErrorEntries.size(); lCount++)
+							{
+								//  If file error entry is not empty, concatenate error file text
+								if (!vErrorEntries[lCount].empty())
+									strErrorFileText += vErrorEntries[lCount];
+							}
+
+							//  Write error file
+							WriteFileText(strErrorFilePathName, strErrorFileText);
+						}
+
+						return true;
+					}
+					else
+					{
+						ReportTimeStamp("[ProcessShuffleFDistanceList]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Text is Empty");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ProcessShuffleFDistanceList]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Open Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ProcessShuffleFDistanceList]", "ERROR:  nMer Length Must be 8 or 16 (Nucleotide) and Shuffle Count Must be Greater Than Zero");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ProcessShuffleFDistanceList]", "ERROR:  Input File Path Name List is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessShuffleFDistanceList] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Performs the F-Distance analysis on a list of BIG .fa format files
@@ -979,6 +1247,19 @@ bool ListClearFDistanceOutput(string strInputFilePathNameList, string strInputFi
 //  [string] strForegroundErrorFilePathName         :  base file name of the foreground error file
 //  [int] nNMerLength                               :  nMer length to analyze
 //  [int] nMaxProcs                                 :  maximum processor count (for openMP)
+//  [string] strJournalFilePathName                 :  foreground resume journal file path name; if empty, no journal is kept
+//  [long] lMemoryBudget                            :  16-mer background memory budget, MB (0 = unlimited)
+//  [int] nAlphabetType                             :  alphabet (nucleotide, amino acid, or reduced amino acid; see Base123_FDistance_AA.h)
+//  [string] strCDSTableFilePathName                :  per-CDS F-Distance table file path name (nucleotide only); if empty, none is written
+//  [string] strBackgroundExportFilePathBaseName    :  background nMer set export file path base name (nucleotide only); if empty, none is written
+//  [int] nBackgroundExportFormat                   :  background export format (see Base123_Background_Export.h)
+//  [int] nBackgroundExportSet                      :  background export set (present, absent, or both)
+//  [string] strResultsStoreFilePathName            :  results store file path name; if not empty, the foreground results are appended (see Base123_Results_Store.h)
+//  [int] nShuffleCount                             :  shuffle replicates per foreground genome (nucleotide only); if > 0, genomes are shuffled and scored in one pass
+//  [bool] bStoreShuffles                           :  write each shuffle replicate sequence (<base>.sh_N.fa), if true
+//  [string] strShuffleTableFilePathName            :  contabulated shuffle table file path name (required, if shuffle count > 0)
+//  [string] strArchiveFilePathName                 :  sequence archive file path name (nucleotide only); if set, background and foreground files are read from the archive
+//  [uint64_t] ullShuffleSeed                       :  shuffle seed; replicates are reproducible for any thread or rank count
 //                                                  :  returns true, if successful; else, false
 //
 ////////////////////////////////////////////////////////////////////////////////
@@ -986,16 +1267,59 @@ bool ListClearFDistanceOutput(string strInputFilePathNameList, string strInputFi
 bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackgroundFilePathNameList, string strBackgroundInputFilePathNameTransform, string strBackgroundCatalogFilePathName,
 	long lMaxBackgroundCatalogSize, bool bBackgroundBidirect, bool bBackgroundAllowUnknowns, string strBackgroundErrorFilePathName, string strForegroundFilePathNameList,
 	string strForegroundInputFilePathNameTransform, string strForegroundCatalogFilePathName, long lMaxForegroundCatalogSize, bool bForegroundBidirect, bool bForegroundAllowUnknowns,
-	string strOutputFileNameSuffix, string strForegroundErrorFilePathName, int nNMerLength, int nMaxProcs)
+	string strOutputFileNameSuffix, string strForegroundErrorFilePathName, int nNMerLength, int nMaxProcs, string strJournalFilePathName, long lMemoryBudget, int nAlphabetType,
+	string strCDSTableFilePathName, string strBackgroundExportFilePathBaseName, int nBackgroundExportFormat, int nBackgroundExportSet,
+	string strResultsStoreFilePathName, int nShuffleCount, bool bStoreShuffles, string strShuffleTableFilePathName, string strArchiveFilePathName, uint64_t ullShuffleSeed)
 {
 	//  Return status, is success if true, else is not-error
 	bool bStatusSuccess = false;
 	//  Output table file text
 	vector<string> vOutputTableEntries;
+	//  CDS table file text
+	vector<string> vCDSTableEntries;
+	//  Compile per-CDS table, if true
+	bool bCDSBreakdown = (!strCDSTableFilePathName.empty());
+	//  Genome and shuffle replicate results (shuffle pass)
+	vector<structFDistanceResult> vShuffleResults;
+	//  Sequence archive (background and foreground files are read, unless opened)
+	CBase123_Sequence_Archive b123Archive;
 
 	try
 	{
-		if (nNMerLength == 8)
+		//  The CDS breakdown aggregates nucleotide positions; translated output is indexed by codon
+		if ((bCDSBreakdown) && (nAlphabetType != m_nAlphabetNucleotide))
+		{
+			ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  -cds_table [-cdst] Requires the Nucleotide Alphabet; No CDS Table Will be Written");
+
+			bCDSBreakdown = false;
+		}
+
+		//  The shuffle pass scores whole genomes in memory; it keeps no journal and compiles no CDS table
+		if ((nShuffleCount > 0) && ((bCDSBreakdown) || (!strJournalFilePathName.empty())))
+		{
+			ReportTimeStamp("[PerformFDistanceAnalysis]", "NOTE:  -shuffle_count [-sc] Ignores -cds_table [-cdst] and -resume_journal [-rj]");
+
+			bCDSBreakdown = false;
+		}
+
+		//  The sequence archive holds .fa genomes; translated alphabets read ORF files
+		if (!strArchiveFilePathName.empty())
+		{
+			if (nAlphabetType != m_nAlphabetNucleotide)
+			{
+				ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  -archive [-ar] Requires the Nucleotide Alphabet; Files Will be Read");
+			}
+			else if (!b123Archive.OpenArchive(strArchiveFilePathName))
+			{
+				ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Sequence Archive [" + strArchiveFilePathName + "] Open Failed");
+
+				return false;
+			}
+		}
+
+		if (nAlphabetType != m_nAlphabetNucleotide)
+			bStatusSuccess = true;
+		else if (nNMerLength == 8)
 			bStatusSuccess = InitializeWriteLock16();
 		else if (nNMerLength == 16)
 			bStatusSuccess = InitializeWriteLock32();
@@ -1031,29 +1355,31 @@ bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackg
 											if (nMaxProcs > 0)
 											{
 												//  Background genome catalog
-												CBase123_Catalog b123BackgroundCatalog(lMaxBackgroundCatalogSize);
+												CBase123_Catalog b123BackgroundCatalog(lMaxBackgroundCatalogSize, true);
 
 												//  Open background catalog
-												if (b123BackgroundCatalog.OpenCatalog(strBackgroundCatalogFilePathName))
+												if (b123BackgroundCatalog.OpenCatalog(strBackgroundCatalogFilePathName, nMaxProcs))
 												{
 													//  Update console; end application;
 													ReportTimeStamp("[PerformFDistanceAnalysis]", "Background Catalog Opened");
 
 													//  Foreground genome catalog
-													CBase123_Catalog b123ForegroundCatalog(lMaxForegroundCatalogSize);
+													CBase123_Catalog b123ForegroundCatalog(lMaxForegroundCatalogSize, true);
 
 													//  Open foreground catalog
-													if (b123ForegroundCatalog.OpenCatalog(strForegroundCatalogFilePathName))
+													if (b123ForegroundCatalog.OpenCatalog(strForegroundCatalogFilePathName, nMaxProcs))
 													{
 														//  Update console; end application;
 														ReportTimeStamp("[PerformFDistanceAnalysis]", "Foreground Catalog Opened");
 
 														//  Initialize the background array
 														bStatusSuccess = false;
-														if (nNMerLength == 8)
+														if (nAlphabetType != m_nAlphabetNucleotide)
+															bStatusSuccess = InitializeBackgroundAA(nNMerLength, nAlphabetType);
+														else if (nNMerLength == 8)
 															bStatusSuccess = InitializeBackground16();
 														else if (nNMerLength == 16)
-															bStatusSuccess = InitializeBackground32();
+															bStatusSuccess = InitializeBackground32(lMemoryBudget, nMaxProcs);
 
 														//  If background array is set
 														if (bStatusSuccess)
@@ -1063,10 +1389,27 @@ bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackg
 
 															//  Destroy the background array
 															bStatusSuccess = false;
-															if (nNMerLength == 8)
-																bStatusSuccess = ProcessFDistanceList16(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, b123BackgroundCatalog, bBackgroundBidirect, nNMerLength, true, bBackgroundAllowUnknowns, strOutputFileNameSuffix, strBackgroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+															if (nAlphabetType != m_nAlphabetNucleotide)
+																bStatusSuccess = ProcessFDistanceListAA(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, b123BackgroundCatalog, bBackgroundBidirect, nNMerLength, true, bBackgroundAllowUnknowns, strOutputFileNameSuffix, strBackgroundErrorFilePathName, "", vOutputTableEntries, nMaxProcs);
+															else if (nNMerLength == 8)
+																bStatusSuccess = ProcessFDistanceList16(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, b123BackgroundCatalog, b123Archive, bBackgroundBidirect, nNMerLength, true, bBackgroundAllowUnknowns, strOutputFileNameSuffix, strBackgroundErrorFilePathName, "", vOutputTableEntries, false, vCDSTableEntries, nMaxProcs);
 															else if (nNMerLength == 16)
-																bStatusSuccess = ProcessFDistanceList32(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, b123BackgroundCatalog, bBackgroundBidirect, nNMerLength, true, bBackgroundAllowUnknowns, strOutputFileNameSuffix, strBackgroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+																bStatusSuccess = ProcessFDistanceList32(strBackgroundFilePathNameList, strBackgroundInputFilePathNameTransform, b123BackgroundCatalog, b123Archive, bBackgroundBidirect, nNMerLength, true, bBackgroundAllowUnknowns, strOutputFileNameSuffix, strBackgroundErrorFilePathName, "", vOutputTableEntries, false, vCDSTableEntries, nMaxProcs);
+
+															//  Combine the backgrounds loaded by each MPI rank
+															if (bStatusSuccess)
+															{
+																if (nAlphabetType != m_nAlphabetNucleotide)
+																	bStatusSuccess = ReduceBackgroundAA();
+																else if (nNMerLength == 8)
+																	bStatusSuccess = ReduceBackground16();
+																else if (nNMerLength == 16)
+																	bStatusSuccess = ReduceBackground32();
+															}
+
+															//  Select the final 16-mer background representation (cardinality is now known)
+															if ((bStatusSuccess) && (nAlphabetType == m_nAlphabetNucleotide) && (nNMerLength == 16))
+																bStatusSuccess = FinalizeBackground32();
 
 															//  Process background file list
 															if (bStatusSuccess)
@@ -1074,12 +1417,40 @@ bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackg
 																//  Update console; end application;
 																ReportTimeStamp("[PerformFDistanceAnalysis]", "Background Loaded");
 
+																//  Export the background nMer set (rank 0; every rank holds the combined background)
+																if ((!strBackgroundExportFilePathBaseName.empty()) && (IsRootMPI()))
+																{
+																	//  Export status
+																	bool bExported = false;
+
+																	if (nAlphabetType != m_nAlphabetNucleotide)
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  -background_export [-be] Requires the Nucleotide Alphabet");
+																	else if (nNMerLength == 8)
+																		bExported = WriteBackgroundArray16(strBackgroundExportFilePathBaseName, nNMerLength, nBackgroundExportFormat, nBackgroundExportSet, nMaxProcs);
+																	else if (nNMerLength == 16)
+																		bExported = WriteBackgroundArray32(strBackgroundExportFilePathBaseName, nNMerLength, nBackgroundExportFormat, nBackgroundExportSet, nMaxProcs);
+
+																	if (bExported)
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "NOTE:  Background Exported [" + strBackgroundExportFilePathBaseName + "]");
+																	else
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  Background Export [" + strBackgroundExportFilePathBaseName + "] Failed");
+																}
+
 																//  Destroy the background array
 																bStatusSuccess = false;
-																if (nNMerLength == 8)
-																	bStatusSuccess = ProcessFDistanceList16(strForegroundFilePathNameList, strForegroundCatalogFilePathName, b123ForegroundCatalog, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+																if (nShuffleCount > 0)
+																{
+																	if ((nAlphabetType == m_nAlphabetNucleotide) && (!strShuffleTableFilePathName.empty()))
+																		bStatusSuccess = ProcessShuffleFDistanceList(strForegroundFilePathNameList, strForegroundInputFilePathNameTransform, b123ForegroundCatalog, b123Archive, bForegroundBidirect, nNMerLength, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, nShuffleCount, bStoreShuffles, ullShuffleSeed, vOutputTableEntries, vShuffleResults, nMaxProcs);
+																	else
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "ERROR:  -shuffle_count [-sc] Requires the Nucleotide Alphabet and -shuffle_table [-st]");
+																}
+																else if (nAlphabetType != m_nAlphabetNucleotide)
+																	bStatusSuccess = ProcessFDistanceListAA(strForegroundFilePathNameList, strForegroundInputFilePathNameTransform, b123ForegroundCatalog, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, strJournalFilePathName, vOutputTableEntries, nMaxProcs);
+																else if (nNMerLength == 8)
+																	bStatusSuccess = ProcessFDistanceList16(strForegroundFilePathNameList, strForegroundInputFilePathNameTransform, b123ForegroundCatalog, b123Archive, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, strJournalFilePathName, vOutputTableEntries, bCDSBreakdown, vCDSTableEntries, nMaxProcs);
 																else if (nNMerLength == 16)
-																	bStatusSuccess = ProcessFDistanceList32(strForegroundFilePathNameList, strForegroundCatalogFilePathName, b123ForegroundCatalog, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, vOutputTableEntries, nMaxProcs);
+																	bStatusSuccess = ProcessFDistanceList32(strForegroundFilePathNameList, strForegroundInputFilePathNameTransform, b123ForegroundCatalog, b123Archive, bForegroundBidirect, nNMerLength, false, bForegroundAllowUnknowns, strOutputFileNameSuffix, strForegroundErrorFilePathName, strJournalFilePathName, vOutputTableEntries, bCDSBreakdown, vCDSTableEntries, nMaxProcs);
 
 																//  Process foreground file list
 																if (bStatusSuccess)
@@ -1087,11 +1458,38 @@ bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackg
 																	//  Update console; end application;
 																	ReportTimeStamp("[PerformFDistanceAnalysis]", "Foreground Analyzed");
 
-																	//  Write output table
-																	if (!WriteFDistanceOutputTable(strOutputTableFilePathName, vOutputTableEntries))
+																	//  Write output table (rank 0 holds the gathered entries)
+																	if ((IsRootMPI()) && (!WriteFDistanceOutputTable(strOutputTableFilePathName, vOutputTableEntries)))
 																	{
 																		ReportTimeStamp("[PerformFDistanceAnalysis]", "F-Distance Output Table File [" + strOutputTableFilePathName + "] Write Failed");
 																	}
+
+																	//  Write CDS table (rank 0 holds the gathered entries)
+																	if ((bCDSBreakdown) && (IsRootMPI()) && (!WriteFDistanceCDSTable(strCDSTableFilePathName, vCDSTableEntries)))
+																	{
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "F-Distance CDS Table File [" + strCDSTableFilePathName + "] Write Failed");
+																	}
+
+																	//  Write contabulated shuffle table (rank 0 holds the gathered results)
+																	if ((nShuffleCount > 0) && (IsRootMPI()) && (!WriteContabulatedResults(strShuffleTableFilePathName, "", b123ForegroundCatalog, vShuffleResults, nMaxProcs)))
+																	{
+																		ReportTimeStamp("[PerformFDistanceAnalysis]", "F-Distance Shuffle Table File [" + strShuffleTableFilePathName + "] Write Failed");
+																	}
+
+																	//  Append results store block (rank 0 holds the gathered entries)
+																	if ((!strResultsStoreFilePathName.empty()) && (IsRootMPI()))
+																	{
+																		//  Append status
+																		bool bStored = false;
+
+																		if (nShuffleCount > 0)
+																			bStored = AppendResultsStore(strResultsStoreFilePathName, vShuffleResults);
+																		else
+																			bStored = StoreFDistanceTableEntries(strResultsStoreFilePathName, strForegroundFilePathNameList, vOutputTableEntries);
+
+																		if (!bStored)
+																			ReportTimeStamp("[PerformFDistanceAnalysis]", "F-Distance Results Store [" + strResultsStoreFilePathName + "] Append Failed");
+																	}
 																}
 																else
 																{
@@ -1105,7 +1503,9 @@ bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackg
 
 															//  Destroy the background array
 															bStatusSuccess = false;
-															if (nNMerLength == 8)
+															if (nAlphabetType != m_nAlphabetNucleotide)
+																bStatusSuccess = DestroyBackgroundAA();
+															else if (nNMerLength == 8)
 																bStatusSuccess = DestroyBackground16();
 															else if (nNMerLength == 16)
 																bStatusSuccess = DestroyBackground32();
@@ -1116,7 +1516,9 @@ bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackg
 
 															//  Destroy the write-lock
 															bStatusSuccess = false;
-															if (nNMerLength == 8)
+															if (nAlphabetType != m_nAlphabetNucleotide)
+																bStatusSuccess = true;
+															else if (nNMerLength == 8)
 																bStatusSuccess = DestroyWriteLock16();
 															else if (nNMerLength == 16)
 																bStatusSuccess = DestroyWriteLock32();
@@ -22,10 +22,13 @@
 
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
+#include "Base123_Results_Store.h"
+#include "Base123_Sequence_Archive.h"
 
-bool FilterFileForFDistance(string strInputFilePathName, bool bUseStrictFilter, int nMaxPolyLimit, string& strAcceptListFileText, string& strRejectListFileText);
-bool ListFilterForFDistance(string strInputFilePathNameList, string strInputFilePathNameTransform, bool bUseStrictFilter, int nMaxPolyLimit, string strAcceptOutputListFilePathName, string strRejectOutputListFilePathName, int nMaxProcs);
+bool FilterFileForFDistance(string strInputFilePathName, CBase123_Sequence_Archive& b123Archive, bool bUseStrictFilter, int nMaxPolyLimit, string& strAcceptListFileText, string& strRejectListFileText);
+bool ListFilterForFDistance(string strInputFilePathNameList, string strInputFilePathNameTransform, bool bUseStrictFilter, int nMaxPolyLimit, string strAcceptOutputListFilePathName, string strRejectOutputListFilePathName, int nMaxProcs, string strArchiveFilePathName);
 bool TabulateFDistanceOutput(string& strInputPathName, string& strAccession, int nOutputCount, string& strOutputFileNameSuffix, string& strTableEntry, string& strErrorEntry);
 bool ListContabulateFDistanceOutput(string strInputFilePathNameList, string strInputFilePathNameTransform, string strOutputTableFilePathName, string strCatalogFilePathName, long lMaxCatalogSize, int nOutputCount, string strOutputFileNameSuffix, string strErrorFilePathName, int nMaxProcs);
 bool ListClearFDistanceOutput(string strInputFilePathNameList, string strInputFilePathNameTransform, int nOutputCount, string strOutputFileNameSuffix, string strErrorFilePathName, int nMaxProcs);
-bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackgroundFilePathNameList, string strBackgroundInputFilePathNameTransform, string strBackgroundCatalogFilePathName, long lMaxBackgroundCatalogSize, bool bBackgroundBidirect, bool bBackgroundAllowUnknowns, string strBackgroundErrorFilePathName, string strForegroundFilePathNameList, string strForegroundInputFilePathNameTransform, string strForegroundCatalogFilePathName, long lMaxForegroundCatalogSize, bool bForegroundBidirect, bool bForegroundAllowUnknowns, string strOutputFileNameSuffix, string strForegroundErrorFilePathName, int nNMerLength, int nMaxProcs);
\ No newline at end of file
+bool ProcessShuffleFDistanceList(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, CBase123_Sequence_Archive& b123Archive, bool bBidirectional, int nNMerLength, bool bAllowUnknowns, string strOutputFileNameSuffix, string strErrorFilePathName, int nShuffleCount, bool bStoreShuffles, uint64_t ullShuffleSeed, vector<string>& vOutputTableEntries, vector<structFDistanceResult>& vResults, int nMaxProcs);
+bool PerformFDistanceAnalysis(string strOutputTableFilePathName, string strBackgroundFilePathNameList, string strBackgroundInputFilePathNameTransform, string strBackgroundCatalogFilePathName, long lMaxBackgroundCatalogSize, bool bBackgroundBidirect, bool bBackgroundAllowUnknowns, string strBackgroundErrorFilePathName, string strForegroundFilePathNameList, string strForegroundInputFilePathNameTransform, string strForegroundCatalogFilePathName, long lMaxForegroundCatalogSize, bool bForegroundBidirect, bool bForegroundAllowUnknowns, string strOutputFileNameSuffix, string strForegroundErrorFilePathName, int nNMerLength, int nMaxProcs, string strJournalFilePathName, long lMemoryBudget, int nAlphabetType, string strCDSTableFilePathName, string strBackgroundExportFilePathBaseName, int nBackgroundExportFormat, int nBackgroundExportSet, string strResultsStoreFilePathName, int nShuffleCount, bool bStoreShuffles, string strShuffleTableFilePathName, string strArchiveFilePathName, uint64_t ullShuffleSeed);
\ No newline at end of file
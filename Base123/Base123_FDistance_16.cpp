@@ -19,6 +19,8 @@
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
 #include "Base123_FDistance_16.h"
+#include "Base123_MPI.h"
+#include "Base123_Background_Export.h"
 #include "Base123_Utilities.h"
 
 #include <math.h>
@@ -148,22 +150,55 @@ string ConvertSequenceToString16(uint16_t untSequence, int nNMerLength)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Writes the background array to file
+//  Gets the background membership of 64 consecutive nMers; the background export scan
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string] strOutputFilePathBaseName:  output file path name
+//  [uint64_t] ullFirstRank:  first nMer (a multiple of 64)
+//                        :  returns membership word; bit i is nMer ullFirstRank + i
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetBackgroundWord16(uint64_t ullFirstRank)
+{
+	//  Membership word
+	uint64_t ullWord = 0;
+
+	for (uint64_t ullCount = 0; ullCount < 64; ullCount++)
+	{
+		//  Poly-T is held outside of the background array
+		if (ullFirstRank + ullCount == UINT16_MAX)
+		{
+			if (m_bBackgroundPolyTU16)
+				ullWord |= (uint64_t)1 << ullCount;
+		}
+		else if (m_unaBackground16[ullFirstRank + ullCount] != 0)
+			ullWord |= (uint64_t)1 << ullCount;
+	}
+
+	return ullWord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes the background array to file; the present and/or absent nMer sets are streamed, in
+//      parallel, to chunk files and a manifest (see Base123_Background_Export.h)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strOutputFilePathBaseName:  output file path base name
 //  [int] nNMerLength                 :  nMer length to convert
+//  [int] nFormat                     :  export format (text, 2-bit, or delta)
+//  [int] nSet                        :  export set (present, absent, or both)
+//  [int] nMaxProcs                   :  maximum processors for openMP
 //                                   :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool WriteBackgroundArray16(string strOutputFilePathBaseName, int nNMerLength)
+bool WriteBackgroundArray16(string strOutputFilePathBaseName, int nNMerLength, int nFormat, int nSet, int nMaxProcs)
 {
-	//  Present file test
-	string strPresentFileText = "";
-	//  Absent file text
-	string strAbsentFileText = "";
+	//  Return status
+	bool bStatusSuccess = true;
 
 	try
 	{
@@ -173,21 +208,23 @@ bool WriteBackgroundArray16(string strOutputFilePathBaseName, int nNMerLength)
 			//  If output file path base name is not empty
 			if (!strOutputFilePathBaseName.empty())
 			{
-				//  Iterate background and concatenate file texts
-				for (uint16_t untCount = 0; untCount < UINT16_MAX; untCount++)
+				//  Write present nMers
+				if ((nSet & m_nBackgroundExportPresent) && (!ExportBackground(strOutputFilePathBaseName, nNMerLength, nFormat, true, GetBackgroundWord16, nMaxProcs)))
 				{
-					if (m_unaBackground16[untCount] == 0)
-						strAbsentFileText += ConvertSequenceToString16(untCount, nNMerLength) + "\n";
-					else
-						strPresentFileText += ConvertSequenceToString16(untCount, nNMerLength) + "\n";
+					ReportTimeStamp("[WriteBackgroundArray16]", "ERROR:  Present File Write Failed");
+
+					bStatusSuccess = false;
 				}
 
-				//  Write output
-				if (!WriteFileText(strOutputFilePathBaseName + "_absent.txt", strAbsentFileText))
+				//  Write absent nMers
+				if ((nSet & m_nBackgroundExportAbsent) && (!ExportBackground(strOutputFilePathBaseName, nNMerLength, nFormat, false, GetBackgroundWord16, nMaxProcs)))
+				{
 					ReportTimeStamp("[WriteBackgroundArray16]", "ERROR:  Absent File Write Failed");
 
-				if (!WriteFileText(strOutputFilePathBaseName + "_present.txt", strPresentFileText))
-					ReportTimeStamp("[WriteBackgroundArray16]", "ERROR:  Present File Write Failed");
+					bStatusSuccess = false;
+				}
+
+				return bStatusSuccess;
 			}
 			else
 			{
@@ -610,19 +647,21 @@ int MutateSequence16(uint16_t& untSequence)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string&] strOutputFilePathName  :  output file path name
+//  [string&] strOutputFilePathName  :  output file path name; if empty, the sequence is scored only (no output file)
 //  [string&] strAccession           :  accession of sequence to process
 //  [string&] strSequence            :  sequence to process
 //  [bool] bBidirectional            :  process bidirectionally, if true
 //  [bool] bForegroundAllowUnknowns  :  process foreground unknown chracters, if true
 //  [int] nNMerLength                :  nMer length to analyze
 //  [string&] strOutputTableEntry    :  F-Distance table file text to concatenate
+//  [vector<structCDS>*] vpCDSs      :  CDS collection of the sequence; if NULL, no CDS table entries are compiled
+//  [string&] strCDSTableEntries     :  F-Distance CDS table entries to set
 //                                  :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
 bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, 
-	string& strOutputTableEntry)
+	string& strOutputTableEntry, vector<structCDS>* vpCDSs, string& strCDSTableEntries)
 {
 	//  Character sequence
 	string strSubSequence = "";
@@ -650,93 +689,139 @@ bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, st
 			//  If accession is not empty
 			if (!strAccession.empty())
 			{
-				//  If output file path name is not empty
-				if (!strOutputFilePathName.empty())
+				//  If the input sequence is not empty
+				if (!strSequence.empty())
 				{
-					//  If the input sequence is not empty
-					if (!strSequence.empty())
+					//  Reject sequences with gaps
+					if (strSequence.find_first_of('-') != string::npos)
 					{
-						//  Reject sequences with gaps
-						if (strSequence.find_first_of('-') != string::npos)
+						ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+
+						return false;
+					}
+					//  Reject sequences with poly-n
+					else if (strSequence.find("nnnnnnnn") != string::npos)
+					{
+						ReportTimeStamp("[ProcessForeground16]", "ERROR:  Input Sequence Contains Excessive Poly-n Bases");
+
+						return false;
+					}
+
+					//  If bidirectional, iterate process twice
+					if (bBidirectional)
+						nMaxProcess = 2;
+
+					//  Process iteration maximum, according to bidirectional flag
+					for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
+					{
+						//  Get reverse complement on second pass
+						if (nCountPass > 0)
+							strSequence = ConvertToReverseCompliment(strSequence);
+
+						//  Get first nMer
+						strSubSequence = strSequence.substr(0, nNMerLength);
+
+						//  Process known bases
+						if ((strSubSequence.find_first_of('r') != string::npos) ||
+							(strSubSequence.find_first_of('y') != string::npos) ||
+							(strSubSequence.find_first_of('k') != string::npos) ||
+							(strSubSequence.find_first_of('m') != string::npos) ||
+							(strSubSequence.find_first_of('s') != string::npos) ||
+							(strSubSequence.find_first_of('w') != string::npos) ||
+							(strSubSequence.find_first_of('b') != string::npos) ||
+							(strSubSequence.find_first_of('d') != string::npos) ||
+							(strSubSequence.find_first_of('h') != string::npos) ||
+							(strSubSequence.find_first_of('v') != string::npos) ||
+							(strSubSequence.find_first_of('n') != string::npos))
 						{
-							ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+							if (bForegroundAllowUnknowns)
+							{
+								/*
+								R	A or G	puRine
+								Y	C, T or U	pYrimidines
+								K	G, T or U	bases which are Ketones
+								M	A or C	bases with aMino groups
+								S	C or G	Strong interaction
+								W	A, T or U	Weak interaction
+								B	not A (i.e. C, G, T or U)	B comes after A
+								D	not C (i.e. A, G, T or U)	D comes after C
+								H	not G (i.e., A, C, T or U)	H comes after G
+								V	neither T nor U (i.e. A, C or G)	V comes after U
+								N	A C G T U	Nucleic acid
+								-	gap of indeterminate length
+								*/
+
+								strSubSequence = ReplaceInString(strSubSequence, "r", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "y", "c", false);
+								strSubSequence = ReplaceInString(strSubSequence, "k", "g", false);
+								strSubSequence = ReplaceInString(strSubSequence, "m", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "s", "c", false);
+								strSubSequence = ReplaceInString(strSubSequence, "w", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "b", "c", false);
+								strSubSequence = ReplaceInString(strSubSequence, "d", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "h", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "v", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "n", "a", false);
+							}
+							else
+							{
+								ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
 
-							return false;
+								return false;
+							}
+						}
+
+						//  Get binary sequence
+						untSubSequence = ConvertStringToSequence16(strSubSequence);
+
+						//  Get mutation count
+						nMutationCount = MutateSequence16(untSubSequence);
+						if (nMutationCount >= 0)
+						{
+							//  Concatenate forward output
+							if (nCountPass == 0)
+								strForwardOutput += ConvertIntToString(nMutationCount);
+							else
+								strReverseOutput += ConvertIntToString(nMutationCount);
 						}
-						//  Reject sequences with poly-n
-						else if (strSequence.find("nnnnnnnn") != string::npos)
+						else
 						{
-							ReportTimeStamp("[ProcessForeground16]", "ERROR:  Input Sequence Contains Excessive Poly-n Bases");
+							ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString16(untSubSequence, nNMerLength) + "] @ [0] Mutation Failed or Mutation Count Exceeds Limit [8]");
 
 							return false;
 						}
 
-						//  If bidirectional, iterate process twice
-						if (bBidirectional)
-							nMaxProcess = 2;
-
-						//  Process iteration maximum, according to bidirectional flag
-						for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
+						//  Iterate subsequent nNMerLength characters to build remaing nMers
+						for (long lCountBases = nNMerLength; lCountBases < (strSequence.length() - nNMerLength) + 1; lCountBases++)
 						{
-							//  Get reverse complement on second pass
-							if (nCountPass > 0)
-								strSequence = ConvertToReverseCompliment(strSequence);
-
-							//  Get first nMer
-							strSubSequence = strSequence.substr(0, nNMerLength);
-
-							//  Process known bases
-							if ((strSubSequence.find_first_of('r') != string::npos) ||
-								(strSubSequence.find_first_of('y') != string::npos) ||
-								(strSubSequence.find_first_of('k') != string::npos) ||
-								(strSubSequence.find_first_of('m') != string::npos) ||
-								(strSubSequence.find_first_of('s') != string::npos) ||
-								(strSubSequence.find_first_of('w') != string::npos) ||
-								(strSubSequence.find_first_of('b') != string::npos) ||
-								(strSubSequence.find_first_of('d') != string::npos) ||
-								(strSubSequence.find_first_of('h') != string::npos) ||
-								(strSubSequence.find_first_of('v') != string::npos) ||
-								(strSubSequence.find_first_of('n') != string::npos))
+							//  Get base at this position
+							string strBase = strSequence.substr(lCountBases, 1);
+
+							//  Compare the character, shift the sequence and append the appropriate base
+							untSubSequence = untSubSequence << 2;
+							if (strBase.compare("-") == 0)
 							{
-								if (bForegroundAllowUnknowns)
-								{
-									/*
-									R	A or G	puRine
-									Y	C, T or U	pYrimidines
-									K	G, T or U	bases which are Ketones
-									M	A or C	bases with aMino groups
-									S	C or G	Strong interaction
-									W	A, T or U	Weak interaction
-									B	not A (i.e. C, G, T or U)	B comes after A
-									D	not C (i.e. A, G, T or U)	D comes after C
-									H	not G (i.e., A, C, T or U)	H comes after G
-									V	neither T nor U (i.e. A, C or G)	V comes after U
-									N	A C G T U	Nucleic acid
-									-	gap of indeterminate length
-									*/
-
-									strSubSequence = ReplaceInString(strSubSequence, "r", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "y", "c", false);
-									strSubSequence = ReplaceInString(strSubSequence, "k", "g", false);
-									strSubSequence = ReplaceInString(strSubSequence, "m", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "s", "c", false);
-									strSubSequence = ReplaceInString(strSubSequence, "w", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "b", "c", false);
-									strSubSequence = ReplaceInString(strSubSequence, "d", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "h", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "v", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "n", "a", false);
-								}
-								else
-								{
-									ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+								ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
 
-									return false;
-								}
+								return false;
 							}
+							else if (strBase.compare("a") == 0)
+								untSubSequence += m_untA;
+							else if (strBase.compare("c") == 0)
+								untSubSequence += m_untC;
+							else if (strBase.compare("g") == 0)
+								untSubSequence += m_untG;
+							else if ((strBase.compare("t") == 0) || (strBase.compare("u") == 0))
+								untSubSequence += m_untTU;
+							//  Unknown character, this sequence is unsuitable to F-Distance analysis, mutate according to NCBI rules
+							else if (bForegroundAllowUnknowns)
+								untSubSequence += m_untA;
+							else
+							{
+								ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
 
-							//  Get binary sequence
-							untSubSequence = ConvertStringToSequence16(strSubSequence);
+								return false;
+							}
 
 							//  Get mutation count
 							nMutationCount = MutateSequence16(untSubSequence);
@@ -750,86 +835,39 @@ bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, st
 							}
 							else
 							{
-								ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString16(untSubSequence, nNMerLength) + "] @ [0] Mutation Failed or Mutation Count Exceeds Limit [8]");
+								ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString16(untSubSequence, nNMerLength) + "] @ [" + ConvertLongToString(lCountBases) + "] Mutation Failed or Mutation Count Exceeds Limit [8]");
 
 								return false;
 							}
-
-							//  Iterate subsequent nNMerLength characters to build remaing nMers
-							for (long lCountBases = nNMerLength; lCountBases < (strSequence.length() - nNMerLength) + 1; lCountBases++)
-							{
-								//  Get base at this position
-								string strBase = strSequence.substr(lCountBases, 1);
-
-								//  Compare the character, shift the sequence and append the appropriate base
-								untSubSequence = untSubSequence << 2;
-								if (strBase.compare("-") == 0)
-								{
-									ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
-
-									return false;
-								}
-								else if (strBase.compare("a") == 0)
-									untSubSequence += m_untA;
-								else if (strBase.compare("c") == 0)
-									untSubSequence += m_untC;
-								else if (strBase.compare("g") == 0)
-									untSubSequence += m_untG;
-								else if ((strBase.compare("t") == 0) || (strBase.compare("u") == 0))
-									untSubSequence += m_untTU;
-								//  Unknown character, this sequence is unsuitable to F-Distance analysis, mutate according to NCBI rules
-								else if (bForegroundAllowUnknowns)
-									untSubSequence += m_untA;
-								else
-								{
-									ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
-
-									return false;
-								}
-
-								//  Get mutation count
-								nMutationCount = MutateSequence16(untSubSequence);
-								if (nMutationCount >= 0)
-								{
-									//  Concatenate forward output
-									if (nCountPass == 0)
-										strForwardOutput += ConvertIntToString(nMutationCount);
-									else
-										strReverseOutput += ConvertIntToString(nMutationCount);
-								}
-								else
-								{
-									ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString16(untSubSequence, nNMerLength) + "] @ [" + ConvertLongToString(lCountBases) + "] Mutation Failed or Mutation Count Exceeds Limit [8]");
-
-									return false;
-								}
-							}
 						}
+					}
 
-						//  Concatenate file text
-						strOutputFileText = strForwardOutput;
-						if (!strReverseOutput.empty())
-							strOutputFileText += "\n" + strReverseOutput;
+					//  Concatenate file text
+					strOutputFileText = strForwardOutput;
+					if (!strReverseOutput.empty())
+						strOutputFileText += "\n" + strReverseOutput;
 
-						//  Concatenate F-Distance table file text
-						if (CompileFDistanceTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, false, false))
-						{
-							//  Write file text
-							return WriteFileText(strOutputFilePathName, strOutputFileText);
-						}
+					//  Concatenate F-Distance table file text
+					if (CompileFDistanceTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, false, false))
+					{
+						//  Aggregate mutation counts into CDS and inter-CDS segments
+						if ((vpCDSs != NULL) && (!CompileFDistanceCDSTableOutput(strAccession, strForwardOutput, strReverseOutput, (long)strSequence.length(), nNMerLength, *vpCDSs, strCDSTableEntries)))
+							ReportTimeStamp("[ProcessForeground16]", "ERROR:  F-Distance CDS Table Compilation Failed");
+
+						//  Write file text (score only, if no output file path name)
+						if (strOutputFilePathName.empty())
+							return true;
 						else
-						{
-							ReportTimeStamp("[ProcessForeground16]", "ERROR:  F-Distance Score Compilation Failed");
-						}
+							return WriteFileText(strOutputFilePathName, strOutputFileText);
 					}
 					else
 					{
-						ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence is Empty");
+						ReportTimeStamp("[ProcessForeground16]", "ERROR:  F-Distance Score Compilation Failed");
 					}
 				}
 				else
 				{
-					ReportTimeStamp("[ProcessForeground16]", "ERROR:  Output File Path Name is Empty");
+					ReportTimeStamp("[ProcessForeground16]", "ERROR:  Foreground Sequence is Empty");
 				}
 			}
 			else
@@ -1275,20 +1313,25 @@ bool ProcessBackground16(string& strSequence, int nNMerLength, bool bBackgroundA
 //  [string] strInputListFilePathName     :  input file path name list
 //  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
 //  [CBase123_Catalog&] b123Catalog       :  Base123 genome catalog to use
+//  [CBase123_Sequence_Archive&] b123Archive:  sequence archive (if open, files are read from the archive)
 //  [bool] bBidirectional                 :  process bidirectional, if true
 //  [int] nNMerLength                     :  nMer length to analyze
 //  [bool] bBackground                    :  if true, process background; else, foreground
 //  [bool] bAllowUnknowns                 :  process unknown chracters, if true
 //  [string] strOutputFileNameSuffix      :  output file name suffix
 //  [string] strErrorFilePathName         :  error file base name
+//  [string] strJournalFilePathName       :  foreground resume journal file path name; if empty, no journal is kept
 //  [vector<string>&] vOutputTableEntries :  F-Distance table file text to concatenate
+//  [bool] bCDSBreakdown                  :  compile per-CDS table entries (foreground), if true
+//  [vector<string>&] vCDSTableEntries    :  F-Distance CDS table entries to set, one element per list entry
 //  [int] nMaxProcs                       :  maximum processors for openMP
 //                                       :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns,
-	string strOutputFileNameSuffix, string strErrorFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs)
+bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, CBase123_Sequence_Archive& b123Archive, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns,
+	string strOutputFileNameSuffix, string strErrorFilePathName, string strJournalFilePathName, vector<string>& vOutputTableEntries,
+	bool bCDSBreakdown, vector<string>& vCDSTableEntries, int nMaxProcs)
 {
 	//  List lock
 	omp_lock_t lockList;
@@ -1300,6 +1343,16 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 	vector<string> vErrorEntries;
 	//  Error output file text
 	string strErrorFileText = "";
+	//  List chunk start index
+	long lChunkStart = 0;
+	//  List chunk end index (exclusive)
+	long lChunkEnd = 0;
+	//  Journaled (completed) foreground table entries, by input file path name
+	unordered_map<string, string> umJournalEntries;
+	//  Resumed entry count
+	long lResumeCount = 0;
+	//  Journal file path name this rank appends to
+	string strRankJournalFilePathName = "";
 
 	try
 	{
@@ -1325,191 +1378,298 @@ bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFile
 							if (!bBackground)
 								vOutputTableEntries.resize(vFilePathNames.size());
 
+							//  Initialize CDS table vector if not background (entries stay empty without CDS breakdown)
+							if (!bBackground)
+								vCDSTableEntries.resize(vFilePathNames.size());
+
 							//  Initialize error file vector
 							vErrorEntries.resize(vFilePathNames.size());
 
+							//  Read the resume journal of a previous (interrupted) foreground pass
+							if ((!bBackground) && (!strJournalFilePathName.empty()))
+							{
+								if (ReadFDistanceJournal(strJournalFilePathName, umJournalEntries))
+									ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Resume Journal [" + strJournalFilePathName + "] Entries = " + ConvertLongToString((long)umJournalEntries.size()));
+								else
+									ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Resume Journal [" + strJournalFilePathName + "] Read Failed; All Entries Will be Processed");
+
+								//  Ranks append to their own journal (appends are only locked within a rank); create it, so rank journals stay contiguous
+								strRankJournalFilePathName = GetRankFilePathNameMPI(strJournalFilePathName);
+								if (GetRankCountMPI() > 1)
+								{
+									string strEmpty = "";
+
+									if (!AppendFileText(strRankJournalFilePathName, strEmpty))
+										ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Resume Journal [" + strRankJournalFilePathName + "] Creation Failed");
+								}
+							}
+
 							//  Initialize time stamp lock
 							omp_init_lock(&lockList);
 
-							//  Declare team size
-							#pragma omp parallel shared(m_unaBackground16, vOutputTableEntries) num_threads(nMaxProcs)
+							//  Open the list in chunks; the whole list is one chunk, unless distributed across MPI ranks
+							OpenListChunksMPI((long)vFilePathNames.size(), !bBackground, (long)nMaxProcs * 4);
+
+							//  Process the chunks of this rank
+							while (GetNextListChunkMPI(lChunkStart, lChunkEnd))
 							{
-								#pragma omp for
-								for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+								//  Declare team size
+								#pragma omp parallel shared(m_unaBackground16, vOutputTableEntries) num_threads(nMaxProcs)
 								{
-									//  Test max procs
-									if (lCount == 0)
+									#pragma omp for
+									for (long lCount = lChunkStart; lCount < lChunkEnd; lCount++)
 									{
-										omp_set_lock(&lockList);
-										ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
-										omp_unset_lock(&lockList);
-									}
+										//  Test max procs
+										if (lCount == 0)
+										{
+											omp_set_lock(&lockList);
+											ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
+											omp_unset_lock(&lockList);
+										}
 
-									//  Update for timestamp every 10,000 files
-									if (lCount % 10000 == 0)
-									{
-										omp_set_lock(&lockList);
-										ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
-										omp_unset_lock(&lockList);
-									}
+										//  Update for timestamp every 10,000 files
+										if (lCount % 10000 == 0)
+										{
+											omp_set_lock(&lockList);
+											ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
+											omp_unset_lock(&lockList);
+										}
 
 
-									//  If the file  name is not empty
-									if (!vFilePathNames[lCount].empty())
-									{
-										//  Sequence file text
-										string strSequenceFileText = "";
-										//  Working file path name
-										string strWorkingFilePathName = "";
-
-										//  If input file path name transform is not empty
-										if (!strInputFilePathNameTransform.empty())
-											strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
-										else
-											strWorkingFilePathName = vFilePathNames[lCount];
-
-										//  Get sequence file text
-										if (GetFileText(strWorkingFilePathName, strSequenceFileText))
-										{
-											//  Accession
-											string strAccession = "";
+										//  Resumed from journal, if true
+										bool bResumed = false;
 
-											//  Get Accession
-											strAccession = GetAccessionFromFileHeader(strSequenceFileText);
+										//  If the input was completed by a previous pass and its output validates, reuse the journaled table entry
+										if ((!bBackground) && (!umJournalEntries.empty()) && (!vFilePathNames[lCount].empty()))
+										{
+											//  Journal entry iterator
+											unordered_map<string, string>::iterator itJournal = umJournalEntries.find(vFilePathNames[lCount]);
 
-											if (!strAccession.empty())
+											if (itJournal != umJournalEntries.end())
 											{
-												//  Catalog entry
-												CBase123_Catalog_Entry ceGet;
+												//  Working file path name
+												string strWorkingFilePathName = "";
+												//  Output file path name
+												string strOutputFilePathName = "";
+
+												//  If input file path name transform is not empty
+												if (!strInputFilePathNameTransform.empty())
+													strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
+												else
+													strWorkingFilePathName = vFilePathNames[lCount];
 
-												//vbContinue = b123Catalog.GetEntryByAccession(strAccession, ceGet);
-												if (b123Catalog.GetEntryByAccession(strAccession, ceGet))
-												{
-													//  Sequence
-													string strForward = "";
+												//  Get output file path name
+												strOutputFilePathName = GetFDistanceOutputFilePathName(strWorkingFilePathName, strOutputFileNameSuffix);
 
-													//  Get sequence
-													strForward = GetSequenceFromFAFile(strSequenceFileText);
+												//  Validate output and reuse table entry
+												if (ValidateFDistanceOutput(strOutputFilePathName, itJournal->second, (bBidirectional ? 2 : 1)))
+												{
+													vOutputTableEntries[lCount] = itJournal->second;
+													bResumed = true;
 
-													//  Process forward sequence
-													if (!strForward.empty())
+													//  Rebuild CDS table entries from the validated output
+													if (bCDSBreakdown)
 													{
-														// If sequence is circular
-														if (ceGet.GetStrandednessType() == "c")
+														//  Accession (first table field)
+														string strAccession = itJournal->second.substr(0, itJournal->second.find('~'));
+														//  CDS collection
+														vector<structCDS>* pvCDSs = b123Catalog.GetCDSCollectionPointerByAccession(strAccession);
+														//  Forward output
+														string strForwardOutput = "";
+														//  Reverse output
+														string strReverseOutput = "";
+
+														//  Sequence length is recovered from the forward count, the engine scores (length - 2 * (nMer - 1)) nMers per direction
+														if ((pvCDSs == NULL) || (!ReadFDistanceOutput(strOutputFilePathName, strForwardOutput, strReverseOutput)) || (!CompileFDistanceCDSTableOutput(strAccession, strForwardOutput, strReverseOutput, (long)strForwardOutput.length() + (2 * (nNMerLength - 1)), nNMerLength, *pvCDSs, vCDSTableEntries[lCount])))
 														{
-															//  Circularize
-															strForward += strForward.substr(0, nNMerLength - 1);
+															omp_set_lock(&lockList);
+															ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Resumed Entry [" + strWorkingFilePathName + "] CDS Table Compilation Failed");
+															omp_unset_lock(&lockList);
 														}
+													}
+
+													#pragma omp atomic
+													lResumeCount++;
+												}
+											}
+										}
+
+										//  If the file  name is not empty
+										if ((!vFilePathNames[lCount].empty()) && (!bResumed))
+										{
+											//  Sequence file text
+											string strSequenceFileText = "";
+											//  Working file path name
+											string strWorkingFilePathName = "";
+
+											//  If input file path name transform is not empty
+											if (!strInputFilePathNameTransform.empty())
+												strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
+											else
+												strWorkingFilePathName = vFilePathNames[lCount];
+
+											//  Get sequence file text
+											if (b123Archive.GetFAFileText(strWorkingFilePathName, strSequenceFileText))
+											{
+												//  Accession
+												string strAccession = "";
+
+												//  Get Accession
+												strAccession = GetAccessionFromFileHeader(strSequenceFileText);
+
+												if (!strAccession.empty())
+												{
+													//  Catalog entry
+													CBase123_Catalog_Entry* pceGet = b123Catalog.GetEntryPointerByAccession(strAccession);
+
+													if (pceGet != NULL)
+													{
+														//  Sequence
+														string strForward = "";
 
-														//  Process background sequence
-														if (bBackground)
+														//  Get sequence
+														strForward = GetSequenceFromFAFile(strSequenceFileText);
+
+														//  Process forward sequence
+														if (!strForward.empty())
 														{
-															//  Process background forward
-															//vbContinue = ProcessBackground16(strForward, nNMerLength, bAllowUnknowns);
-															if (ProcessBackground16(strForward, nNMerLength, bAllowUnknowns))
+															// If sequence is circular
+															if (pceGet->GetStrandednessType() == "c")
 															{
-																//  If bidirectional processing required
-																if (bBidirectional)
-																{
-																	//  Reverse compliment
-																	string strReverse = "";
-
-																	//  Get reverse compliment
-																	strReverse = ConvertToReverseCompliment(strForward);
+																//  Circularize
+																strForward += strForward.substr(0, nNMerLength - 1);
+															}
 
-																	//  Process background reverse compliment
-																	//vbContinue = ProcessBackground16(strReverse, nNMerLength, bAllowUnknowns);
-																	if (!ProcessBackground16(strReverse, nNMerLength, bAllowUnknowns))
+															//  Process background sequence
+															if (bBackground)
+															{
+																//  Process background forward
+																//vbContinue = ProcessBackground16(strForward, nNMerLength, bAllowUnknowns);
+																if (ProcessBackground16(strForward, nNMerLength, bAllowUnknowns))
+																{
+																	//  If bidirectional processing required
+																	if (bBidirectional)
 																	{
-																		vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Reverse) Analysis Failed\n";
-
-																		omp_set_lock(&lockList);
-																		ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Background Reverse Sequence [" + strWorkingFilePathName + "] Process Failed");
-																		omp_unset_lock(&lockList);
+																		//  Reverse compliment
+																		string strReverse = "";
+
+																		//  Get reverse compliment
+																		strReverse = ConvertToReverseCompliment(strForward);
+
+																		//  Process background reverse compliment
+																		//vbContinue = ProcessBackground16(strReverse, nNMerLength, bAllowUnknowns);
+																		if (!ProcessBackground16(strReverse, nNMerLength, bAllowUnknowns))
+																		{
+																			vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Reverse) Analysis Failed\n";
+
+																			omp_set_lock(&lockList);
+																			ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Background Reverse Sequence [" + strWorkingFilePathName + "] Process Failed");
+																			omp_unset_lock(&lockList);
+																		}
 																	}
 																}
+																else
+																{
+																	vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Forward) Analysis Failed\n";
+
+																	omp_set_lock(&lockList);
+																	ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Background Forward Sequence [" + strWorkingFilePathName + "] Process Failed");
+																	omp_unset_lock(&lockList);
+																}
 															}
+															//  Process foreground sequence
 															else
 															{
-																vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Forward) Analysis Failed\n";
+																//  Output file path name
+																string strOutputFilePathName = "";
+
+																//  Get output file path name
+																strOutputFilePathName = GetFDistanceOutputFilePathName(strWorkingFilePathName, strOutputFileNameSuffix);
+
+																if (!ProcessForeground16(strOutputFilePathName, strAccession, strForward, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[lCount], (bCDSBreakdown ? pceGet->GetCDSCollectionPointer() : NULL), vCDSTableEntries[lCount]))
+																{
+																	vErrorEntries[lCount] = strWorkingFilePathName + "~Foreground Analysis Failed\n";
+
+																	omp_set_lock(&lockList);
+																	ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Foreground Sequence [" + strWorkingFilePathName + "] Process Failed");
+																	omp_unset_lock(&lockList);
+																}
+																//  Journal the completed input, so an interrupted pass can resume here
+																else if (!strRankJournalFilePathName.empty())
+																{
+																	//  Journal entry
+																	string strJournalEntry = vFilePathNames[lCount] + "|" + vOutputTableEntries[lCount] + "\n";
 
-																omp_set_lock(&lockList);
-																ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Background Forward Sequence [" + strWorkingFilePathName + "] Process Failed");
-																omp_unset_lock(&lockList);
+																	omp_set_lock(&lockList);
+																	if (!AppendFileText(strRankJournalFilePathName, strJournalEntry))
+																		ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Resume Journal [" + strRankJournalFilePathName + "] Append Failed");
+																	omp_unset_lock(&lockList);
+																}
 															}
 														}
-														//  Process foreground sequence
 														else
 														{
-															//  Output file path name
-															string strOutputFilePathName = "";
-															//  Path delimiter
-															char chrPathDelimiter = strPathDelimiter;
-
-															//  Get base path name and concatenate output file path name
-															if(!strOutputFileNameSuffix.empty())
-																strOutputFilePathName = GetBasePath(strWorkingFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(strWorkingFilePathName) + "." + strOutputFileNameSuffix + ".fdist";
-															else
-																strOutputFilePathName = GetBasePath(strWorkingFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(strWorkingFilePathName) + ".fdist";
+															vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Sequence\n";
 
-															if (!ProcessForeground16(strOutputFilePathName, strAccession, strForward, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[lCount]))
-															{
-																vErrorEntries[lCount] = strWorkingFilePathName + "~Foreground Analysis Failed\n";
-
-																omp_set_lock(&lockList);
-																ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Foreground Sequence [" + strWorkingFilePathName + "] Process Failed");
-																omp_unset_lock(&lockList);
-															}
+															omp_set_lock(&lockList);
+															ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Sequence is Empty");
+															omp_unset_lock(&lockList);
 														}
 													}
 													else
 													{
-														vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Sequence\n";
+														vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Accession Search Failed\n";
 
 														omp_set_lock(&lockList);
-														ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Sequence is Empty");
+														ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Catalog Accession [" + strAccession + "] Search Failed");
 														omp_unset_lock(&lockList);
 													}
+
+													//  Clear accession
+													strAccession = "";
 												}
 												else
 												{
-													vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Accession Search Failed\n";
+													vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Accession\n";
 
 													omp_set_lock(&lockList);
-													ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Catalog Accession [" + strAccession + "] Search Failed");
+													ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Accession is Empty");
 													omp_unset_lock(&lockList);
 												}
-
-												//  Clear accession
-												strAccession = "";
 											}
 											else
 											{
-												vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Accession\n";
+												vErrorEntries[lCount] = strWorkingFilePathName + "~File Open Failed\n";
 
 												omp_set_lock(&lockList);
-												ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Accession is Empty");
+												ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Open Failed");
 												omp_unset_lock(&lockList);
 											}
 										}
-										else
-										{
-											vErrorEntries[lCount] = strWorkingFilePathName + "~File Open Failed\n";
-
-											omp_set_lock(&lockList);
-											ReportTimeStamp("[ProcessFDistanceList16]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Open Failed");
-											omp_unset_lock(&lockList);
-										}
+										//  Report no error, empty lines should not be present
 									}
-									//  Report no error, empty lines should not be present
 								}
 							}
 
+							//  Close the chunked list
+							CloseListChunksMPI();
+
+							//  Gather table and error entries on rank 0
+							if (!bBackground)
+								GatherListEntriesMPI(vOutputTableEntries);
+							if ((!bBackground) && (bCDSBreakdown))
+								GatherListEntriesMPI(vCDSTableEntries);
+							GatherListEntriesMPI(vErrorEntries);
+
 							//  Destroy time stamp lock
 							omp_destroy_lock(&lockList);
 
-							//  Write error file
-							if (!strErrorFilePathName.empty())
+							//  Report resumed entries
+							if (lResumeCount > 0)
+								ReportTimeStamp("[ProcessFDistanceList16]", "NOTE:  Resumed Entries (Validated Output) = " + ConvertLongToString(lResumeCount));
+
+							//  Write error file (rank 0)
+							if ((!strErrorFilePathName.empty()) && (IsRootMPI()))
 							{
 								//  Add header
 								strErrorFileText = "File Path Name~Error\n";
@@ -1604,6 +1764,44 @@ bool InitializeBackground16()
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Combines the background arrays loaded by each MPI rank (collective)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReduceBackground16()
+{
+	try
+	{
+		//  If background array is set
+		if (m_unaBackground16 != NULL)
+		{
+			//  Combine the background array and the poly-u flag
+			if ((ReduceBitwiseOrMPI(m_unaBackground16, UINT16_MAX)) && (ReduceLogicalOrMPI(m_bBackgroundPolyTU16)))
+				return true;
+			else
+			{
+				ReportTimeStamp("[ReduceBackground16]", "ERROR:  Background Reduction Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ReduceBackground16]", "ERROR:  Background Array is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReduceBackground16] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Destroys the background array
@@ -22,21 +22,24 @@
 
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
+#include "Base123_Sequence_Archive.h"
 
 uint16_t ConvertStringToSequence16(string strSequence);
 string ConvertSequenceToString16(uint16_t untSequence, int nNMerLength);
-bool WriteBackgroundArray16(string strOutputFilePathBaseName, int nNMerLength);
+uint64_t GetBackgroundWord16(uint64_t ullFirstRank);
+bool WriteBackgroundArray16(string strOutputFilePathBaseName, int nNMerLength, int nFormat, int nSet, int nMaxProcs);
 bool MutateOne16(uint16_t& untSequence);
 bool MutateTwo16(uint16_t& untSequence);
 bool MutateThree16(uint16_t& untSequence);
 bool MutateFour16(uint16_t& untSequence);
 int MutateSequence16(uint16_t& untSequence);
-bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, string& strOutputTableEntry);
+bool ProcessForeground16(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, string& strOutputTableEntry, vector<structCDS>* vpCDSs, string& strCDSTableEntries);
 bool MarkBackgroundSequence16(uint16_t& untSequence, int nNMerLength);
 bool MutateAndMarkBackgroundSequence16(string& strSequence, int nNMerLength);
 bool ProcessBackground16(string& strSequence, int nNMerLength, bool bBackgroundAllowUnknowns);
-bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, string strErrorFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs);
+bool ProcessFDistanceList16(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, CBase123_Sequence_Archive& b123Archive, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, string strErrorFilePathName, string strJournalFilePathName, vector<string>& vOutputTableEntries, bool bCDSBreakdown, vector<string>& vCDSTableEntries, int nMaxProcs);
 bool InitializeBackground16();
+bool ReduceBackground16();
 bool DestroyBackground16();
 bool InitializeWriteLock16();
 bool DestroyWriteLock16();
@@ -19,14 +19,17 @@
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
 #include "Base123_FDistance_32.h"
+#include "Base123_Background32.h"
+#include "Base123_MPI.h"
+#include "Base123_Background_Export.h"
 #include "Base123_Utilities.h"
 
 #include <math.h>
 #include <sstream>
 #include <omp.h>
 
-//  Background array
-uint32_t* m_unaBackground32 = NULL;
+//  Background collection
+CBase123_Background32 m_b123Background32;
 bool m_bBackgroundPolyTU32 = false;
 
 //  write lock
@@ -148,46 +151,73 @@ string ConvertSequenceToString32(uint32_t untSequence, int nNMerLength)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Writes the background array to file
+//  Gets the background membership of 64 consecutive nMers; the background export scan
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string] strOutputFilePathBaseName:  output file path name
+//  [uint64_t] ullFirstRank:  first nMer (a multiple of 64)
+//                        :  returns membership word; bit i is nMer ullFirstRank + i
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetBackgroundWord32(uint64_t ullFirstRank)
+{
+	//  Membership word
+	uint64_t ullWord = m_b123Background32.GetWord((uint32_t)ullFirstRank);
+
+	//  Poly-T is held outside of the background array
+	if ((ullFirstRank + 64 > UINT32_MAX) && (m_bBackgroundPolyTU32))
+		ullWord |= (uint64_t)1 << 63;
+
+	return ullWord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes the background array to file; the present and/or absent nMer sets are streamed, in
+//      parallel, to chunk files and a manifest (see Base123_Background_Export.h)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strOutputFilePathBaseName:  output file path base name
 //  [int] nNMerLength                 :  nMer length to convert
+//  [int] nFormat                     :  export format (text, 2-bit, or delta)
+//  [int] nSet                        :  export set (present, absent, or both)
+//  [int] nMaxProcs                   :  maximum processors for openMP
 //                                   :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool WriteBackgroundArray32(string strOutputFilePathBaseName, int nNMerLength)
+bool WriteBackgroundArray32(string strOutputFilePathBaseName, int nNMerLength, int nFormat, int nSet, int nMaxProcs)
 {
-	//  Present file test
-	string strPresentFileText = "";
-	//  Absent file text
-	string strAbsentFileText = "";
+	//  Return status
+	bool bStatusSuccess = true;
 
 	try
 	{
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			//  If output file path base name is not empty
 			if (!strOutputFilePathBaseName.empty())
 			{
-				//  Iterate background and concatenate file texts
-				for (uint32_t untCount = 0; untCount < UINT32_MAX; untCount++)
+				//  Write present nMers
+				if ((nSet & m_nBackgroundExportPresent) && (!ExportBackground(strOutputFilePathBaseName, nNMerLength, nFormat, true, GetBackgroundWord32, nMaxProcs)))
 				{
-					if (m_unaBackground32[untCount] == 0)
-						strAbsentFileText += ConvertSequenceToString32(untCount, nNMerLength) + "\n";
-					else
-						strPresentFileText += ConvertSequenceToString32(untCount, nNMerLength) + "\n";
+					ReportTimeStamp("[WriteBackgroundArray32]", "ERROR:  Present File Write Failed");
+
+					bStatusSuccess = false;
 				}
 
-				//  Write output
-				if (!WriteFileText(strOutputFilePathBaseName + "_absent.txt", strAbsentFileText))
+				//  Write absent nMers
+				if ((nSet & m_nBackgroundExportAbsent) && (!ExportBackground(strOutputFilePathBaseName, nNMerLength, nFormat, false, GetBackgroundWord32, nMaxProcs)))
+				{
 					ReportTimeStamp("[WriteBackgroundArray32]", "ERROR:  Absent File Write Failed");
 
-				if (!WriteFileText(strOutputFilePathBaseName + "_present.txt", strPresentFileText))
-					ReportTimeStamp("[WriteBackgroundArray32]", "ERROR:  Present File Write Failed");
+					bStatusSuccess = false;
+				}
+
+				return bStatusSuccess;
 			}
 			else
 			{
@@ -209,7 +239,9 @@ bool WriteBackgroundArray32(string strOutputFilePathBaseName, int nNMerLength)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Mutates the sequence one base at a time
+//  Mutates the sequence one base at a time; substitutions within the last four bases share the
+//      nMer's own bitset line and are probed first; the lines of the remaining substitutions are
+//      prefetched, so their misses overlap
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -222,53 +254,33 @@ bool MutateOne32(uint32_t& untSequence)
 {
 	try
 	{
-		//  Set position untPositionMask1 to last base position
-		uint32_t untPositionMask1 = 0b11;
-
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
-			//  Iterate through base positions
-			while (untPositionMask1 != 0)
-			{
-				//  Base at this position to be mutated
-				uint32_t untThisBase = untSequence & untPositionMask1;
-
-				//  Mutation base
-				uint32_t untMutationBase = untThisBase;
+			//  Poly-T is not stored in the background array
+			if (untSequence == UINT32_MAX)
+				return m_bBackgroundPolyTU32;
 
-				//  Sequence untPositionMask1 with position hole
-				uint32_t untSequenceMask = 0b11111111111111111111111111111111 & untPositionMask1;
+			//  Prefetch the lines of substitutions outside the nMer's own line
+			for (int nPosition = m_nBackgroundLinePositions; nPosition < 16; nPosition++)
+			{
+				for (uint32_t untVariant = 1; untVariant < 4; untVariant++)
+					m_b123Background32.Prefetch(untSequence ^ (untVariant << (2 * nPosition)));
+			}
 
-				//  Iterate every other base at this position
-				//  (series at += is:  00 & 11 -> 11 & 11 -> 10 & 11 -> 01 & 11 -> 00 (original base)
-				//  So anding 11 three times gets ever possible next base EXCEPT current base
-				for (int lCountBases = 0; lCountBases < 3; lCountBases++)
+			//  Iterate through base positions, last base first
+			for (int nPosition = 0; nPosition < 16; nPosition++)
+			{
+				//  XOR with 01, 10, 11 gives every other base at this position
+				for (uint32_t untVariant = 1; untVariant < 4; untVariant++)
 				{
-					//  Add mutation base to sequence untPositionMask1 to get next base at this position
-					untMutationBase += untSequenceMask;
-
-					//  Mask out this next base
-					untMutationBase = untMutationBase & untPositionMask1;
+					//  Mutated sequence
+					uint32_t untIndex = untSequence ^ (untVariant << (2 * nPosition));
 
-					//  Flip untPositionMask1 bits to make a positional hole for insertaton of this next base
-					uint32_t untInsertMask = ~untPositionMask1;
-
-					//  Insert the new base at the current position in the original sequence to set the next mutational index
-					uint32_t untIndex = (untSequence & untInsertMask) + untMutationBase;	//insert the new letter
-					
 					//  Sequence is found in background after one mutation, any position
-					if (untSequence == UINT32_MAX)
-					{
-						if (m_bBackgroundPolyTU32)
-							return true;
-					}
-					else if((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+					if ((untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
 						return true;
 				}
-
-				//  Shift position untPositionMask1 leftward to next base position
-				untPositionMask1 = untPositionMask1 << 2;
 			}
 		}
 		else
@@ -286,12 +298,15 @@ bool MutateOne32(uint32_t& untSequence)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Mutates the sequence two base(s) at a time
+//  Mutates the sequence two base(s) at a time; position pairs are probed grouped by bitset line:
+//      pairs within the last four bases (the nMer's own line), then pairs with one position outside
+//      (one line per outside substitution, already touched by MutateOne32), then pairs with both
+//      outside (nine lines per pair, prefetched together)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  [uint32_t&] untSequence:  sequence to mutate
-//                        :  returns true, if sequence is found in background with one mutation; else, false
+//                        :  returns true, if sequence is found in background with two mutations; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -299,70 +314,77 @@ bool MutateTwo32(uint32_t& untSequence)
 {
 	try
 	{
-		//  Set position untPositionMask1 to last base position
-		uint32_t untPositionMask1 = 0b11;
-		//  Mutation base 1
-		uint32_t untMutationBase1 = untPositionMask1;
-		//  Set second position untPositionMask1 to net to last base position
-		uint32_t untPositionMask2 = 0b1100;
-		//  Mutation base 2
-		uint32_t untMutationBase2 = untPositionMask2;
-		//  Combined untPositionMask1
-		uint32_t untCombinedMask = 0;
-
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
-			//  Iterate through base positions
-			while (untPositionMask1 != 0)
+			//  Poly-T is not stored in the background array
+			if (untSequence == UINT32_MAX)
+				return m_bBackgroundPolyTU32;
+
+			//  Both positions within the nMer's own line
+			for (int nPosition1 = 0; nPosition1 < m_nBackgroundLinePositions; nPosition1++)
 			{
-				//  Iterate every base at second position
-				for (int lCountBases2 = 0; lCountBases2 < 4; lCountBases2++)
+				for (int nPosition2 = nPosition1 + 1; nPosition2 < m_nBackgroundLinePositions; nPosition2++)
 				{
-					//  Get next base at position 2
-					untMutationBase2 += untPositionMask2;
-					//  Isolate next base at position 2
-					untMutationBase2 = untMutationBase2 & untPositionMask2;
-
-					//  Iterate every base at first position
-					for (int lCountBases1 = 0; lCountBases1 < 4; lCountBases1++)
+					for (uint32_t untVariant1 = 1; untVariant1 < 4; untVariant1++)
 					{
-						//  Get next base at position 1
-						untMutationBase1 += untPositionMask1;
-						//  Isolate next base at position 1
-						untMutationBase1 = untMutationBase1 & untPositionMask1;
-
-						//  Combine the two mutation bases
-						uint32_t untCombinedMutationMask = untMutationBase2 + untMutationBase1;
-
-						//  Cbomine the position untPositionMask1s
-						untCombinedMask = untPositionMask2 + untPositionMask1;
-
-						//  Concatanet mutated sequence
-						uint32_t untIndex = (untSequence & ~untCombinedMask) + untCombinedMutationMask;
-																																	
-						//  Sequence is found in background after two mutations, any positions
-						if (untSequence == UINT32_MAX)
+						for (uint32_t untVariant2 = 1; untVariant2 < 4; untVariant2++)
 						{
-							if (m_bBackgroundPolyTU32)
+							//  Mutated sequence
+							uint32_t untIndex = untSequence ^ (untVariant1 << (2 * nPosition1)) ^ (untVariant2 << (2 * nPosition2));
+
+							if ((untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
 								return true;
 						}
-						else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
-							return true;
 					}
 				}
+			}
+
+			//  One position outside the nMer's line; each outside substitution fixes one line
+			for (int nPosition2 = m_nBackgroundLinePositions; nPosition2 < 16; nPosition2++)
+			{
+				for (uint32_t untVariant2 = 1; untVariant2 < 4; untVariant2++)
+				{
+					//  Sequence with the outside substitution
+					uint32_t untOuter = untSequence ^ (untVariant2 << (2 * nPosition2));
+
+					for (int nPosition1 = 0; nPosition1 < m_nBackgroundLinePositions; nPosition1++)
+					{
+						for (uint32_t untVariant1 = 1; untVariant1 < 4; untVariant1++)
+						{
+							//  Mutated sequence
+							uint32_t untIndex = untOuter ^ (untVariant1 << (2 * nPosition1));
 
-				//  Move to next mutational base position 2
-				untPositionMask2 = untPositionMask2 << 2;
-				//  If mutational base position 2 is at beginning of sequence, reset to the end
-				if (untPositionMask2 == 0)
-					untPositionMask2 = 0b11;
+							if ((untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
+								return true;
+						}
+					}
+				}
+			}
 
-				//  If mutational base position 2 == mutational base position 1, then shift both left to start next position 1
-				if (untPositionMask2 == untPositionMask1)
+			//  Both positions outside the nMer's line
+			for (int nPosition1 = m_nBackgroundLinePositions; nPosition1 < 16; nPosition1++)
+			{
+				for (int nPosition2 = nPosition1 + 1; nPosition2 < 16; nPosition2++)
 				{
-					untPositionMask1 = untPositionMask1 << 2;
-					untPositionMask2 = untPositionMask1 << 2;
+					//  Prefetch the nine lines of this pair
+					for (uint32_t untVariant1 = 1; untVariant1 < 4; untVariant1++)
+					{
+						for (uint32_t untVariant2 = 1; untVariant2 < 4; untVariant2++)
+							m_b123Background32.Prefetch(untSequence ^ (untVariant1 << (2 * nPosition1)) ^ (untVariant2 << (2 * nPosition2)));
+					}
+
+					for (uint32_t untVariant1 = 1; untVariant1 < 4; untVariant1++)
+					{
+						for (uint32_t untVariant2 = 1; untVariant2 < 4; untVariant2++)
+						{
+							//  Mutated sequence
+							uint32_t untIndex = untSequence ^ (untVariant1 << (2 * nPosition1)) ^ (untVariant2 << (2 * nPosition2));
+
+							if ((untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
+								return true;
+						}
+					}
 				}
 			}
 		}
@@ -403,7 +425,7 @@ bool MutateThree32(uint32_t& untSequence)
 		uint32_t untCombinedMask = 0;
 
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			while (untPositionMask1 != 0)
 			{
@@ -427,7 +449,7 @@ bool MutateThree32(uint32_t& untSequence)
 								if (m_bBackgroundPolyTU32)
 									return true;
 							}
-							else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+							else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
 								return true;
 						}
 					}
@@ -485,7 +507,7 @@ bool MutateFour32(uint32_t& untSequence)
 		uint32_t untCombinedMask = 0;
 
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			while (untPositionMask1 != 0)
 			{
@@ -513,7 +535,7 @@ bool MutateFour32(uint32_t& untSequence)
 									if (m_bBackgroundPolyTU32)
 										return true;
 								}
-								else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+								else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
 									return true;
 							}
 						}
@@ -578,7 +600,7 @@ bool MutateFive32(uint32_t& untSequence)
 		uint32_t untCombinedMask = 0;
 
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			while (untPositionMask1 != 0)
 			{
@@ -610,7 +632,7 @@ bool MutateFive32(uint32_t& untSequence)
 										if (m_bBackgroundPolyTU32)
 											return true;
 									}
-									else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+									else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
 										return true;
 								}
 							}
@@ -683,7 +705,7 @@ bool MutateSix32(uint32_t& untSequence)
 		uint32_t untCombinedMask = 0;
 
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			while (untPositionMask1 != 0)
 			{
@@ -719,7 +741,7 @@ bool MutateSix32(uint32_t& untSequence)
 											if (m_bBackgroundPolyTU32)
 												return true;
 										}
-										else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+										else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
 											return true;
 									}
 								}
@@ -800,7 +822,7 @@ bool MutateSeven32(uint32_t& untSequence)
 		uint32_t untCombinedMask = 0;
 
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			while (untPositionMask1 != 0)
 			{
@@ -840,7 +862,7 @@ bool MutateSeven32(uint32_t& untSequence)
 												if (m_bBackgroundPolyTU32)
 													return true;
 											}
-											else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+											else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
 												return true;
 										}
 									}
@@ -929,7 +951,7 @@ bool MutateEight32(uint32_t& untSequence)
 		uint32_t untCombinedMask = 0;
 
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			while (untPositionMask1 != 0)
 			{
@@ -973,7 +995,7 @@ bool MutateEight32(uint32_t& untSequence)
 													if (m_bBackgroundPolyTU32)
 														return true;
 												}
-												else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_unaBackground32[untIndex] == 1))
+												else if ((untIndex >= 0) && (untIndex < UINT32_MAX) && (m_b123Background32.IsPresent(untIndex)))
 													return true;
 											}
 										}
@@ -1050,13 +1072,13 @@ int MutateSequence32(uint32_t& untSequence)
 	try
 	{
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			//  Get mutational count and store it at first position
 			if ((untSequence == UINT32_MAX) && (m_bBackgroundPolyTU32))
 				return 0;
 
-			if (m_unaBackground32[untSequence] == 1)
+			if ((untSequence < UINT32_MAX) && (m_b123Background32.IsPresent(untSequence)))
 				return 0;
 				
 			if (MutateOne32(untSequence))
@@ -1106,19 +1128,21 @@ int MutateSequence32(uint32_t& untSequence)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string&] strOutputFilePathName  :  output file path name
+//  [string&] strOutputFilePathName  :  output file path name; if empty, the sequence is scored only (no output file)
 //  [string&] strAccession           :  accession of sequence to process
 //  [string&] strSequence            :  sequence to process
 //  [bool] bBidirectional            :  process bidirectionally, if true
 //  [bool] bForegroundAllowUnknowns  :  process foreground unknown chracters, if true
 //  [int] nNMerLength                :  nMer length to analyze
 //  [string&] strOutputTableEntry    :  F-Distance table file text to concatenate
+//  [vector<structCDS>*] vpCDSs      :  CDS collection of the sequence; if NULL, no CDS table entries are compiled
+//  [string&] strCDSTableEntries     :  F-Distance CDS table entries to set
 //                                  :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
 bool ProcessForeground32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, 
-	string& strOutputTableEntry)
+	string& strOutputTableEntry, vector<structCDS>* vpCDSs, string& strCDSTableEntries)
 {
 	//  Character sequence
 	string strSubSequence = "";
@@ -1141,98 +1165,144 @@ bool ProcessForeground32(string& strOutputFilePathName, string& strAccession, st
 		uint32_t untNMer = 0b00;
 
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
-			//  If output file path name is not empty
-			if (!strOutputFilePathName.empty())
+			//  If accession is not empty
+			if (!strAccession.empty())
 			{
-				//  If accession is not empty
-				if (!strAccession.empty())
+				//  If the input sequence is not empty
+				if (!strSequence.empty())
 				{
-					//  If the input sequence is not empty
-					if (!strSequence.empty())
+					//  Reject sequences with gaps
+					if (strSequence.find_first_of('-') != string::npos)
 					{
-						//  Reject sequences with gaps
-						if (strSequence.find_first_of('-') != string::npos)
+						ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+
+						return false;
+					}
+					//  Reject sequences with poly-n
+					else if (strSequence.find("nnnnnnnnnnnnnnnn") != string::npos)
+					{
+						ReportTimeStamp("[ProcessForeground32]", "ERROR:  Input Sequence Contains Excessive Poly-n Bases");
+
+						return false;
+					}
+
+					//  If bidirectional, iterate process twice
+					if (bBidirectional)
+						nMaxProcess = 2;
+
+					//  Process iteration maximum, according to bidirectional flag
+					for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
+					{
+						//  Get reverse complement on second pass
+						if (nCountPass > 0)
+							strSequence = ConvertToReverseCompliment(strSequence);
+
+						//  Get first nMer
+						strSubSequence = strSequence.substr(0, nNMerLength);
+
+						//  Process known bases
+						if ((strSubSequence.find_first_of('r') != string::npos) ||
+							(strSubSequence.find_first_of('y') != string::npos) ||
+							(strSubSequence.find_first_of('k') != string::npos) ||
+							(strSubSequence.find_first_of('m') != string::npos) ||
+							(strSubSequence.find_first_of('s') != string::npos) ||
+							(strSubSequence.find_first_of('w') != string::npos) ||
+							(strSubSequence.find_first_of('b') != string::npos) ||
+							(strSubSequence.find_first_of('d') != string::npos) ||
+							(strSubSequence.find_first_of('h') != string::npos) ||
+							(strSubSequence.find_first_of('v') != string::npos) ||
+							(strSubSequence.find_first_of('n') != string::npos))
 						{
-							ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+							if (bForegroundAllowUnknowns)
+							{
+								/*
+								R	A or G	puRine
+								Y	C, T or U	pYrimidines
+								K	G, T or U	bases which are Ketones
+								M	A or C	bases with aMino groups
+								S	C or G	Strong interaction
+								W	A, T or U	Weak interaction
+								B	not A (i.e. C, G, T or U)	B comes after A
+								D	not C (i.e. A, G, T or U)	D comes after C
+								H	not G (i.e., A, C, T or U)	H comes after G
+								V	neither T nor U (i.e. A, C or G)	V comes after U
+								N	A C G T U	Nucleic acid
+								-	gap of indeterminate length
+								*/
+
+								strSubSequence = ReplaceInString(strSubSequence, "r", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "y", "c", false);
+								strSubSequence = ReplaceInString(strSubSequence, "k", "g", false);
+								strSubSequence = ReplaceInString(strSubSequence, "m", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "s", "c", false);
+								strSubSequence = ReplaceInString(strSubSequence, "w", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "b", "c", false);
+								strSubSequence = ReplaceInString(strSubSequence, "d", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "h", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "v", "a", false);
+								strSubSequence = ReplaceInString(strSubSequence, "n", "a", false);
+							}
+							else
+							{
+								ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
 
-							return false;
+								return false;
+							}
+						}
+
+						//  Get binary sequence
+						untSubSequence = ConvertStringToSequence32(strSubSequence);
+
+						//  Get mutation count
+						nMutationCount = MutateSequence32(untSubSequence);
+						if (nMutationCount >= 0)
+						{
+							//  Concatenate forward output
+							if (nCountPass == 0)
+								strForwardOutput += ConvertIntToString(nMutationCount);
+							else
+								strReverseOutput += ConvertIntToString(nMutationCount);
 						}
-						//  Reject sequences with poly-n
-						else if (strSequence.find("nnnnnnnnnnnnnnnn") != string::npos)
+						else
 						{
-							ReportTimeStamp("[ProcessForeground32]", "ERROR:  Input Sequence Contains Excessive Poly-n Bases");
+							ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString32(untSubSequence, nNMerLength) + "] @ [0] Mutation Failed or Mutation Failed or Mutation Count Exceeds Limit [8]");
 
 							return false;
 						}
 
-						//  If bidirectional, iterate process twice
-						if (bBidirectional)
-							nMaxProcess = 2;
-
-						//  Process iteration maximum, according to bidirectional flag
-						for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
+						//  Iterate subsequent nNMerLength characters to build remaing nMers
+						for (long lCountBases = nNMerLength; lCountBases < (strSequence.length() - nNMerLength) + 1; lCountBases++)
 						{
-							//  Get reverse complement on second pass
-							if (nCountPass > 0)
-								strSequence = ConvertToReverseCompliment(strSequence);
-
-							//  Get first nMer
-							strSubSequence = strSequence.substr(0, nNMerLength);
-
-							//  Process known bases
-							if ((strSubSequence.find_first_of('r') != string::npos) ||
-								(strSubSequence.find_first_of('y') != string::npos) ||
-								(strSubSequence.find_first_of('k') != string::npos) ||
-								(strSubSequence.find_first_of('m') != string::npos) ||
-								(strSubSequence.find_first_of('s') != string::npos) ||
-								(strSubSequence.find_first_of('w') != string::npos) ||
-								(strSubSequence.find_first_of('b') != string::npos) ||
-								(strSubSequence.find_first_of('d') != string::npos) ||
-								(strSubSequence.find_first_of('h') != string::npos) ||
-								(strSubSequence.find_first_of('v') != string::npos) ||
-								(strSubSequence.find_first_of('n') != string::npos))
+							//  Get base at this position
+							string strBase = strSequence.substr(lCountBases, 1);
+
+							//  Compare the character, shift the sequence and append the appropriate base
+							untSubSequence = untSubSequence << 2;
+							if (strBase.compare("-") == 0)
 							{
-								if (bForegroundAllowUnknowns)
-								{
-									/*
-									R	A or G	puRine
-									Y	C, T or U	pYrimidines
-									K	G, T or U	bases which are Ketones
-									M	A or C	bases with aMino groups
-									S	C or G	Strong interaction
-									W	A, T or U	Weak interaction
-									B	not A (i.e. C, G, T or U)	B comes after A
-									D	not C (i.e. A, G, T or U)	D comes after C
-									H	not G (i.e., A, C, T or U)	H comes after G
-									V	neither T nor U (i.e. A, C or G)	V comes after U
-									N	A C G T U	Nucleic acid
-									-	gap of indeterminate length
-									*/
-
-									strSubSequence = ReplaceInString(strSubSequence, "r", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "y", "c", false);
-									strSubSequence = ReplaceInString(strSubSequence, "k", "g", false);
-									strSubSequence = ReplaceInString(strSubSequence, "m", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "s", "c", false);
-									strSubSequence = ReplaceInString(strSubSequence, "w", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "b", "c", false);
-									strSubSequence = ReplaceInString(strSubSequence, "d", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "h", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "v", "a", false);
-									strSubSequence = ReplaceInString(strSubSequence, "n", "a", false);
-								}
-								else
-								{
-									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
+								ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
 
-									return false;
-								}
+								return false;
 							}
+							else if (strBase.compare("a") == 0)
+								untSubSequence += m_untA;
+							else if (strBase.compare("c") == 0)
+								untSubSequence += m_untC;
+							else if (strBase.compare("g") == 0)
+								untSubSequence += m_untG;
+							else if ((strBase.compare("t") == 0) || (strBase.compare("u") == 0))
+								untSubSequence += m_untTU;
+							//  Unknown character, this sequence is unsuitable to F-Distance analysis, mutate according to NCBI rules
+							else if (bForegroundAllowUnknowns)
+								untSubSequence += m_untA;
+							else
+							{
+								ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
 
-							//  Get binary sequence
-							untSubSequence = ConvertStringToSequence32(strSubSequence);
+								return false;
+							}
 
 							//  Get mutation count
 							nMutationCount = MutateSequence32(untSubSequence);
@@ -1246,91 +1316,44 @@ bool ProcessForeground32(string& strOutputFilePathName, string& strAccession, st
 							}
 							else
 							{
-								ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString32(untSubSequence, nNMerLength) + "] @ [0] Mutation Failed or Mutation Failed or Mutation Count Exceeds Limit [8]");
+								ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString32(untSubSequence, nNMerLength) + "] @ [" + ConvertLongToString(lCountBases) + "] Mutation Failed or Mutation Count Exceeds Limit [8]");
 
 								return false;
 							}
+						}
+					}
+				
+					//  Concatenate file text
+					strOutputFileText = strForwardOutput;
+					if (!strReverseOutput.empty())
+						strOutputFileText += "\n" + strReverseOutput;
 
-							//  Iterate subsequent nNMerLength characters to build remaing nMers
-							for (long lCountBases = nNMerLength; lCountBases < (strSequence.length() - nNMerLength) + 1; lCountBases++)
-							{
-								//  Get base at this position
-								string strBase = strSequence.substr(lCountBases, 1);
-
-								//  Compare the character, shift the sequence and append the appropriate base
-								untSubSequence = untSubSequence << 2;
-								if (strBase.compare("-") == 0)
-								{
-									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
-
-									return false;
-								}
-								else if (strBase.compare("a") == 0)
-									untSubSequence += m_untA;
-								else if (strBase.compare("c") == 0)
-									untSubSequence += m_untC;
-								else if (strBase.compare("g") == 0)
-									untSubSequence += m_untG;
-								else if ((strBase.compare("t") == 0) || (strBase.compare("u") == 0))
-									untSubSequence += m_untTU;
-								//  Unknown character, this sequence is unsuitable to F-Distance analysis, mutate according to NCBI rules
-								else if (bForegroundAllowUnknowns)
-									untSubSequence += m_untA;
-								else
-								{
-									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Contains Unknown Characters and -background_allow_unknowns [-bau] is Not Set");
-
-									return false;
-								}
-
-								//  Get mutation count
-								nMutationCount = MutateSequence32(untSubSequence);
-								if (nMutationCount >= 0)
-								{
-									//  Concatenate forward output
-									if (nCountPass == 0)
-										strForwardOutput += ConvertIntToString(nMutationCount);
-									else
-										strReverseOutput += ConvertIntToString(nMutationCount);
-								}
-								else
-								{
-									ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence [" + ConvertSequenceToString32(untSubSequence, nNMerLength) + "] @ [" + ConvertLongToString(lCountBases) + "] Mutation Failed or Mutation Count Exceeds Limit [8]");
+					//  Concatenate F-Distance table file text
+					if (CompileFDistanceTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, false, false))
+					{
+						//  Aggregate mutation counts into CDS and inter-CDS segments
+						if ((vpCDSs != NULL) && (!CompileFDistanceCDSTableOutput(strAccession, strForwardOutput, strReverseOutput, (long)strSequence.length(), nNMerLength, *vpCDSs, strCDSTableEntries)))
+							ReportTimeStamp("[ProcessForeground32]", "ERROR:  F-Distance CDS Table Compilation Failed");
 
-									return false;
-								}
-							}
-						}
-					
-						//  Concatenate file text
-						strOutputFileText = strForwardOutput;
-						if (!strReverseOutput.empty())
-							strOutputFileText += "\n" + strReverseOutput;
-
-						//  Concatenate F-Distance table file text
-						if (CompileFDistanceTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, false, false))
-						{
-							//  Write file text
-							return WriteFileText(strOutputFilePathName, strOutputFileText);
-						}
+						//  Write file text (score only, if no output file path name)
+						if (strOutputFilePathName.empty())
+							return true;
 						else
-						{
-							ReportTimeStamp("[ProcessForeground32]", "ERROR:  F-Distance Score Compilation Failed");
-						}
+							return WriteFileText(strOutputFilePathName, strOutputFileText);
 					}
 					else
 					{
-						ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence is Empty");
+						ReportTimeStamp("[ProcessForeground32]", "ERROR:  F-Distance Score Compilation Failed");
 					}
 				}
 				else
 				{
-					ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Accession is Empty");
+					ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence is Empty");
 				}
 			}
 			else
 			{
-				ReportTimeStamp("[ProcessForeground32]", "ERROR:  Output File Path Name is Empty");
+				ReportTimeStamp("[ProcessForeground32]", "ERROR:  Foreground Sequence Accession is Empty");
 			}
 		}
 		else
@@ -1363,16 +1386,13 @@ bool MarkBackgroundSequence32(uint32_t& untSequence, int nNMerLength)
 	try
 	{
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			//  Mark the first nMer in the background
 			if ((untSequence >= 0) && (untSequence < UINT32_MAX))
 			{
-				omp_set_lock(&writelock32);
-				m_unaBackground32[untSequence] = 1;
-				omp_unset_lock(&writelock32);
-
-				return true;
+				//  Background marking is thread-safe
+				return m_b123Background32.Mark(untSequence);
 			}
 			else if (untSequence == UINT32_MAX)
 			{
@@ -1428,7 +1448,7 @@ bool MutateAndMarkBackgroundSequence32(string& strSequence, int nNMerLength)
 	try
 	{
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			//  If the input sequence is not empty
 			if (!strSequence.empty())
@@ -1629,7 +1649,7 @@ bool ProcessBackground32(string& strSequence, int nNMerLength, bool bBackgroundA
 	try
 	{
 		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		if (m_b123Background32.IsSet())
 		{
 			//  If the input sequence is not empty
 			if (!strSequence.empty())
@@ -1771,20 +1791,25 @@ bool ProcessBackground32(string& strSequence, int nNMerLength, bool bBackgroundA
 //  [string] strInputListFilePathName     :  input file path name list
 //  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
 //  [CBase123_Catalog&] b123Catalog       :  Base123 genome catalog to use
+//  [CBase123_Sequence_Archive&] b123Archive:  sequence archive (if open, files are read from the archive)
 //  [bool] bBidirectional                 :  process bidirectional, if true
 //  [int] nNMerLength                     :  nMer length to analyze
 //  [bool] bBackground                    :  if true, process background; else, foreground
 //  [bool] bAllowUnknowns                 :  process unknown chracters, if true
 //  [string] strOutputFileNameSuffix      :  output file name suffix
 //  [string] strErrorFilePathName         :  error file base name
+//  [string] strJournalFilePathName       :  foreground resume journal file path name; if empty, no journal is kept
 //  [vector<string>&] vOutputTableEntries :  F-Distance table file text to concatenate
+//  [bool] bCDSBreakdown                  :  compile per-CDS table entries (foreground), if true
+//  [vector<string>&] vCDSTableEntries    :  F-Distance CDS table entries to set, one element per list entry
 //  [int] nMaxProcs                       :  maximum processors for openMP
 //                                       :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns,
-	string strOutputFileNameSuffix,	string strErrorFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs)
+bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, CBase123_Sequence_Archive& b123Archive, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns,
+	string strOutputFileNameSuffix,	string strErrorFilePathName, string strJournalFilePathName, vector<string>& vOutputTableEntries,
+	bool bCDSBreakdown, vector<string>& vCDSTableEntries, int nMaxProcs)
 {
 	//  List lock
 	omp_lock_t lockList;
@@ -1796,6 +1821,16 @@ bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFile
 	vector<string> vErrorEntries;
 	//  Error output file text
 	string strErrorFileText = "";
+	//  List chunk start index
+	long lChunkStart = 0;
+	//  List chunk end index (exclusive)
+	long lChunkEnd = 0;
+	//  Journaled (completed) foreground table entries, by input file path name
+	unordered_map<string, string> umJournalEntries;
+	//  Resumed entry count
+	long lResumeCount = 0;
+	//  Journal file path name this rank appends to
+	string strRankJournalFilePathName = "";
 
 	try
 	{
@@ -1806,7 +1841,7 @@ bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFile
 			if (nNMerLength > 0)
 			{
 				//  If background array is set
-				if (m_unaBackground32 != NULL)
+				if (m_b123Background32.IsSet())
 				{
 					//  Get list file text
 					if(GetFileText(strInputListFilePathName, strInputListFileText))
@@ -1821,189 +1856,297 @@ bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFile
 							if (!bBackground)
 								vOutputTableEntries.resize(vFilePathNames.size());
 
+							//  Initialize CDS table vector if not background (entries stay empty without CDS breakdown)
+							if (!bBackground)
+								vCDSTableEntries.resize(vFilePathNames.size());
+
 							//  Initialize error file vector
 							vErrorEntries.resize(vFilePathNames.size());
 
+							//  Read the resume journal of a previous (interrupted) foreground pass
+							if ((!bBackground) && (!strJournalFilePathName.empty()))
+							{
+								if (ReadFDistanceJournal(strJournalFilePathName, umJournalEntries))
+									ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Resume Journal [" + strJournalFilePathName + "] Entries = " + ConvertLongToString((long)umJournalEntries.size()));
+								else
+									ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Resume Journal [" + strJournalFilePathName + "] Read Failed; All Entries Will be Processed");
+
+								//  Ranks append to their own journal (appends are only locked within a rank); create it, so rank journals stay contiguous
+								strRankJournalFilePathName = GetRankFilePathNameMPI(strJournalFilePathName);
+								if (GetRankCountMPI() > 1)
+								{
+									string strEmpty = "";
+
+									if (!AppendFileText(strRankJournalFilePathName, strEmpty))
+										ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Resume Journal [" + strRankJournalFilePathName + "] Creation Failed");
+								}
+							}
+
 							//  Initialize time stamp lock
 							omp_init_lock(&lockList);
 
-							//  Declare omp parallel
-							#pragma omp parallel shared(m_unaBackground32, vOutputTableEntries) num_threads(nMaxProcs)
+							//  Open the list in chunks; the whole list is one chunk, unless distributed across MPI ranks
+							OpenListChunksMPI((long)vFilePathNames.size(), !bBackground, (long)nMaxProcs * 4);
+
+							//  Process the chunks of this rank
+							while (GetNextListChunkMPI(lChunkStart, lChunkEnd))
 							{
-								//  omp loop
-								#pragma omp for
-								for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+								//  Declare omp parallel
+								#pragma omp parallel shared(m_b123Background32, vOutputTableEntries) num_threads(nMaxProcs)
 								{
-									//  Test max procs
-									if (lCount == 0)
+									//  omp loop
+									#pragma omp for
+									for (long lCount = lChunkStart; lCount < lChunkEnd; lCount++)
 									{
-										omp_set_lock(&lockList);
-										ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
-										omp_unset_lock(&lockList);
-									}
-
-									//  Update for timestamp every 10,000 files
-									if (lCount % 10000 == 0)
-									{
-										omp_set_lock(&lockList);
-										ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
-										omp_unset_lock(&lockList);
-									}
+										//  Test max procs
+										if (lCount == 0)
+										{
+											omp_set_lock(&lockList);
+											ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Thread Count = " + ConvertIntToString(omp_get_num_threads()));
+											omp_unset_lock(&lockList);
+										}
 
-									//  If the file  name is not empty
-									if (!vFilePathNames[lCount].empty())
-									{
-										//  Sequence file text
-										string strSequenceFileText = "";
-										//  Working file path name
-										string strWorkingFilePathName = "";
-
-										//  If input file path name transform is not empty
-										if (!strInputFilePathNameTransform.empty())
-											strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
-										else
-											strWorkingFilePathName = vFilePathNames[lCount];
-
-										//  Get sequence file text
-										if (GetFileText(strWorkingFilePathName, strSequenceFileText))
+										//  Update for timestamp every 10,000 files
+										if (lCount % 10000 == 0)
 										{
-											//  Accession
-											string strAccession = "";
+											omp_set_lock(&lockList);
+											ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
+											omp_unset_lock(&lockList);
+										}
+
+										//  Resumed from journal, if true
+										bool bResumed = false;
 
-											//  Get Accession
-											strAccession = GetAccessionFromFileHeader(strSequenceFileText);
+										//  If the input was completed by a previous pass and its output validates, reuse the journaled table entry
+										if ((!bBackground) && (!umJournalEntries.empty()) && (!vFilePathNames[lCount].empty()))
+										{
+											//  Journal entry iterator
+											unordered_map<string, string>::iterator itJournal = umJournalEntries.find(vFilePathNames[lCount]);
 
-											if (!strAccession.empty())
+											if (itJournal != umJournalEntries.end())
 											{
-												//  Catalog entry
-												CBase123_Catalog_Entry ceGet;
+												//  Working file path name
+												string strWorkingFilePathName = "";
+												//  Output file path name
+												string strOutputFilePathName = "";
+
+												//  If input file path name transform is not empty
+												if (!strInputFilePathNameTransform.empty())
+													strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
+												else
+													strWorkingFilePathName = vFilePathNames[lCount];
 
-												//  Get entry
-												if (b123Catalog.GetEntryByAccession(strAccession, ceGet))
-												{
-													//  Sequence
-													string strForward = "";
+												//  Get output file path name
+												strOutputFilePathName = GetFDistanceOutputFilePathName(strWorkingFilePathName, strOutputFileNameSuffix);
 
-													//  Get sequence
-													strForward = GetSequenceFromFAFile(strSequenceFileText);
+												//  Validate output and reuse table entry
+												if (ValidateFDistanceOutput(strOutputFilePathName, itJournal->second, (bBidirectional ? 2 : 1)))
+												{
+													vOutputTableEntries[lCount] = itJournal->second;
+													bResumed = true;
 
-													//  Process forward sequence
-													if (!strForward.empty())
+													//  Rebuild CDS table entries from the validated output
+													if (bCDSBreakdown)
 													{
-														// If sequence is circular
-														if (ceGet.GetStrandednessType() == "c")
+														//  Accession (first table field)
+														string strAccession = itJournal->second.substr(0, itJournal->second.find('~'));
+														//  CDS collection
+														vector<structCDS>* pvCDSs = b123Catalog.GetCDSCollectionPointerByAccession(strAccession);
+														//  Forward output
+														string strForwardOutput = "";
+														//  Reverse output
+														string strReverseOutput = "";
+
+														//  Sequence length is recovered from the forward count, the engine scores (length - 2 * (nMer - 1)) nMers per direction
+														if ((pvCDSs == NULL) || (!ReadFDistanceOutput(strOutputFilePathName, strForwardOutput, strReverseOutput)) || (!CompileFDistanceCDSTableOutput(strAccession, strForwardOutput, strReverseOutput, (long)strForwardOutput.length() + (2 * (nNMerLength - 1)), nNMerLength, *pvCDSs, vCDSTableEntries[lCount])))
 														{
-															//  Circularize
-															strForward += strForward.substr(0, nNMerLength - 1);
+															omp_set_lock(&lockList);
+															ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Resumed Entry [" + strWorkingFilePathName + "] CDS Table Compilation Failed");
+															omp_unset_lock(&lockList);
 														}
+													}
+
+													#pragma omp atomic
+													lResumeCount++;
+												}
+											}
+										}
+
+										//  If the file  name is not empty
+										if ((!vFilePathNames[lCount].empty()) && (!bResumed))
+										{
+											//  Sequence file text
+											string strSequenceFileText = "";
+											//  Working file path name
+											string strWorkingFilePathName = "";
+
+											//  If input file path name transform is not empty
+											if (!strInputFilePathNameTransform.empty())
+												strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
+											else
+												strWorkingFilePathName = vFilePathNames[lCount];
+
+											//  Get sequence file text
+											if (b123Archive.GetFAFileText(strWorkingFilePathName, strSequenceFileText))
+											{
+												//  Accession
+												string strAccession = "";
+
+												//  Get Accession
+												strAccession = GetAccessionFromFileHeader(strSequenceFileText);
+
+												if (!strAccession.empty())
+												{
+													//  Catalog entry
+													CBase123_Catalog_Entry* pceGet = b123Catalog.GetEntryPointerByAccession(strAccession);
+
+													//  Get entry
+													if (pceGet != NULL)
+													{
+														//  Sequence
+														string strForward = "";
+
+														//  Get sequence
+														strForward = GetSequenceFromFAFile(strSequenceFileText);
 
-														//  Process background sequence
-														if (bBackground)
+														//  Process forward sequence
+														if (!strForward.empty())
 														{
-															//  Process background forward
-															if (ProcessBackground32(strForward, nNMerLength, bAllowUnknowns))
+															// If sequence is circular
+															if (pceGet->GetStrandednessType() == "c")
 															{
-																//  If bidirectional processing required
-																if (bBidirectional)
+																//  Circularize
+																strForward += strForward.substr(0, nNMerLength - 1);
+															}
+
+															//  Process background sequence
+															if (bBackground)
+															{
+																//  Process background forward
+																if (ProcessBackground32(strForward, nNMerLength, bAllowUnknowns))
 																{
-																	//  Reverse compliment
-																	string strReverse = "";
+																	//  If bidirectional processing required
+																	if (bBidirectional)
+																	{
+																		//  Reverse compliment
+																		string strReverse = "";
 
-																	//  Get reverse compliment
-																	strReverse = ConvertToReverseCompliment(strForward);
+																		//  Get reverse compliment
+																		strReverse = ConvertToReverseCompliment(strForward);
 
-																	//  Process background reverse compliment
-																	if (!ProcessBackground32(strReverse, nNMerLength, bAllowUnknowns))
-																	{
-																		vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Reverse) Analysis Failed\n";
+																		//  Process background reverse compliment
+																		if (!ProcessBackground32(strReverse, nNMerLength, bAllowUnknowns))
+																		{
+																			vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Reverse) Analysis Failed\n";
 
-																		omp_set_lock(&lockList);
-																		ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Reverse Sequence [" + strWorkingFilePathName + "] Process Failed");
-																		omp_unset_lock(&lockList);
+																			omp_set_lock(&lockList);
+																			ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Reverse Sequence [" + strWorkingFilePathName + "] Process Failed");
+																			omp_unset_lock(&lockList);
+																		}
 																	}
 																}
+																else
+																{
+																	vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Forward) Analysis Failed\n";
+
+																	omp_set_lock(&lockList);
+																	ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Forward Sequence [" + strWorkingFilePathName + "] Process Failed");
+																	omp_unset_lock(&lockList);
+																}
 															}
+															//  Process foreground sequence
 															else
 															{
-																vErrorEntries[lCount] = strWorkingFilePathName + "~Background (Forward) Analysis Failed\n";
+																//  Output file path name
+																string strOutputFilePathName = "";
 
-																omp_set_lock(&lockList);
-																ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Background Forward Sequence [" + strWorkingFilePathName + "] Process Failed");
-																omp_unset_lock(&lockList);
+																//  Get output file path name
+																strOutputFilePathName = GetFDistanceOutputFilePathName(strWorkingFilePathName, strOutputFileNameSuffix);
+
+																if (!ProcessForeground32(strOutputFilePathName, strAccession, strForward, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[lCount], (bCDSBreakdown ? pceGet->GetCDSCollectionPointer() : NULL), vCDSTableEntries[lCount]))
+																{
+																	vErrorEntries[lCount] = strWorkingFilePathName + "~Foreground Analysis Failed\n";
+
+																	omp_set_lock(&lockList);
+																	ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Foreground Sequence [" + strWorkingFilePathName + "] Process Failed");
+																	omp_unset_lock(&lockList);
+																}
+																//  Journal the completed input, so an interrupted pass can resume here
+																else if (!strRankJournalFilePathName.empty())
+																{
+																	//  Journal entry
+																	string strJournalEntry = vFilePathNames[lCount] + "|" + vOutputTableEntries[lCount] + "\n";
+
+																	omp_set_lock(&lockList);
+																	if (!AppendFileText(strRankJournalFilePathName, strJournalEntry))
+																		ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Resume Journal [" + strRankJournalFilePathName + "] Append Failed");
+																	omp_unset_lock(&lockList);
+																}
 															}
 														}
-														//  Process foreground sequence
 														else
 														{
-															//  Output file path name
-															string strOutputFilePathName = "";
-															//  Path delimiter
-															char chrPathDelimiter = strPathDelimiter;
-
-															//  Get base path name and concatenate output file path name
-															if (!strOutputFileNameSuffix.empty())
-																strOutputFilePathName = GetBasePath(strWorkingFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(strWorkingFilePathName) + "." + strOutputFileNameSuffix + ".fdist";
-															else
-																strOutputFilePathName = GetBasePath(strWorkingFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(strWorkingFilePathName) + ".fdist";
+															vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Sequence\n";
 
-															if (!ProcessForeground32(strOutputFilePathName, strAccession, strForward, bBidirectional, bAllowUnknowns, nNMerLength, vOutputTableEntries[lCount]))
-															{
-																vErrorEntries[lCount] = strWorkingFilePathName + "~Foreground Analysis Failed\n";
-
-																omp_set_lock(&lockList);
-																ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Foreground Sequence [" + strWorkingFilePathName + "] Process Failed");
-																omp_unset_lock(&lockList);
-															}
+															omp_set_lock(&lockList);
+															ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Sequence is Empty");
+															omp_unset_lock(&lockList);
 														}
 													}
 													else
 													{
-														vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Sequence\n";
+														vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Accession Search Failed\n";
 
 														omp_set_lock(&lockList);
-														ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Sequence is Empty");
+														ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Catalog Accession [" + strAccession + "] Search Failed");
 														omp_unset_lock(&lockList);
 													}
+
+													//  Clear accession
+													strAccession = "";
 												}
 												else
 												{
-													vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Accession Search Failed\n";
+													vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Accession\n";
 
 													omp_set_lock(&lockList);
-													ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Catalog Accession [" + strAccession + "] Search Failed");
+													ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Accession is Empty");
 													omp_unset_lock(&lockList);
 												}
-
-												//  Clear accession
-												strAccession = "";
 											}
 											else
 											{
-												vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Accession\n";
+												vErrorEntries[lCount] = strWorkingFilePathName + "~File Open Failed\n";
 
 												omp_set_lock(&lockList);
-												ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Accession is Empty");
+												ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Open Failed");
 												omp_unset_lock(&lockList);
 											}
 										}
-										else
-										{
-											vErrorEntries[lCount] = strWorkingFilePathName + "~File Open Failed\n";
-
-											omp_set_lock(&lockList);
-											ReportTimeStamp("[ProcessFDistanceList32]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Open Failed");
-											omp_unset_lock(&lockList);
-										}
+										//  Report no error, empty lines should not be present
 									}
-									//  Report no error, empty lines should not be present
 								}
 							}
 
+							//  Close the chunked list
+							CloseListChunksMPI();
+
+							//  Gather table and error entries on rank 0
+							if (!bBackground)
+								GatherListEntriesMPI(vOutputTableEntries);
+							if ((!bBackground) && (bCDSBreakdown))
+								GatherListEntriesMPI(vCDSTableEntries);
+							GatherListEntriesMPI(vErrorEntries);
+
 							//  Destroy time stamp lock
 							omp_destroy_lock(&lockList);
 
-							//  Write error file
-							if (!strErrorFilePathName.empty())
+							//  Report resumed entries
+							if (lResumeCount > 0)
+								ReportTimeStamp("[ProcessFDistanceList32]", "NOTE:  Resumed Entries (Validated Output) = " + ConvertLongToString(lResumeCount));
+
+							//  Write error file (rank 0)
+							if ((!strErrorFilePathName.empty()) && (IsRootMPI()))
 							{
 								//  Add header
 								strErrorFileText = "File Path Name~Error\n";
@@ -2060,28 +2203,28 @@ bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFile
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Initializes the background array
+//  Initializes the background collection for marking; the representation is selected by
+//      cardinality and memory budget once marked (see FinalizeBackground32)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  :  returns true, if successful; else, false
+//  [long] lMemoryBudget:  background memory budget, MB (0 = unlimited)
+//  [int] nMaxProcs     :  maximum processors for openMP
+//                     :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool InitializeBackground32()
+bool InitializeBackground32(long lMemoryBudget, int nMaxProcs)
 {
 	try
 	{
-		//  Initialize the background array
-		if (m_unaBackground32 == NULL)
-			m_unaBackground32 = new uint32_t[UINT32_MAX];
+		//  Initialize the background collection
+		m_bBackgroundPolyTU32 = false;
 
-		//  If background array is set
-		if (m_unaBackground32 != NULL)
+		//  If background collection is set
+		if (m_b123Background32.Initialize(lMemoryBudget, nMaxProcs))
 		{
-			//  Initialize background to 0
-			for (uint32_t untCount = 0; untCount < UINT32_MAX; untCount++)
-				m_unaBackground32[untCount] = 0;
+			ReportTimeStamp("[InitializeBackground32]", "NOTE:  Background Representation = " + m_b123Background32.GetTypeName());
 
 			return true;
 		}
@@ -2100,7 +2243,7 @@ bool InitializeBackground32()
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  Destroys the background array
+//  Combines the background collections loaded by each MPI rank (collective)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -2108,15 +2251,67 @@ bool InitializeBackground32()
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool DestroyBackground32()
+bool ReduceBackground32()
 {
 	try
 	{
-		//  If background array is set
-		if (m_unaBackground32 != NULL)
-			delete[] m_unaBackground32;
+		//  Combine the background collection and the poly-u flag
+		if ((m_b123Background32.Reduce()) && (ReduceLogicalOrMPI(m_bBackgroundPolyTU32)))
+			return true;
+		else
+		{
+			ReportTimeStamp("[ReduceBackground32]", "ERROR:  Background Reduction Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReduceBackground32] Exception Code:  " << ex.what() << "\n";
+	}
 
-		return true;
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Finalizes the background collection once loaded; may compress it to fit the memory budget
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool FinalizeBackground32()
+{
+	try
+	{
+		//  Finalize the background collection
+		return m_b123Background32.Finalize();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [FinalizeBackground32] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destroys the background collection
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool DestroyBackground32()
+{
+	try
+	{
+		//  Destroy the background collection
+		return m_b123Background32.Destroy();
 	}
 	catch (exception ex)
 	{
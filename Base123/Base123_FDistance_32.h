@@ -22,10 +22,12 @@
 
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
+#include "Base123_Sequence_Archive.h"
 
 uint32_t ConvertStringToSequence32(string strSequence);
 string ConvertSequenceToString32(uint32_t untSequence, int nNMerLength);
-bool WriteBackgroundArray32(string strOutputFilePathBaseName, int nNMerLength);
+uint64_t GetBackgroundWord32(uint64_t ullFirstRank);
+bool WriteBackgroundArray32(string strOutputFilePathBaseName, int nNMerLength, int nFormat, int nSet, int nMaxProcs);
 bool MutateOne32(uint32_t& untSequence);
 bool MutateTwo32(uint32_t& untSequence);
 bool MutateThree32(uint32_t& untSequence);
@@ -35,12 +37,14 @@ bool MutateSix32(uint32_t& untSequence);
 bool MutateSeven32(uint32_t& untSequence);
 bool MutateEight32(uint32_t& untSequence);
 int MutateSequence32(uint32_t& untSequence);
-bool ProcessForeground32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, string& strOutputTableEntry);
+bool ProcessForeground32(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bBidirectional, bool bForegroundAllowUnknowns, int nNMerLength, string& strOutputTableEntry, vector<structCDS>* vpCDSs, string& strCDSTableEntries);
 bool MarkBackgroundSequence32(uint32_t& untSequence, int nNMerLength);
 bool MutateAndMarkBackgroundSequence32(string& strSequence, int nNMerLength);
 bool ProcessBackground32(string& strSequence, int nNMerLength, bool bBackgroundAllowUnknowns);
-bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, string strErrorFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs);
-bool InitializeBackground32();
+bool ProcessFDistanceList32(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, CBase123_Sequence_Archive& b123Archive, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, string strErrorFilePathName, string strJournalFilePathName, vector<string>& vOutputTableEntries, bool bCDSBreakdown, vector<string>& vCDSTableEntries, int nMaxProcs);
+bool InitializeBackground32(long lMemoryBudget, int nMaxProcs);
+bool ReduceBackground32();
+bool FinalizeBackground32();
 bool DestroyBackground32();
 bool InitializeWriteLock32();
 bool DestroyWriteLock32();
@@ -0,0 +1,1201 @@
+// Base123_FDistance_AA.cpp : Performs Base123 translated (amino acid) Fofanov Distance analysis
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Performs Base123 translated Fofanov Distance Genomic Analysis; six-frame translates the foreground
+//      and background genomes and compares them at the amino acid polymer level; see
+//      ReportPerformFDistanceAnalysisHelp() function for operational details;
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Catalog_Entry.h"
+#include "Base123_Catalog.h"
+#include "Base123_FDistance_AA.h"
+#include "Base123_MPI.h"
+#include "Base123_Utilities.h"
+
+#include <math.h>
+#include <sstream>
+#include <omp.h>
+
+//  Standard genetic code, indexed by codon (t/u = 0, c = 1, a = 2, g = 3; first base most significant)
+const string m_strGeneticCodeAA = "FFLLSSSSYY**CC*WLLLLPPPPHHQQRRRRIIIMTTTTNNKKSSRRVVVVAAAADDEEGGGG";
+//  Amino acid alphabet, residue code is position
+const string m_strAlphabetAA = "ACDEFGHIKLMNPQRSTVWY";
+//  Reduced amino acid alphabet (Murphy 10), residue class by amino acid alphabet position
+//      (0 = ILMV, 1 = C, 2 = A, 3 = G, 4 = ST, 5 = P, 6 = FWY, 7 = DENQ, 8 = KR, 9 = H)
+const int m_naReducedAlphabetAA[20] = { 2, 1, 7, 7, 6, 3, 9, 0, 8, 0, 0, 7, 5, 7, 8, 4, 4, 0, 6, 6 };
+
+//  Background collection, dense bitset of packed amino acid nMers
+uint64_t* m_ullaBackgroundAA = NULL;
+//  Background collection, residue present by position (any background nMer)
+uint64_t* m_ullaPositionAA = NULL;
+//  Background collection, residue pair present by position pair (any background nMer)
+uint64_t* m_ullaPairAA = NULL;
+//  Background alphabet type
+int m_nAlphabetTypeAA = m_nAlphabetAminoAcid;
+//  Background alphabet size, residues
+int m_nAlphabetSizeAA = 20;
+//  Bits per packed residue
+int m_nResidueBitsAA = 5;
+//  Background nMer length, residues
+int m_nNMerLengthAA = 0;
+//  Background word count
+uint64_t m_ullBackgroundWordsAA = 0;
+//  Position table word count
+uint64_t m_ullPositionWordsAA = 0;
+//  Pair table word count
+uint64_t m_ullPairWordsAA = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the maximum amino acid nMer length that packs into the dense background
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nAlphabetType:  alphabet type (amino acid or reduced amino acid)
+//                    :  returns maximum nMer length, if successful; else, 0
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int GetMaxNMerLengthAA(int nAlphabetType)
+{
+	try
+	{
+		if (nAlphabetType == m_nAlphabetAminoAcid)
+			return m_nMaxAminoAcidNMerBits / 5;
+		else if (nAlphabetType == m_nAlphabetReducedAminoAcid)
+			return m_nMaxAminoAcidNMerBits / 4;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetMaxNMerLengthAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the alphabet name
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nAlphabetType:  alphabet type
+//                    :  returns alphabet name, if successful; else, an empty string
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetAlphabetNameAA(int nAlphabetType)
+{
+	try
+	{
+		if (nAlphabetType == m_nAlphabetNucleotide)
+			return "Nucleotide";
+		else if (nAlphabetType == m_nAlphabetAminoAcid)
+			return "Amino Acid";
+		else if (nAlphabetType == m_nAlphabetReducedAminoAcid)
+			return "Reduced Amino Acid";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetAlphabetNameAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return "";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Translates one reading frame of a nucleotide sequence to residue codes of the background alphabet;
+//      codons with unknown bases are resolved according to NCBI rules when allowed, else translated as unknown
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strSequence     :  nucleotide sequence to translate
+//  [int] nFrame              :  reading frame offset [0, 2]
+//  [bool] bAllowUnknowns     :  resolve unknown bases, if true
+//  [vector<int>&] vResidues  :  residue codes (m_nResidueStop and m_nResidueUnknown break nMers)
+//                           :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool TranslateSequenceAA(string& strSequence, int nFrame, bool bAllowUnknowns, vector<int>& vResidues)
+{
+	try
+	{
+		//  If the input sequence is not empty
+		if (!strSequence.empty())
+		{
+			//  If frame is properly set
+			if ((nFrame >= 0) && (nFrame <= 2))
+			{
+				vResidues.clear();
+				if (strSequence.length() > nFrame)
+					vResidues.reserve((strSequence.length() - nFrame) / 3);
+
+				//  Iterate codons
+				for (long lCountBases = nFrame; lCountBases + 2 < strSequence.length(); lCountBases += 3)
+				{
+					//  Codon index
+					int nCodon = 0;
+					//  Codon is known, if true
+					bool bKnown = true;
+
+					for (int nCount = 0; nCount < 3; nCount++)
+					{
+						//  Base at this position
+						char chrBase = tolower(strSequence[lCountBases + nCount]);
+
+						//  Resolve unknown characters according to NCBI rules
+						if (bAllowUnknowns)
+						{
+							if ((chrBase == 'r') || (chrBase == 'm') || (chrBase == 'w') || (chrBase == 'd') || (chrBase == 'h') || (chrBase == 'v') || (chrBase == 'n'))
+								chrBase = 'a';
+							else if ((chrBase == 'y') || (chrBase == 's') || (chrBase == 'b'))
+								chrBase = 'c';
+							else if (chrBase == 'k')
+								chrBase = 'g';
+						}
+
+						nCodon = nCodon << 2;
+						if ((chrBase == 't') || (chrBase == 'u'))
+							nCodon += 0;
+						else if (chrBase == 'c')
+							nCodon += 1;
+						else if (chrBase == 'a')
+							nCodon += 2;
+						else if (chrBase == 'g')
+							nCodon += 3;
+						else
+							bKnown = false;
+					}
+
+					if (!bKnown)
+						vResidues.push_back(m_nResidueUnknown);
+					else if (m_strGeneticCodeAA[nCodon] == '*')
+						vResidues.push_back(m_nResidueStop);
+					else
+					{
+						//  Residue code, amino acid alphabet
+						int nResidue = (int)m_strAlphabetAA.find(m_strGeneticCodeAA[nCodon]);
+
+						if (m_nAlphabetTypeAA == m_nAlphabetReducedAminoAcid)
+							nResidue = m_naReducedAlphabetAA[nResidue];
+
+						vResidues.push_back(nResidue);
+					}
+				}
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[TranslateSequenceAA]", "ERROR:  Reading Frame [" + ConvertIntToString(nFrame) + "] is Out of Range [0:2]");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[TranslateSequenceAA]", "ERROR:  Sequence is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [TranslateSequenceAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Marks a packed amino acid nMer present in the background container; also marks its residues
+//      by position and position pair, which bound the distance of otherwise distant foreground nMers
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  packed nMer to mark
+//                       :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool MarkBackgroundSequenceAA(uint32_t untSequence)
+{
+	//  Residue mask
+	uint32_t untResidueMask = (1 << m_nResidueBitsAA) - 1;
+
+	//  Word
+	uint64_t& ullWord = m_ullaBackgroundAA[untSequence >> 6];
+	//  Bit in word
+	uint64_t ullBit = (uint64_t)1 << (untSequence & 63);
+
+	//  Only first marks need touch the position tables
+	if ((ullWord & ullBit) != 0)
+		return true;
+
+	#pragma omp atomic
+	ullWord |= ullBit;
+
+	for (int nPosition1 = 0; nPosition1 < m_nNMerLengthAA; nPosition1++)
+	{
+		//  Residue at first position
+		uint32_t untResidue1 = (untSequence >> ((m_nNMerLengthAA - 1 - nPosition1) * m_nResidueBitsAA)) & untResidueMask;
+		//  Position index
+		uint32_t untPositionIndex = (nPosition1 << m_nResidueBitsAA) | untResidue1;
+
+		#pragma omp atomic
+		m_ullaPositionAA[untPositionIndex >> 6] |= (uint64_t)1 << (untPositionIndex & 63);
+
+		for (int nPosition2 = nPosition1 + 1; nPosition2 < m_nNMerLengthAA; nPosition2++)
+		{
+			//  Residue at second position
+			uint32_t untResidue2 = (untSequence >> ((m_nNMerLengthAA - 1 - nPosition2) * m_nResidueBitsAA)) & untResidueMask;
+			//  Pair index
+			uint32_t untPairIndex = ((((nPosition1 * m_nNMerLengthAA) + nPosition2) << (2 * m_nResidueBitsAA)) | (untResidue1 << m_nResidueBitsAA) | untResidue2);
+
+			#pragma omp atomic
+			m_ullaPairAA[untPairIndex >> 6] |= (uint64_t)1 << (untPairIndex & 63);
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Tests a packed amino acid nMer for presence in the background container
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  packed nMer to test
+//                       :  returns true, if present; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool IsPresentAA(uint32_t untSequence)
+{
+	return ((m_ullaBackgroundAA[untSequence >> 6] >> (untSequence & 63)) & 1) != 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Substitutes exactly nMutationCount residues (at or after nFirstPosition) and tests each substitution
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  packed nMer to mutate
+//  [int] nMutationCount  :  remaining substitutions
+//  [int] nFirstPosition  :  first residue position available for substitution
+//                       :  returns true, if sequence is found in background; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool MutateAA(uint32_t untSequence, int nMutationCount, int nFirstPosition)
+{
+	//  Residue mask
+	uint32_t untResidueMask = (1 << m_nResidueBitsAA) - 1;
+
+	for (int nPosition = nFirstPosition; nPosition <= m_nNMerLengthAA - nMutationCount; nPosition++)
+	{
+		//  Residue shift
+		int nShift = (m_nNMerLengthAA - 1 - nPosition) * m_nResidueBitsAA;
+		//  Original residue
+		uint32_t untOriginal = (untSequence >> nShift) & untResidueMask;
+		//  Sequence with residue hole
+		uint32_t untHole = untSequence & ~(untResidueMask << nShift);
+
+		for (uint32_t untResidue = 0; untResidue < m_nAlphabetSizeAA; untResidue++)
+		{
+			if (untResidue != untOriginal)
+			{
+				//  Mutated sequence
+				uint32_t untIndex = untHole | (untResidue << nShift);
+
+				if (nMutationCount == 1)
+				{
+					if (IsPresentAA(untIndex))
+						return true;
+				}
+				else if (MutateAA(untIndex, nMutationCount - 1, nPosition + 1))
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the minimum residue substitution count to find the nMer in the background; substitutions are
+//      enumerated up to nMer length - 3, after which the position and position pair tables answer directly
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint32_t] untSequence:  packed nMer to mutate
+//                       :  returns mutational count, if successful; else, -1
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int MutateSequenceAA(uint32_t untSequence)
+{
+	//  Residue mask
+	uint32_t untResidueMask = (1 << m_nResidueBitsAA) - 1;
+
+	try
+	{
+		//  If background array is set
+		if (m_ullaBackgroundAA != NULL)
+		{
+			if (IsPresentAA(untSequence))
+				return 0;
+
+			for (int nMutationCount = 1; nMutationCount <= m_nNMerLengthAA; nMutationCount++)
+			{
+				//  Enumerate substitutions
+				if (nMutationCount <= m_nNMerLengthAA - 3)
+				{
+					if (MutateAA(untSequence, nMutationCount, 0))
+						return nMutationCount;
+				}
+				//  Any background nMer sharing two residue positions
+				else if (nMutationCount == m_nNMerLengthAA - 2)
+				{
+					for (int nPosition1 = 0; nPosition1 < m_nNMerLengthAA; nPosition1++)
+					{
+						//  Residue at first position
+						uint32_t untResidue1 = (untSequence >> ((m_nNMerLengthAA - 1 - nPosition1) * m_nResidueBitsAA)) & untResidueMask;
+
+						for (int nPosition2 = nPosition1 + 1; nPosition2 < m_nNMerLengthAA; nPosition2++)
+						{
+							//  Residue at second position
+							uint32_t untResidue2 = (untSequence >> ((m_nNMerLengthAA - 1 - nPosition2) * m_nResidueBitsAA)) & untResidueMask;
+							//  Pair index
+							uint32_t untPairIndex = ((((nPosition1 * m_nNMerLengthAA) + nPosition2) << (2 * m_nResidueBitsAA)) | (untResidue1 << m_nResidueBitsAA) | untResidue2);
+
+							if ((m_ullaPairAA[untPairIndex >> 6] >> (untPairIndex & 63)) & 1)
+								return nMutationCount;
+						}
+					}
+				}
+				//  Any background nMer sharing one residue position
+				else if (nMutationCount == m_nNMerLengthAA - 1)
+				{
+					for (int nPosition = 0; nPosition < m_nNMerLengthAA; nPosition++)
+					{
+						//  Position index
+						uint32_t untPositionIndex = (nPosition << m_nResidueBitsAA) | ((untSequence >> ((m_nNMerLengthAA - 1 - nPosition) * m_nResidueBitsAA)) & untResidueMask);
+
+						if ((m_ullaPositionAA[untPositionIndex >> 6] >> (untPositionIndex & 63)) & 1)
+							return nMutationCount;
+					}
+				}
+				//  Any background nMer (first position residues fill the first word)
+				else if (m_ullaPositionAA[0] != 0)
+					return nMutationCount;
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[MutateSequenceAA]", "ERROR:  Background Collection is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [MutateSequenceAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Processes the foreground genome; six-frame translates the sequence (three frames, if unidirectional;
+//      frame one, if an ORF) and scores each amino acid nMer by minimum residue substitutions; nMers
+//      spanning stop or unknown codons are not scored; each direction is one output line, its frames
+//      separated by m_chFDistanceFrameDelimiter, so scores stay aligned with the residues of their frame;
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strOutputFilePathName  :  output file path name
+//  [string&] strAccession           :  accession of sequence to process
+//  [string&] strSequence            :  sequence to process
+//  [bool] bIsORF                    :  sequence is an ORF (translate frame one only), if true
+//  [bool] bBidirectional            :  process bidirectionally, if true
+//  [bool] bForegroundAllowUnknowns  :  process foreground unknown chracters, if true
+//  [string&] strOutputTableEntry    :  F-Distance table file text to concatenate
+//                                  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessForegroundAA(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bIsORF, bool bBidirectional, bool bForegroundAllowUnknowns,
+	string& strOutputTableEntry)
+{
+	//  Mutational count
+	int nMutationCount = 0;
+	//  Process iteration maximum, according to bidirectional flag
+	int nMaxProcess = 1;
+	//  Frame iteration maximum
+	int nMaxFrame = 3;
+	//  Forward output string
+	string strForwardOutput = "";
+	//  Reverse output string
+	string strReverseOutput = "";
+	//  Output file text
+	string strOutputFileText = "";
+	//  Translated residues
+	vector<int> vResidues;
+	//  Pass sequence
+	string strPassSequence = "";
+
+	try
+	{
+		//  If background array is set
+		if (m_ullaBackgroundAA != NULL)
+		{
+			//  If output file path name is not empty
+			if (!strOutputFilePathName.empty())
+			{
+				//  If accession is not empty
+				if (!strAccession.empty())
+				{
+					//  If the input sequence is not empty
+					if (!strSequence.empty())
+					{
+						//  Reject sequences with gaps
+						if (strSequence.find_first_of('-') != string::npos)
+						{
+							ReportTimeStamp("[ProcessForegroundAA]", "ERROR:  Foreground Sequence Contains a Gap of Indeterminate Length");
+
+							return false;
+						}
+
+						//  An ORF is read in its own frame and direction
+						if (bIsORF)
+							nMaxFrame = 1;
+						//  If bidirectional, iterate process twice
+						else if (bBidirectional)
+							nMaxProcess = 2;
+
+						//  Process iteration maximum, according to bidirectional flag
+						for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
+						{
+							//  Get reverse complement on second pass
+							if (nCountPass > 0)
+								strPassSequence = ConvertToReverseCompliment(strSequence);
+							else
+								strPassSequence = strSequence;
+
+							for (int nFrame = 0; nFrame < nMaxFrame; nFrame++)
+							{
+								//  Delimit frames
+								if (nFrame > 0)
+								{
+									if (nCountPass == 0)
+										strForwardOutput += m_chFDistanceFrameDelimiter;
+									else
+										strReverseOutput += m_chFDistanceFrameDelimiter;
+								}
+
+								//  Packed nMer
+								uint32_t untSubSequence = 0;
+								//  Packed nMer mask
+								uint32_t untNMerMask = (uint32_t)(((uint64_t)1 << (m_nNMerLengthAA * m_nResidueBitsAA)) - 1);
+								//  Consecutive scorable residues
+								int nRunLength = 0;
+
+								if (!TranslateSequenceAA(strPassSequence, nFrame, bForegroundAllowUnknowns, vResidues))
+									return false;
+
+								for (long lCountResidues = 0; lCountResidues < vResidues.size(); lCountResidues++)
+								{
+									//  Stop or unknown codon, restart nMer
+									if (vResidues[lCountResidues] < 0)
+									{
+										nRunLength = 0;
+										untSubSequence = 0;
+										continue;
+									}
+
+									untSubSequence = ((untSubSequence << m_nResidueBitsAA) | (uint32_t)vResidues[lCountResidues]) & untNMerMask;
+									nRunLength++;
+
+									if (nRunLength >= m_nNMerLengthAA)
+									{
+										//  Get mutation count
+										nMutationCount = MutateSequenceAA(untSubSequence);
+										if (nMutationCount >= 0)
+										{
+											//  Concatenate forward output
+											if (nCountPass == 0)
+												strForwardOutput += ConvertIntToString(nMutationCount);
+											else
+												strReverseOutput += ConvertIntToString(nMutationCount);
+										}
+										else
+										{
+											ReportTimeStamp("[ProcessForegroundAA]", "ERROR:  Foreground Residue nMer @ [" + ConvertLongToString(lCountResidues) + "] Frame [" + ConvertIntToString(nFrame + 1) + "] Mutation Failed");
+
+											return false;
+										}
+									}
+								}
+							}
+						}
+
+						//  No scorable nMers (short or stop-riddled sequence)
+						if ((strForwardOutput.find_first_not_of(m_chFDistanceFrameDelimiter) == string::npos) && (strReverseOutput.find_first_not_of(m_chFDistanceFrameDelimiter) == string::npos))
+						{
+							ReportTimeStamp("[ProcessForegroundAA]", "ERROR:  Foreground Sequence [" + strAccession + "] Contains No Open Amino Acid nMers");
+
+							return false;
+						}
+
+						//  Concatenate file text
+						strOutputFileText = strForwardOutput;
+						if (!strReverseOutput.empty())
+							strOutputFileText += "\n" + strReverseOutput;
+
+						//  Concatenate F-Distance table file text
+						if (CompileFDistanceTableOutput(strAccession, strForwardOutput, strReverseOutput, strOutputTableEntry, false, false))
+						{
+							//  Write file text
+							return WriteFileText(strOutputFilePathName, strOutputFileText);
+						}
+						else
+						{
+							ReportTimeStamp("[ProcessForegroundAA]", "ERROR:  F-Distance Score Compilation Failed");
+						}
+					}
+					else
+					{
+						ReportTimeStamp("[ProcessForegroundAA]", "ERROR:  Foreground Sequence is Empty");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ProcessForegroundAA]", "ERROR:  Foreground Sequence Accession is Empty");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ProcessForegroundAA]", "ERROR:  Output File Path Name is Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ProcessForegroundAA]", "ERROR:  Background Collection is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessForegroundAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Processes the background genome; marks the amino acid nMers of every translated frame present
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strSequence           :  sequence to process
+//  [bool] bBidirectional           :  translate the reverse compliment frames, if true
+//  [bool] bBackgroundAllowUnknowns :  process background unknown chracters, if true
+//                                :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessBackgroundAA(string& strSequence, bool bBidirectional, bool bBackgroundAllowUnknowns)
+{
+	//  Process iteration maximum, according to bidirectional flag
+	int nMaxProcess = 1;
+	//  Translated residues
+	vector<int> vResidues;
+	//  Pass sequence
+	string strPassSequence = "";
+
+	try
+	{
+		//  If background array is set
+		if (m_ullaBackgroundAA != NULL)
+		{
+			//  If the input sequence is not empty
+			if (!strSequence.empty())
+			{
+				//  Reject sequences with gaps
+				if (strSequence.find_first_of('-') != string::npos)
+				{
+					ReportTimeStamp("[ProcessBackgroundAA]", "ERROR:  Background Sequence Contains a Gap of Indeterminate Length");
+
+					return false;
+				}
+
+				//  If bidirectional, iterate process twice
+				if (bBidirectional)
+					nMaxProcess = 2;
+
+				for (int nCountPass = 0; nCountPass < nMaxProcess; nCountPass++)
+				{
+					//  Get reverse complement on second pass
+					if (nCountPass > 0)
+						strPassSequence = ConvertToReverseCompliment(strSequence);
+					else
+						strPassSequence = strSequence;
+
+					for (int nFrame = 0; nFrame < 3; nFrame++)
+					{
+						//  Packed nMer
+						uint32_t untSubSequence = 0;
+						//  Packed nMer mask
+						uint32_t untNMerMask = (uint32_t)(((uint64_t)1 << (m_nNMerLengthAA * m_nResidueBitsAA)) - 1);
+						//  Consecutive markable residues
+						int nRunLength = 0;
+
+						if (!TranslateSequenceAA(strPassSequence, nFrame, bBackgroundAllowUnknowns, vResidues))
+							return false;
+
+						for (long lCountResidues = 0; lCountResidues < vResidues.size(); lCountResidues++)
+						{
+							//  Stop or unknown codon, restart nMer
+							if (vResidues[lCountResidues] < 0)
+							{
+								nRunLength = 0;
+								untSubSequence = 0;
+								continue;
+							}
+
+							untSubSequence = ((untSubSequence << m_nResidueBitsAA) | (uint32_t)vResidues[lCountResidues]) & untNMerMask;
+							nRunLength++;
+
+							if (nRunLength >= m_nNMerLengthAA)
+								MarkBackgroundSequenceAA(untSubSequence);
+						}
+					}
+				}
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[ProcessBackgroundAA]", "ERROR:  Background Sequence is Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ProcessBackgroundAA]", "ERROR:  Background Container is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessBackgroundAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Processes the background/foreground genome file list to identify amino acid nMer(s) present; foreground
+//      files may be .fa files or ORF files (see -list_parse_porf_to_orf [-lppto]), whose header is the accession
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputListFilePathName     :  input file path name list
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [CBase123_Catalog&] b123Catalog       :  Base123 genome catalog to use
+//  [bool] bBidirectional                 :  process bidirectional, if true
+//  [int] nNMerLength                     :  amino acid nMer length to analyze
+//  [bool] bBackground                    :  if true, process background; else, foreground
+//  [bool] bAllowUnknowns                 :  process unknown chracters, if true
+//  [string] strOutputFileNameSuffix      :  output file name suffix
+//  [string] strErrorFilePathName         :  error file base name
+//  [string] strJournalFilePathName       :  foreground resume journal file path name; if empty, no journal is kept
+//  [vector<string>&] vOutputTableEntries :  F-Distance table file text to concatenate
+//  [int] nMaxProcs                       :  maximum processors for openMP
+//                                       :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProcessFDistanceListAA(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns,
+	string strOutputFileNameSuffix, string strErrorFilePathName, string strJournalFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs)
+{
+	//  List lock
+	omp_lock_t lockList;
+	//  Input list file text
+	string strInputListFileText = "";
+	//  File path name vector<string>
+	vector<string> vFilePathNames;
+	//  Error file text
+	vector<string> vErrorEntries;
+	//  Error output file text
+	string strErrorFileText = "";
+	//  List chunk start index
+	long lChunkStart = 0;
+	//  List chunk end index (exclusive)
+	long lChunkEnd = 0;
+	//  Journaled (completed) foreground table entries, by input file path name
+	unordered_map<string, string> umJournalEntries;
+	//  Resumed entry count
+	long lResumeCount = 0;
+	//  Journal file path name this rank appends to
+	string strRankJournalFilePathName = "";
+
+	try
+	{
+		//  If input list file path name is not empty
+		if (!strInputListFilePathName.empty())
+		{
+			//  If nMer length matches the background
+			if ((nNMerLength > 0) && (nNMerLength == m_nNMerLengthAA))
+			{
+				//  If background array is set
+				if (m_ullaBackgroundAA != NULL)
+				{
+					//  Get list file text
+					if (GetFileText(strInputListFilePathName, strInputListFileText))
+					{
+						//  Split file path names
+						SplitString(strInputListFileText, '\n', vFilePathNames);
+
+						//  If vector contains file path names
+						if (vFilePathNames.size() > 0)
+						{
+							//  Initialize output table vector if not backgrounbd
+							if (!bBackground)
+								vOutputTableEntries.resize(vFilePathNames.size());
+
+							//  Initialize error file vector
+							vErrorEntries.resize(vFilePathNames.size());
+
+							//  Read the resume journal of a previous (interrupted) foreground pass
+							if ((!bBackground) && (!strJournalFilePathName.empty()))
+							{
+								if (ReadFDistanceJournal(strJournalFilePathName, umJournalEntries))
+									ReportTimeStamp("[ProcessFDistanceListAA]", "NOTE:  Resume Journal [" + strJournalFilePathName + "] Entries = " + ConvertLongToString((long)umJournalEntries.size()));
+								else
+									ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Resume Journal [" + strJournalFilePathName + "] Read Failed; All Entries Will be Processed");
+
+								//  Ranks append to their own journal (appends are only locked within a rank); create it, so rank journals stay contiguous
+								strRankJournalFilePathName = GetRankFilePathNameMPI(strJournalFilePathName);
+								if (GetRankCountMPI() > 1)
+								{
+									string strEmpty = "";
+
+									if (!AppendFileText(strRankJournalFilePathName, strEmpty))
+										ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Resume Journal [" + strRankJournalFilePathName + "] Creation Failed");
+								}
+							}
+
+							//  Initialize time stamp lock
+							omp_init_lock(&lockList);
+
+							//  Open the list in chunks; the whole list is one chunk, unless distributed across MPI ranks
+							OpenListChunksMPI((long)vFilePathNames.size(), !bBackground, (long)nMaxProcs * 4);
+
+							//  Process the chunks of this rank
+							while (GetNextListChunkMPI(lChunkStart, lChunkEnd))
+							{
+								//  Declare omp parallel
+								#pragma omp parallel shared(vOutputTableEntries) num_threads(nMaxProcs)
+								{
+									//  omp loop
+									#pragma omp for schedule(dynamic)
+									for (long lCount = lChunkStart; lCount < lChunkEnd; lCount++)
+									{
+										//  Update for timestamp every 10,000 files
+										if (lCount % 10000 == 0)
+										{
+											omp_set_lock(&lockList);
+											ReportTimeStamp("[ProcessFDistanceListAA]", "NOTE:  Processing Entry [" + ConvertLongToString(lCount) + "] [" + vFilePathNames[lCount] + "]");
+											omp_unset_lock(&lockList);
+										}
+
+										//  Resumed from journal, if true
+										bool bResumed = false;
+										//  Working file path name
+										string strWorkingFilePathName = "";
+
+										//  If input file path name transform is not empty
+										if (!strInputFilePathNameTransform.empty())
+											strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
+										else
+											strWorkingFilePathName = vFilePathNames[lCount];
+
+										//  If the input was completed by a previous pass and its output validates, reuse the journaled table entry
+										if ((!bBackground) && (!umJournalEntries.empty()) && (!vFilePathNames[lCount].empty()))
+										{
+											//  Journal entry iterator
+											unordered_map<string, string>::iterator itJournal = umJournalEntries.find(vFilePathNames[lCount]);
+
+											if (itJournal != umJournalEntries.end())
+											{
+												//  Output file path name
+												string strOutputFilePathName = GetFDistanceOutputFilePathName(strWorkingFilePathName, strOutputFileNameSuffix);
+												//  Header line
+												string strHeader = "";
+
+												//  Validate output (an ORF, header '>' + accession, is written as one line) and reuse table entry
+												if ((GetFileFirstLine(strWorkingFilePathName, strHeader)) &&
+													(ValidateFDistanceOutput(strOutputFilePathName, itJournal->second, ((bBidirectional) && (strHeader.find('|') != string::npos)) ? 2 : 1)))
+												{
+													vOutputTableEntries[lCount] = itJournal->second;
+													bResumed = true;
+
+													#pragma omp atomic
+													lResumeCount++;
+												}
+											}
+										}
+
+										//  If the file  name is not empty
+										if ((!vFilePathNames[lCount].empty()) && (!bResumed))
+										{
+											//  Sequence file text
+											string strSequenceFileText = "";
+
+											//  Get sequence file text
+											if (GetFileText(strWorkingFilePathName, strSequenceFileText))
+											{
+												//  Accession
+												string strAccession = "";
+												//  Header line
+												string strHeader = strSequenceFileText.substr(0, strSequenceFileText.find('\n'));
+												//  ORF file (header is '>' + accession), if true
+												bool bIsORF = (strHeader.find('|') == string::npos);
+
+												//  Get Accession
+												if (bIsORF)
+													strAccession = strHeader.substr(1);
+												else
+													strAccession = GetAccessionFromFileHeader(strSequenceFileText);
+
+												if (!strAccession.empty())
+												{
+													//  Catalog entry
+													CBase123_Catalog_Entry* pceGet = b123Catalog.GetEntryPointerByAccession(strAccession);
+
+													//  Get entry
+													if (pceGet != NULL)
+													{
+														//  Sequence
+														string strForward = "";
+
+														//  Get sequence
+														strForward = GetSequenceFromFAFile(strSequenceFileText);
+
+														//  Process forward sequence (circular genomes are not wrapped; a wrap would shift the reading frames)
+														if (!strForward.empty())
+														{
+															//  Process background sequence
+															if (bBackground)
+															{
+																if (!ProcessBackgroundAA(strForward, bBidirectional, bAllowUnknowns))
+																{
+																	vErrorEntries[lCount] = strWorkingFilePathName + "~Background Analysis Failed\n";
+
+																	omp_set_lock(&lockList);
+																	ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Background Sequence [" + strWorkingFilePathName + "] Process Failed");
+																	omp_unset_lock(&lockList);
+																}
+															}
+															//  Process foreground sequence
+															else
+															{
+																//  Output file path name
+																string strOutputFilePathName = GetFDistanceOutputFilePathName(strWorkingFilePathName, strOutputFileNameSuffix);
+
+																if (!ProcessForegroundAA(strOutputFilePathName, strAccession, strForward, bIsORF, bBidirectional, bAllowUnknowns, vOutputTableEntries[lCount]))
+																{
+																	vErrorEntries[lCount] = strWorkingFilePathName + "~Foreground Analysis Failed\n";
+
+																	omp_set_lock(&lockList);
+																	ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Foreground Sequence [" + strWorkingFilePathName + "] Process Failed");
+																	omp_unset_lock(&lockList);
+																}
+																//  Journal the completed input, so an interrupted pass can resume here
+																else if (!strRankJournalFilePathName.empty())
+																{
+																	//  Journal entry
+																	string strJournalEntry = vFilePathNames[lCount] + "|" + vOutputTableEntries[lCount] + "\n";
+
+																	omp_set_lock(&lockList);
+																	if (!AppendFileText(strRankJournalFilePathName, strJournalEntry))
+																		ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Resume Journal [" + strRankJournalFilePathName + "] Append Failed");
+																	omp_unset_lock(&lockList);
+																}
+															}
+														}
+														else
+														{
+															vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Sequence\n";
+
+															omp_set_lock(&lockList);
+															ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Sequence is Empty");
+															omp_unset_lock(&lockList);
+														}
+													}
+													else
+													{
+														vErrorEntries[lCount] = strWorkingFilePathName + "~Catalog Accession Search Failed\n";
+
+														omp_set_lock(&lockList);
+														ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Catalog Accession [" + strAccession + "] Search Failed");
+														omp_unset_lock(&lockList);
+													}
+												}
+												else
+												{
+													vErrorEntries[lCount] = strWorkingFilePathName + "~Empty Accession\n";
+
+													omp_set_lock(&lockList);
+													ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Accession is Empty");
+													omp_unset_lock(&lockList);
+												}
+											}
+											else
+											{
+												vErrorEntries[lCount] = strWorkingFilePathName + "~File Open Failed\n";
+
+												omp_set_lock(&lockList);
+												ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Input Sequence File [" + strWorkingFilePathName + "] Open Failed");
+												omp_unset_lock(&lockList);
+											}
+										}
+									}
+								}
+							}
+
+							//  Close the chunked list
+							CloseListChunksMPI();
+
+							//  Gather table and error entries on rank 0
+							if (!bBackground)
+								GatherListEntriesMPI(vOutputTableEntries);
+							GatherListEntriesMPI(vErrorEntries);
+
+							//  Destroy time stamp lock
+							omp_destroy_lock(&lockList);
+
+							//  Report resumed entries
+							if (lResumeCount > 0)
+								ReportTimeStamp("[ProcessFDistanceListAA]", "NOTE:  Resumed Entries (Validated Output) = " + ConvertLongToString(lResumeCount));
+
+							//  Write error file (rank 0)
+							if ((!strErrorFilePathName.empty()) && (IsRootMPI()))
+							{
+								//  Add header
+								strErrorFileText = "File Path Name~Error\n";
+
+								//  Iterate error entries and concatenate error file text
+								for (long lCount = 0; lCount < vErrorEntries.size(); lCount++)
+								{
+									if (!vErrorEntries[lCount].empty())
+										strErrorFileText += vErrorEntries[lCount];
+								}
+
+								//  Write error file
+								WriteFileText(strErrorFilePathName, strErrorFileText);
+							}
+
+							vFilePathNames.clear();
+							vErrorEntries.clear();
+
+							return true;
+						}
+						else
+						{
+							ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Text is Empty");
+						}
+					}
+					else
+					{
+						ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Input File Path Name List [" + strInputListFilePathName + "] Open Failed");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Background Container is Not Set");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  nMer Length [" + ConvertIntToString(nNMerLength) + "] Does Not Match the Background");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ProcessFDistanceListAA]", "ERROR:  Input File Path Name List is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ProcessFDistanceListAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Initializes the background collection; a dense bitset of 2^(nMer length x residue bits) bits
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int] nNMerLength  :  amino acid nMer length
+//  [int] nAlphabetType:  alphabet type (amino acid or reduced amino acid)
+//                    :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool InitializeBackgroundAA(int nNMerLength, int nAlphabetType)
+{
+	try
+	{
+		//  If alphabet is an amino acid alphabet
+		if ((nAlphabetType == m_nAlphabetAminoAcid) || (nAlphabetType == m_nAlphabetReducedAminoAcid))
+		{
+			//  If nMer length packs into the background
+			if ((nNMerLength > 0) && (nNMerLength <= GetMaxNMerLengthAA(nAlphabetType)))
+			{
+				//  Release any previous background
+				DestroyBackgroundAA();
+
+				m_nAlphabetTypeAA = nAlphabetType;
+				m_nNMerLengthAA = nNMerLength;
+				if (nAlphabetType == m_nAlphabetAminoAcid)
+				{
+					m_nAlphabetSizeAA = 20;
+					m_nResidueBitsAA = 5;
+				}
+				else
+				{
+					m_nAlphabetSizeAA = 10;
+					m_nResidueBitsAA = 4;
+				}
+
+				//  Background words, one bit per packed nMer (at least one word)
+				m_ullBackgroundWordsAA = (((uint64_t)1 << (nNMerLength * m_nResidueBitsAA)) + 63) / 64;
+				//  Position table words
+				m_ullPositionWordsAA = (((uint64_t)nNMerLength << m_nResidueBitsAA) + 63) / 64;
+				//  Pair table words
+				m_ullPairWordsAA = (((uint64_t)(nNMerLength * nNMerLength) << (2 * m_nResidueBitsAA)) + 63) / 64;
+
+				m_ullaBackgroundAA = new uint64_t[m_ullBackgroundWordsAA]();
+				m_ullaPositionAA = new uint64_t[m_ullPositionWordsAA]();
+				m_ullaPairAA = new uint64_t[m_ullPairWordsAA]();
+
+				ReportTimeStamp("[InitializeBackgroundAA]", "NOTE:  Background Alphabet = " + GetAlphabetNameAA(nAlphabetType) + ", nMer Length = " + ConvertIntToString(nNMerLength) + ", Size (MB) = " + ConvertLongToString((long)((m_ullBackgroundWordsAA * 8) / (1024 * 1024))));
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[InitializeBackgroundAA]", "ERROR:  Amino Acid nMer Length [" + ConvertIntToString(nNMerLength) + "] is Out of Range [1:" + ConvertIntToString(GetMaxNMerLengthAA(nAlphabetType)) + "]");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[InitializeBackgroundAA]", "ERROR:  Alphabet is Not an Amino Acid Alphabet");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [InitializeBackgroundAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Combines the background collections loaded by each MPI rank (collective)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReduceBackgroundAA()
+{
+	try
+	{
+		//  If background array is set
+		if (m_ullaBackgroundAA != NULL)
+		{
+			//  Combine the background and its position tables
+			if ((ReduceBitwiseOrMPI(m_ullaBackgroundAA, m_ullBackgroundWordsAA)) && (ReduceBitwiseOrMPI(m_ullaPositionAA, m_ullPositionWordsAA)) &&
+				(ReduceBitwiseOrMPI(m_ullaPairAA, m_ullPairWordsAA)))
+				return true;
+			else
+			{
+				ReportTimeStamp("[ReduceBackgroundAA]", "ERROR:  Background Reduction Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ReduceBackgroundAA]", "ERROR:  Background Collection is Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReduceBackgroundAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destroys the background collection
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool DestroyBackgroundAA()
+{
+	try
+	{
+		if (m_ullaBackgroundAA != NULL)
+		{
+			delete[] m_ullaBackgroundAA;
+			m_ullaBackgroundAA = NULL;
+		}
+
+		if (m_ullaPositionAA != NULL)
+		{
+			delete[] m_ullaPositionAA;
+			m_ullaPositionAA = NULL;
+		}
+
+		if (m_ullaPairAA != NULL)
+		{
+			delete[] m_ullaPairAA;
+			m_ullaPairAA = NULL;
+		}
+
+		m_nNMerLengthAA = 0;
+		m_ullBackgroundWordsAA = 0;
+		m_ullPositionWordsAA = 0;
+		m_ullPairWordsAA = 0;
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [DestroyBackgroundAA] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
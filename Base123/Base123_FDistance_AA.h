@@ -0,0 +1,51 @@
+// Base123_FDistance_AA.h : Performs Base123 translated (amino acid) Fofanov Distance analysis
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Performs Base123 translated Fofanov Distance Genomic Analysis (header); six-frame translates the
+//      foreground and background genomes and compares them at the amino acid polymer level; residues are
+//      packed 5 bits each (4 bits, reduced alphabet), so a 6-mer fits in 30 bits and the background is
+//      a dense bitset; see ReportPerformFDistanceAnalysisHelp() function for operational details;
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "Base123_Catalog_Entry.h"
+#include "Base123_Catalog.h"
+
+//  F-Distance alphabet, nucleotide (2-bit bases)
+const int m_nAlphabetNucleotide = 0;
+//  F-Distance alphabet, amino acid (20 residues, 5-bit)
+const int m_nAlphabetAminoAcid = 1;
+//  F-Distance alphabet, reduced amino acid (10 residue classes, 4-bit)
+const int m_nAlphabetReducedAminoAcid = 2;
+
+//  Maximum packed amino acid nMer width, bits
+const int m_nMaxAminoAcidNMerBits = 30;
+
+//  Translated residue, stop codon
+const int m_nResidueStop = -1;
+//  Translated residue, unknown codon
+const int m_nResidueUnknown = -2;
+
+int GetMaxNMerLengthAA(int nAlphabetType);
+string GetAlphabetNameAA(int nAlphabetType);
+bool TranslateSequenceAA(string& strSequence, int nFrame, bool bAllowUnknowns, vector<int>& vResidues);
+bool MarkBackgroundSequenceAA(uint32_t untSequence);
+bool IsPresentAA(uint32_t untSequence);
+bool MutateAA(uint32_t untSequence, int nMutationCount, int nFirstPosition);
+int MutateSequenceAA(uint32_t untSequence);
+bool ProcessForegroundAA(string& strOutputFilePathName, string& strAccession, string& strSequence, bool bIsORF, bool bBidirectional, bool bForegroundAllowUnknowns, string& strOutputTableEntry);
+bool ProcessBackgroundAA(string& strSequence, bool bBidirectional, bool bBackgroundAllowUnknowns);
+bool ProcessFDistanceListAA(string strInputListFilePathName, string strInputFilePathNameTransform, CBase123_Catalog& b123Catalog, bool bBidirectional, int nNMerLength, bool bBackground, bool bAllowUnknowns, string strOutputFileNameSuffix, string strErrorFilePathName, string strJournalFilePathName, vector<string>& vOutputTableEntries, int nMaxProcs);
+bool InitializeBackgroundAA(int nNMerLength, int nAlphabetType);
+bool ReduceBackgroundAA();
+bool DestroyBackgroundAA();
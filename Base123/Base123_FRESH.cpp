@@ -27,10 +27,10 @@
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
 #include "Base123_Shuffler.h"
+#include "Base123_Sequence_Archive.h"
 #include "Base123_FRESH.h"
 
 #include <algorithm>
-#include <ctime>
 #include <omp.h>
 
 //  Positional base similarities
@@ -233,16 +233,18 @@ bool ParseStartsAndStops(long lLength, vector<structCDS>& vCDSs, vector<structSt
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string] strInputFilePathName:  .fa file path name to process
-//  [CBase123_Catalog&] bCatalog :  catalog to process
-//  [int] nOutputCount           :  number of shuffled file(s) to produce
-//  [string&] strListEntry       :  list file entry
-//  [string&] strErrorEntry      :  error file entry
-//                              :  returns true, if successful; else, false
+//  [string] strInputFilePathName           :  .fa file path name to process
+//  [CBase123_Sequence_Archive&] b123Archive:  sequence archive (if open, the file is read from the archive)
+//  [CBase123_Catalog&] bCatalog            :  catalog to process
+//  [int] nOutputCount                      :  number of shuffled file(s) to produce
+//  [uint64_t] ullSeed                      :  shuffle seed (each replicate is seeded by seed, accession and replicate index)
+//  [string&] strListEntry                  :  list file entry
+//  [string&] strErrorEntry                 :  error file entry
+//                                          :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool shuffleFAFile(string strInputFilePathName, CBase123_Catalog& bCatalog, int nOutputCount, string& strListEntry, string& strErrorEntry)
+bool shuffleFAFile(string strInputFilePathName, CBase123_Sequence_Archive& b123Archive, CBase123_Catalog& bCatalog, int nOutputCount, uint64_t ullSeed, string& strListEntry, string& strErrorEntry)
 {
 	//  FA file text
 	string strInputFileText = "";
@@ -264,7 +266,7 @@ bool shuffleFAFile(string strInputFilePathName, CBase123_Catalog& bCatalog, int
 			if (nOutputCount > 0)
 			{
 				//  Get .fa sequence
-				if (GetFileText(strInputFilePathName, strInputFileText))
+				if (b123Archive.GetFAFileText(strInputFilePathName, strInputFileText))
 				{
 					//  Split file text into header and sequence
 					SplitString(strInputFileText, '\n', vInputFileText);
@@ -285,16 +287,16 @@ bool shuffleFAFile(string strInputFilePathName, CBase123_Catalog& bCatalog, int
 							if (!strSequence.empty())
 							{
 								//  CDS collection pointer
-								vector<structCDS> vCDSs;
+								vector<structCDS>* pvCDSs = bCatalog.GetCDSCollectionPointerByAccession(strAccession);
 
 								//  Get CDS collection by accession
-								if (bCatalog.GetCDSCollectionByAccession(strAccession, vCDSs))
+								if (pvCDSs != NULL)
 								{
 									//  Sorted starts and stops
 									vector<structStartStop> vStartsStops;
 
 									//  If sort starts and stops succeeds
-									if (ParseStartsAndStops((long)strSequence.length(), vCDSs, vStartsStops))
+									if (ParseStartsAndStops((long)strSequence.length(), *pvCDSs, vStartsStops))
 									{
 										//  File path name base
 										string strBaseFilePathName = "";
@@ -306,7 +308,7 @@ bool shuffleFAFile(string strInputFilePathName, CBase123_Catalog& bCatalog, int
 										for (int nCount = 0; nCount < nOutputCount; nCount++)
 										{
 											//  FA shuffle
-											CBase123_Shuffler bshuffle;
+											CBase123_Shuffler bshuffle(ullSeed, strAccession, nCount);
 											//  shuffled sequence
 											string strshuffle = "";
 
@@ -428,14 +430,17 @@ bool shuffleFAFile(string strInputFilePathName, CBase123_Catalog& bCatalog, int
 //  [string] strOutputListFilePathName    :  output list file path name
 //  [string] strErrorFilePathName         :  error file path name
 //  [int] nMaxProcs                       :  maximum processors for openMP
-//  [string] strOutputFolderPathName      :  output folder path name [optional]
+//  [string] strArchiveFilePathName       :  sequence archive file path name [optional; if set, files are read from the archive]
+//  [uint64_t] ullSeed                    :  shuffle seed (replicates are reproducible for any thread count)
 //                                       :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
 bool ListshuffleFAFiles(string strInputFilePathNameList, string strInputFilePathNameTransform, string strCatalogFilePathName, int nMaxCatalogSize, int nOutputCount, 
-	string strOutputListFilePathName, string strErrorFilePathName, int nMaxProcs)
+	string strOutputListFilePathName, string strErrorFilePathName, int nMaxProcs, string strArchiveFilePathName, uint64_t ullSeed)
 {
+	//  Sequence archive (files are read, unless opened)
+	CBase123_Sequence_Archive b123Archive;
 	//  List lock
 	omp_lock_t lockList;
 	//  Input file path name list file text
@@ -453,8 +458,13 @@ bool ListshuffleFAFiles(string strInputFilePathNameList, string strInputFilePath
 
 	try
 	{
-		//  Seed the randomizer
-		srand((uint16_t)time(NULL));
+		//  Open the sequence archive, if set
+		if ((!strArchiveFilePathName.empty()) && (!b123Archive.OpenArchive(strArchiveFilePathName)))
+		{
+			ReportTimeStamp("[ListshuffleFAFiles]", "ERROR:  Sequence Archive [" + strArchiveFilePathName + "] Open Failed");
+
+			return false;
+		}
 
 		//  If file path name list is not empty
 		if (!strInputFilePathNameList.empty())
@@ -466,10 +476,10 @@ bool ListshuffleFAFiles(string strInputFilePathNameList, string strInputFilePath
 				if(nMaxCatalogSize > 0)
 				{
 					//  Catalog to process
-					CBase123_Catalog bCatalog(nMaxCatalogSize);
+					CBase123_Catalog bCatalog(nMaxCatalogSize, true);
 
 					//  If catalog opens
-					if (bCatalog.OpenCatalog(strCatalogFilePathName))
+					if (bCatalog.OpenCatalog(strCatalogFilePathName, nMaxProcs))
 					{
 						//  Parse individual container file
 						if (GetFileText(strInputFilePathNameList, strInputListFileText))
@@ -524,7 +534,7 @@ bool ListshuffleFAFiles(string strInputFilePathNameList, string strInputFilePath
 											else
 												strWorkingFilePathName = vFilePathNames[lCount];
 
-											if (!shuffleFAFile(strWorkingFilePathName, bCatalog, nOutputCount, vListEntries[lCount], vErrorEntries[lCount]))
+											if (!shuffleFAFile(strWorkingFilePathName, b123Archive, bCatalog, nOutputCount, ullSeed, vListEntries[lCount], vErrorEntries[lCount]))
 											{
 												vErrorEntries[lCount] = strWorkingFilePathName + "~shuffle Failed\n";
 
@@ -27,7 +27,9 @@
 #include "Base123.h"
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
+#include "Base123_Sequence_Archive.h"
 
+#include <cstdint>
 #include <string>
 
 using namespace std;
@@ -35,5 +37,5 @@ using namespace std;
 bool CompareStartsAndStops(const structStartStop& st1, const structStartStop& st2);
 bool IsCDSStartStopStored(structStartStop& stSS, vector<structStartStop>& vSS);
 bool ParseStartsAndStops(long lLength, vector<structCDS>& vCDSs, vector<structStartStop>& vSS);
-bool shuffleFAFile(string strInputFilePathName, CBase123_Catalog& bCatalog, int nOutputCount, string& strListEntry, string& strErrorEntry);
-bool ListshuffleFAFiles(string strInputFilePathNameList, string strInputFilePathNameTransform, string strCatalogFilePathName, int nMaxCatalogEntries, int nOutputCount, string strOutputListFilePathName, string strErrorFilePathName, int nMaxProcs);
+bool shuffleFAFile(string strInputFilePathName, CBase123_Sequence_Archive& b123Archive, CBase123_Catalog& bCatalog, int nOutputCount, uint64_t ullSeed, string& strListEntry, string& strErrorEntry);
+bool ListshuffleFAFiles(string strInputFilePathNameList, string strInputFilePathNameTransform, string strCatalogFilePathName, int nMaxCatalogEntries, int nOutputCount, string strOutputListFilePathName, string strErrorFilePathName, int nMaxProcs, string strArchiveFilePathName, uint64_t ullSeed);
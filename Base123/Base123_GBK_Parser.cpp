@@ -0,0 +1,297 @@
+// Base123_GBK_Parser.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_GBK_Parser class scans GenBank (.gbk) text in place (line views over the raw buffer,
+//      case-insensitive prefix matching, ORIGIN block skipping)
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Utilities.h"
+#include "Base123_GBK_Parser.h"
+
+#include <cctype>
+#include <cstring>
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_GBK_Parser class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const char*] chpText:  text to scan (not copied; must outlive the parser)
+//  [size_t] stLength    :  text length, bytes
+//  [bool] bReadOrigin   :  return the ORIGIN (sequence) block lines, if true; else, skip them
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_GBK_Parser::CBase123_GBK_Parser(const char* chpText, size_t stLength, bool bReadOrigin)
+{
+	m_chpText = chpText;
+	m_stLength = (chpText != NULL) ? stLength : 0;
+	m_bReadOrigin = bReadOrigin;
+	m_stPosition = 0;
+	m_nState = m_nGBKScanRecord;
+	m_lLineNumber = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_GBK_Parser class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_GBK_Parser::~CBase123_GBK_Parser()
+{
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the next non-empty line and advances the scan
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structGBKView&] stLine:  the line (view into the scanned text)
+//                         :  returns true, if a line was read; else (end of text), false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_GBK_Parser::GetNextLine(structGBKView& stLine)
+{
+	return ScanLine(m_stPosition, m_nState, m_lLineNumber, stLine);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the next non-empty line without advancing the scan
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structGBKView&] stLine:  the line (view into the scanned text; empty at end of text)
+//                         :  returns true, if a line was read; else (end of text), false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_GBK_Parser::PeekNextLine(structGBKView& stLine)
+{
+	//  Scan position (copy)
+	size_t stPosition = m_stPosition;
+	//  Scan state (copy)
+	int nState = m_nState;
+	//  Lines scanned (copy)
+	long lLineNumber = m_lLineNumber;
+
+	return ScanLine(stPosition, nState, lLineNumber, stLine);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the scan position
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the start of the next line to scan (one past the text, at end of text)
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+const char* CBase123_GBK_Parser::GetPosition()
+{
+	return m_chpText + m_stPosition;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the number of lines scanned
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the line number of the last line read (empty and skipped lines are counted)
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_GBK_Parser::GetLineNumber()
+{
+	return m_lLineNumber;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets whether a line starts with a prefix, ignoring the case of the line
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const structGBKView&] stLine:  line to test
+//  [const char*] chpPrefix       :  prefix (lower-case)
+//  [size_t] stPrefixLength       :  prefix length, bytes
+//                                :  returns true, if the line starts with the prefix; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_GBK_Parser::GetHasPrefix(const structGBKView& stLine, const char* chpPrefix, size_t stPrefixLength)
+{
+	//  If the line is long enough
+	if (stLine.stLength >= stPrefixLength)
+	{
+		//  Compare the lower-case line, character by character
+		for (size_t stCount = 0; stCount < stPrefixLength; stCount++)
+		{
+			if ((char)tolower((unsigned char)stLine.chpText[stCount]) != chpPrefix[stCount])
+				return false;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets whether a line starts with a prefix, ignoring the case of the line
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const structGBKView&] stLine:  line to test
+//  [const string&] strPrefix     :  prefix (lower-case)
+//                                :  returns true, if the line starts with the prefix; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_GBK_Parser::GetHasPrefix(const structGBKView& stLine, const string& strPrefix)
+{
+	return GetHasPrefix(stLine, strPrefix.c_str(), strPrefix.length());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets (copies) part of a line
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const structGBKView&] stLine:  line
+//  [size_t] stStart              :  start position
+//  [size_t] stCount              :  character count (clipped to the line; string::npos for the rest)
+//                                :  returns the text
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string CBase123_GBK_Parser::GetText(const structGBKView& stLine, size_t stStart, size_t stCount)
+{
+	//  If the start is within the line
+	if (stStart < stLine.stLength)
+	{
+		if (stCount > stLine.stLength - stStart)
+			stCount = stLine.stLength - stStart;
+
+		return string(stLine.chpText + stStart, stCount);
+	}
+
+	return "";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets (copies) part of a line, in lower-case
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const structGBKView&] stLine:  line
+//  [size_t] stStart              :  start position
+//  [size_t] stCount              :  character count (clipped to the line; string::npos for the rest)
+//                                :  returns the lower-case text
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string CBase123_GBK_Parser::GetLowerCaseText(const structGBKView& stLine, size_t stStart, size_t stCount)
+{
+	//  The lower-case text to return
+	string strReturn = GetText(stLine, stStart, stCount);
+
+	for (size_t stChar = 0; stChar < strReturn.length(); stChar++)
+		strReturn[stChar] = (char)tolower((unsigned char)strReturn[stChar]);
+
+	return strReturn;
+}
+
+//  Implementation (private)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Scans the next non-empty line; on ORIGIN (unless the sequence block is read), the block lines
+//      are passed over to the record terminator without being returned
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [size_t&] stPosition   :  scan position
+//  [int&] nState          :  scan state
+//  [long&] lLineNumber    :  lines scanned
+//  [structGBKView&] stLine:  the line (view into the scanned text; empty at end of text)
+//                         :  returns true, if a line was read; else (end of text), false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_GBK_Parser::ScanLine(size_t& stPosition, int& nState, long& lLineNumber, structGBKView& stLine)
+{
+	//  Line end
+	const char* chpEnd = NULL;
+
+	stLine.chpText = m_chpText + stPosition;
+	stLine.stLength = 0;
+
+	while ((nState != m_nGBKScanEnd) && (stPosition < m_stLength))
+	{
+		//  Sequence block, skipped; pass over lines to the record terminator
+		if ((nState == m_nGBKScanOrigin) && (!m_bReadOrigin) && ((stPosition + 1 >= m_stLength) || (m_chpText[stPosition] != '/') || (m_chpText[stPosition + 1] != '/')))
+		{
+			chpEnd = (const char*)memchr(m_chpText + stPosition, '\n', m_stLength - stPosition);
+			stPosition = (chpEnd != NULL) ? (size_t)(chpEnd - m_chpText) + 1 : m_stLength;
+			lLineNumber++;
+
+			continue;
+		}
+
+		//  Next line
+		chpEnd = (const char*)memchr(m_chpText + stPosition, '\n', m_stLength - stPosition);
+
+		stLine.chpText = m_chpText + stPosition;
+		stLine.stLength = (chpEnd != NULL) ? (size_t)(chpEnd - stLine.chpText) : m_stLength - stPosition;
+		stPosition += stLine.stLength + ((chpEnd != NULL) ? 1 : 0);
+		lLineNumber++;
+
+		//  Carriage-returns (\r\n line ends) are not part of the line
+		while ((stLine.stLength > 0) && (stLine.chpText[stLine.stLength - 1] == '\r'))
+			stLine.stLength--;
+
+		//  Empty lines are not returned
+		if (stLine.stLength > 0)
+		{
+			//  Update state
+			if (GetHasPrefix(stLine, m_chaGBKKeywordOrigin, sizeof(m_chaGBKKeywordOrigin) - 1))
+				nState = m_nGBKScanOrigin;
+			else if (GetHasPrefix(stLine, m_chaGBKKeywordEnd, sizeof(m_chaGBKKeywordEnd) - 1))
+				nState = m_nGBKScanRecord;
+
+			return true;
+		}
+	}
+
+	//  End of text
+	nState = m_nGBKScanEnd;
+	stLine.chpText = m_chpText + stPosition;
+	stLine.stLength = 0;
+
+	return false;
+}
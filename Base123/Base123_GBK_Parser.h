@@ -0,0 +1,87 @@
+// Base123_GBK_Parser.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_GBK_Parser class (header) scans GenBank (.gbk) text in place, line by line, without
+//      splitting, copying or lower-casing it; lines are returned as views (pointer, length) into the
+//      scanned buffer, keywords and qualifiers are matched case-insensitively against the view, and
+//      the ORIGIN (sequence) block is skipped to the record terminator ("//") unless it is requested
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstddef>
+#include <string>
+
+//  GBK scan state:  record lines (header, features)
+const int m_nGBKScanRecord = 0;
+//  GBK scan state:  ORIGIN (sequence) block
+const int m_nGBKScanOrigin = 1;
+//  GBK scan state:  end of text
+const int m_nGBKScanEnd = 2;
+
+//  GBK record keyword:  ORIGIN (sequence block start)
+const char m_chaGBKKeywordOrigin[] = "origin";
+//  GBK record keyword:  record terminator
+const char m_chaGBKKeywordEnd[] = "//";
+
+//  GBK text view (not owned; valid while the scanned buffer is)
+struct structGBKView
+{
+	//  Text
+	const char* chpText;
+	//  Length, bytes (no line terminator, \n or \r\n)
+	size_t stLength;
+};
+
+class CBase123_GBK_Parser
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_GBK_Parser(const char* chpText, size_t stLength, bool bReadOrigin);
+	//  Destructor
+	virtual ~CBase123_GBK_Parser();
+
+	//  Interface (public)
+
+public:
+
+	bool GetNextLine(structGBKView& stLine);
+	bool PeekNextLine(structGBKView& stLine);
+	const char* GetPosition();
+	long GetLineNumber();
+
+	static bool GetHasPrefix(const structGBKView& stLine, const char* chpPrefix, size_t stPrefixLength);
+	static bool GetHasPrefix(const structGBKView& stLine, const string& strPrefix);
+	static string GetText(const structGBKView& stLine, size_t stStart, size_t stCount);
+	static string GetLowerCaseText(const structGBKView& stLine, size_t stStart, size_t stCount);
+
+	//  Implementation (private)
+
+private:
+
+	bool ScanLine(size_t& stPosition, int& nState, long& lLineNumber, structGBKView& stLine);
+
+	//  Scanned text (not owned)
+	const char* m_chpText;
+	//  Scanned text length, bytes
+	size_t m_stLength;
+	//  Read the ORIGIN (sequence) block, if true
+	bool m_bReadOrigin;
+	//  Scan position (start of the next line)
+	size_t m_stPosition;
+	//  Scan state
+	int m_nState;
+	//  Lines scanned (including empty and skipped lines)
+	long m_lLineNumber;
+};
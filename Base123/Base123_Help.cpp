@@ -123,6 +123,9 @@ void ReportNCBIManagementHelp()
 		cout << "//       Parse BIG Format .pORF File List to BIG .ORF Format Files:\n";
 		cout << "//            Base123 -help_parse_porf_to_orf [-hppto];\n";
 		cout << "//\n";
+		cout << "//       Pack BIG Format .fa File List into a Sequence Archive:\n";
+		cout << "//            Base123 -help_create_sequence_archive [-hcsa];\n";
+		cout << "//\n";
 		cout << "//       NOTE:  Base123 supports file path naming via use of string-based\n";
 		cout << "//            transforms (e.g., to use local file name only, leave the\n";
 		cout << "//            transform string empty, to use full file path name, provide\n";
@@ -176,6 +179,15 @@ void ReportCatalogManagementHelp()
 		cout << "//       Create a BIG Format Genome Catalog from NCBI .gbk Files:\n";
 		cout << "//            Base123 -help_create_gbk_catalog [-hcgc];\n";
 		cout << "//\n";
+		cout << "//       Refresh a BIG Format Genome Catalog from a New NCBI .gbk Release:\n";
+		cout << "//            Base123 -help_refresh_gbk_catalog [-hrgc];\n";
+		cout << "//\n";
+		cout << "//       Compile a BIG Format Genome Catalog to Binary (Memory-Mapped) Format:\n";
+		cout << "//            Base123 -help_compile_catalog [-hccat];\n";
+		cout << "//\n";
+		cout << "//       Query a BIG Format Genome Catalog to a List File:\n";
+		cout << "//            Base123 -help_query_catalog [-hqcat];\n";
+		cout << "//\n";
 		cout << "//       NOTE:  Base123 supports file path naming via use of string-based\n";
 		cout << "//            transforms (e.g., to use local file name only, leave the\n";
 		cout << "//            transform string empty, to use full file path name, provide\n";
@@ -290,6 +302,18 @@ void ReportFDistanceManagementHelp()
 		cout << "//            with Foreground Catalog Metadata):\n";
 		cout << "//            Base123 -help_list_contabulate_fdistance_output [-hlcfo];\n";
 		cout << "//\n";
+		cout << "//       Contabulate an F-Distance Results Store (Genome Significance\n";
+		cout << "//            Against its Shuffles, Combined with Foreground Catalog Metadata):\n";
+		cout << "//            Base123 -help_contabulate_results_store [-hcrs];\n";
+		cout << "//\n";
+		cout << "//       Build a Sketch Index of a BIG FA Format File List (Nearest-Background\n";
+		cout << "//            Selection):\n";
+		cout << "//            Base123 -help_list_build_sketch_index [-hlbsi];\n";
+		cout << "//\n";
+		cout << "//       Query a Sketch Index for the Nearest Backgrounds of a BIG FA Format\n";
+		cout << "//            File List:\n";
+		cout << "//            Base123 -help_list_query_sketch_index [-hlqsi];\n";
+		cout << "//\n";
 		cout << "//       Clear BIG F-Distance Output:\n";
 		cout << "//            Base123 -help_list_clear_fdistance_output [-hlclfo];\n";
 		cout << "//\n";
@@ -599,7 +623,11 @@ void ReportListParseFAtoPORFHelp()
 		cout << "//       <max_orf_length>...\n";
 		cout << "//       <output_list_file_path_name>...\n";
 		cout << "//       <error_file_path_name>...\n";
-		cout << "//       <max_processors>;\n";
+		cout << "//       <max_processors>...\n";
+		cout << "//       [-archive [-ar] <archive_file_path_name>] (optional);\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -archive reads the listed .fa files from a sequence archive (see\n";
+		cout << "//       -help_create_sequence_archive [-hcsa]), by accession;\n";
 		cout << "//\n";
 		cout << "//  NOTE:  input file path name transform can contain the following string\n";
 		cout << "//       replacement(s):\n";
@@ -681,6 +709,61 @@ void ReportListParsePORFtoORFHelp()
 	}
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes create sequence archive help text to console;
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void ReportCreateSequenceArchiveHelp()
+{
+	try
+	{
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Packs a List of BIG .fa Format Files into a Single Sequence Archive;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5>;\n";
+		cout << "//\n";
+		cout << "//  -create_sequence_archive [-csa]...\n";
+		cout << "//       <input_file_path_name_list>...\n";
+		cout << "//       <input_file_path_name_transform>...\n";
+		cout << "//       <output_archive_file_path_name>...\n";
+		cout << "//       <error_file_path_name>...\n";
+		cout << "//       <max_processors>;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  bases (a, c, g, u) are packed four per byte; any other character\n";
+		cout << "//       (n, IUPAC codes, t, upper-case) is held as an exception run; entries\n";
+		cout << "//       are indexed by accession (the .fa file name, no path, no extension)\n";
+		cout << "//       and read back as the exact .fa file text;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  files that are not a header line and a single sequence line, and\n";
+		cout << "//       duplicate accessions, are not archived and are written to the error\n";
+		cout << "//       file;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -list_filter_for_fdistance [-lfff], -list_parse_fa_to_porf [-lpftp],\n";
+		cout << "//       -list_shuffle_fa_files [-lsff] and -perform_fdistance_analysis [-pfda]\n";
+		cout << "//       accept [-archive [-ar] <archive_file_path_name>]; listed .fa files are\n";
+		cout << "//       then read from the (memory-mapped) archive, by accession, and output\n";
+		cout << "//       files are written beside the listed path names;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  input file path name transform replacements are as for\n";
+		cout << "//       -list_parse_fa_to_porf [-lpftp];\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReportCreateSequenceArchiveHelp] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Writes parse GBK container file help text to console;
@@ -827,6 +910,10 @@ void ReportGBKCatalogHelp()
 		cout << "//       <max_processors>...\n";
 		cout << "//       <max_catalog_size>;\n";
 		cout << "//\n";
+		cout << "//  NOTE:  a content manifest (<output_catalog_file_path_name>.manifest) is\n";
+		cout << "//       written beside the catalog; keep it with the catalog for\n";
+		cout << "//       -refresh_gbk_catalog [-rgc];\n";
+		cout << "//\n";
 		cout << "//  NOTE:  input file path name transform can contain the following string\n";
 		cout << "//       replacement(s):\n";
 		cout << "//       ^BIG_ACCESSION^ <BIG format accession number>...\n";
@@ -846,6 +933,174 @@ void ReportGBKCatalogHelp()
 	}
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes .gbk catalog refresh help text to console;
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void ReportRefreshGBKCatalogHelp()
+{
+	try
+	{
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Refreshes a BIG format genome data catalog from a new NCBI .gbk release;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6> <arg7>\n";
+		cout << "//       <arg8> <arg9> <arg10> <arg11>;\n";
+		cout << "//\n";
+		cout << "//  -refresh_gbk_catalog [-rgc]...\n";
+		cout << "//       <previous_catalog_file_path_name>...\n";
+		cout << "//       <input_file_path_name_list>...\n";
+		cout << "//       <input_file_path_name_transform>...\n";
+		cout << "//       <output_catalog_file_path_name>...\n";
+		cout << "//       <added_list_file_path_name>...\n";
+		cout << "//       <changed_list_file_path_name>...\n";
+		cout << "//       <removed_list_file_path_name>...\n";
+		cout << "//       <output_file_path_name_transform>...\n";
+		cout << "//       <error_file_path_name>...\n";
+		cout << "//       <max_processors>...\n";
+		cout << "//       <max_catalog_size>;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  each .gbk file is keyed by accession and compared, by version and\n";
+		cout << "//       content hash, against the previous catalog manifest (written by\n";
+		cout << "//       -create_gbk_catalog [-cgc] and by this command); unchanged entries\n";
+		cout << "//       are copied from the previous catalog, added and changed files are\n";
+		cout << "//       cataloged, and accessions missing from the list are removed; without\n";
+		cout << "//       a manifest, only versioned accessions are compared;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  the output catalog may be the previous catalog (refresh in place);\n";
+		cout << "//       the output catalog is written in list order, as -cgc would write it;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  the added, changed and removed lists hold versioned accessions, or,\n";
+		cout << "//       if a transform is given, transformed file path names (^BIG_ACCESSION^\n";
+		cout << "//       is the accession, ^DEFAULT_EXTENSION^ is fa); only the added and\n";
+		cout << "//       changed accessions need -list_parse_fna_to_fa [-lpftf] and the\n";
+		cout << "//       downstream steps; input file path name transform replacements are\n";
+		cout << "//       as for -cgc;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReportRefreshGBKCatalogHelp] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes catalog compilation help text to console;
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void ReportCompileCatalogHelp()
+{
+	try
+	{
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Compiles a BIG format genome data catalog to binary format;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Usage is Base123 <switch> <arg1> <arg2> <arg3>;\n";
+		cout << "//\n";
+		cout << "//  -compile_catalog [-ccat]...\n";
+		cout << "//       <input_catalog_file_path_name>...\n";
+		cout << "//       <output_catalog_file_path_name>...\n";
+		cout << "//       <max_catalog_size>;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  a compiled catalog is memory mapped and read in place, without\n";
+		cout << "//       parsing; repeated strings (host, molecule type, locale, etc.) are\n";
+		cout << "//       stored once; every command that takes a catalog file path name\n";
+		cout << "//       accepts either format (detected by content, not extension);\n";
+		cout << "//\n";
+		cout << "//  NOTE:  recompile after changing the text catalog; the compiled catalog\n";
+		cout << "//       holds the set entries only, in catalog order;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  the query indexes of the compiled catalog are written beside it\n";
+		cout << "//       (<output_catalog_file_path_name>.qidx) and read by -query_catalog;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReportCompileCatalogHelp] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes catalog query help text to console;
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void ReportQueryCatalogHelp()
+{
+	try
+	{
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Queries a BIG format genome data catalog and writes the matching entries\n";
+		cout << "//       to a list file;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6>;\n";
+		cout << "//\n";
+		cout << "//  -query_catalog [-qcat]...\n";
+		cout << "//       <input_catalog_file_path_name>...\n";
+		cout << "//       <query>...\n";
+		cout << "//       <output_list_file_path_name>...\n";
+		cout << "//       <output_file_path_name_transform>...\n";
+		cout << "//       <max_processors>...\n";
+		cout << "//       <max_catalog_size>;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  a query is one or more terms combined with & (and) and | (or);\n";
+		cout << "//       & binds tighter than | (quote the query on the command line):\n";
+		cout << "//\n";
+		cout << "//       <field>=<value>       molecule_type, strandedness, completeness,\n";
+		cout << "//                             host, viral_group (case-insensitive; a\n";
+		cout << "//                             trailing * matches a value prefix)\n";
+		cout << "//       length=<min>:<max>    inclusive; either bound may be omitted\n";
+		cout << "//       date=<min>:<max>      inclusive; yyyy[-mm[-dd]] or dd-mon-yyyy;\n";
+		cout << "//                             entries without a date do not match\n";
+		cout << "//\n";
+		cout << "//       e.g., \"host=homo sapiens&viral_group=iv&date=2010:|length=:2000\"\n";
+		cout << "//\n";
+		cout << "//  NOTE:  each match is written as its accession, or, if a transform is\n";
+		cout << "//       given, as the transformed file path name (^BIG_ACCESSION^ is the\n";
+		cout << "//       accession, ^DEFAULT_EXTENSION^ is fa); list order is catalog order;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  a compiled catalog is queried through its query index file\n";
+		cout << "//       (<input_catalog_file_path_name>.qidx, written by -compile_catalog),\n";
+		cout << "//       without opening the catalog; a text catalog, or a compiled catalog\n";
+		cout << "//       whose index file is missing or stale, is opened and indexed on each\n";
+		cout << "//       query (the index file of a compiled catalog is then rewritten);\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReportQueryCatalogHelp] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  shuffles a .fa BIG file format into individual shuffle file(s)
@@ -887,7 +1142,17 @@ void ReportFRESHHelp()
 		cout << "//       <output_count>...\n";
 		cout << "//       <output_list_file_path_name>...\n";
 		cout << "//       <error_file_path_name>...\n";
-		cout << "//       <max_processors>;\n";
+		cout << "//       <max_processors>...\n";
+		cout << "//       [-archive [-ar] <archive_file_path_name>] (optional)...\n";
+		cout << "//       [-shuffle_seed [-ssd] <seed>] (optional);\n";
+		cout << "//\n";
+		cout << "//  NOTE:  each replicate draws from its own random stream, keyed by the\n";
+		cout << "//       shuffle seed (default 0), accession and replicate index; output is\n";
+		cout << "//       the same for any thread count, and the same as -pfda -shuffle_count\n";
+		cout << "//       replicates for the same seed;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -archive reads the listed .fa files from a sequence archive (see\n";
+		cout << "//       -help_create_sequence_archive [-hcsa]), by accession;\n";
 		cout << "//\n";
 		cout << "//  NOTE:  input file path name transform can contain the following string\n";
 		cout << "//       replacement(s):\n";
@@ -948,7 +1213,11 @@ void ReportFilterFDistanceListHelp()
 		cout << "//       <max_poly_unknowns>...\n";
 		cout << "//       <accept_output_list_file_path_name>...\n";
 		cout << "//       <reject_output_list_file_path_name>...\n";
-		cout << "//       <max_processors>;\n";
+		cout << "//       <max_processors>...\n";
+		cout << "//       [-archive [-ar] <archive_file_path_name>] (optional);\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -archive reads the listed .fa files from a sequence archive (see\n";
+		cout << "//       -help_create_sequence_archive [-hcsa]), by accession;\n";
 		cout << "//\n";
 		cout << "//  NOTE:  input file path name transform can contain the following string\n";
 		cout << "//       replacement(s):\n";
@@ -1054,6 +1323,178 @@ void ReportListContabulateFDistanceOutputHelp()
 	}
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes F-Distance results store contabulation help text to console;
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void ReportContabulateResultsStoreHelp()
+{
+	try
+	{
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Contabulates an F-Distance results store, scoring each genome against\n";
+		cout << "//       its shuffles and combining them with the foreground genome's catalog;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6>;\n";
+		cout << "//\n";
+		cout << "//  -contabulate_results_store [-crs]...\n";
+		cout << "//       <results_store_file_path_name>...\n";
+		cout << "//       <output_table_file_path_name>...\n";
+		cout << "//       <catalog_file_path_name>...\n";
+		cout << "//       <max_catalog_size>...\n";
+		cout << "//       <error_file_path_name>...\n";
+		cout << "//       <max_processors>;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  the results store is written by -perform_fdistance_analysis\n";
+		cout << "//       -results_store [-rs]; a foreground input named <base>.sh_N.fa is\n";
+		cout << "//       shuffle replicate N of its genome; a later run's record replaces an\n";
+		cout << "//       earlier record of the same accession and replicate;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  each genome row reports the shuffle count, the genome's mutation\n";
+		cout << "//       total and score, the shuffle mean and sample standard deviation,\n";
+		cout << "//       the z-score, and the empirical p-value (1 + shuffles scoring <=\n";
+		cout << "//       genome) / (1 + shuffles), forward and reverse;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  catalog file path name is the foreground catalog of the original\n";
+		cout << "//       F-Distance analysis;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReportContabulateResultsStoreHelp] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes sketch index build help text to console;
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void ReportListBuildSketchIndexHelp()
+{
+	try
+	{
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Builds a MinHash sketch index of a BIG FA format file list, in parallel;\n";
+		cout << "//       each genome is reduced to the smallest hashes of its canonical\n";
+		cout << "//       k-mers, from which genome similarity is estimated;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6> <arg7>;\n";
+		cout << "//\n";
+		cout << "//  -list_build_sketch_index [-lbsi]...\n";
+		cout << "//       <input_file_path_name_list>...\n";
+		cout << "//       <input_file_path_name_transform>...\n";
+		cout << "//       <kmer_length>...\n";
+		cout << "//       <sketch_size>...\n";
+		cout << "//       <index_file_path_name>...\n";
+		cout << "//       <error_file_path_name>...\n";
+		cout << "//       <max_processors>;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  kmer length is [1:32] (e.g., 21); sketch size is the number of\n";
+		cout << "//       hashes kept per genome (e.g., 1000); larger sketches estimate\n";
+		cout << "//       similarity more precisely, at proportional cost;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  each index entry stores the file path name as listed, so the\n";
+		cout << "//       background lists written by -list_query_sketch_index [-lqsi] are\n";
+		cout << "//       valid input for -perform_fdistance_analysis [-pfda];\n";
+		cout << "//\n";
+		cout << "//  NOTE:  input file path name transform can contain the following string\n";
+		cout << "//       replacement(s):\n";
+		cout << "//       ^BIG_ACCESSION^ <BIG format accession number>...\n";
+		cout << "//       ^BASE_FILE_PATH_NAME^ <base file path name> (no extension)...\n";
+		cout << "//       ^BASE_PATH^ <base path name> (no file name,  no extension)...\n";
+		cout << "//       ^BASE_FILE_NAME^ <base file name> (no path, no extension)...\n";
+		cout << "//       ^FNELE^\n";
+		cout << "//            <full file name except last extension> (no path, minus last\n";
+		cout << "//            extension only)...\n";
+		cout << "//       ^FILE_NAME^ <full file name> (no path, with full extension);\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReportListBuildSketchIndexHelp] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes sketch index query help text to console;
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+void ReportListQuerySketchIndexHelp()
+{
+	try
+	{
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Queries a sketch index with each genome of a BIG FA format file list, in\n";
+		cout << "//       parallel, ranking the index genomes by estimated Jaccard similarity\n";
+		cout << "//       and writing the nearest as background lists;\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+		cout << "//\n";
+		cout << "//  Usage is Base123 <switch> <arg1> <arg2> <arg3> <arg4> <arg5> <arg6> <arg7> <arg8>;\n";
+		cout << "//\n";
+		cout << "//  -list_query_sketch_index [-lqsi]...\n";
+		cout << "//       <index_file_path_name>...\n";
+		cout << "//       <input_file_path_name_list>...\n";
+		cout << "//       <input_file_path_name_transform>...\n";
+		cout << "//       <nearest_count>...\n";
+		cout << "//       <output_table_file_path_name>...\n";
+		cout << "//       <background_list_file_path_base_name>...\n";
+		cout << "//       <error_file_path_name>...\n";
+		cout << "//       <max_processors>;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  foregrounds are sketched with the index kmer length and sketch\n";
+		cout << "//       size; an index genome with the foreground's accession is excluded;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  background lists are written to <base>_<accession>.txt (nearest\n";
+		cout << "//       first) and <base>_union.txt (all listed backgrounds, once each);\n";
+		cout << "//       leave the base name empty (\"\") to write the table only;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  input file path name transform can contain the following string\n";
+		cout << "//       replacement(s):\n";
+		cout << "//       ^BIG_ACCESSION^ <BIG format accession number>...\n";
+		cout << "//       ^BASE_FILE_PATH_NAME^ <base file path name> (no extension)...\n";
+		cout << "//       ^BASE_PATH^ <base path name> (no file name,  no extension)...\n";
+		cout << "//       ^BASE_FILE_NAME^ <base file name> (no path, no extension)...\n";
+		cout << "//       ^FNELE^\n";
+		cout << "//            <full file name except last extension> (no path, minus last\n";
+		cout << "//            extension only)...\n";
+		cout << "//       ^FILE_NAME^ <full file name> (no path, with full extension);\n";
+		cout << "//\n";
+		cout << "////////////////////////////////////////////////////////////////////////////////\n";
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReportListQuerySketchIndexHelp] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Writes F-Distance output file(s) clearance help text to console;
@@ -1183,8 +1624,76 @@ void ReportPerformFDistanceAnalysisHelp()
 		cout << "//                 -foreground_disallow_unknowns [-fdu]...\n";
 		cout << "//       <foreground_error_file_path_name>...\n";
 		cout << "//       <output_file_name_suffix>...\n";
-		cout << "//       <nmer_length> (8, 16)...\n";
-		cout << "//       <max_processors>;\n";
+		cout << "//       <nmer_length> (8, 16; amino acid, 1 - 6; reduced amino acid, 1 - 7)...\n";
+		cout << "//       <max_processors>...\n";
+		cout << "//       [-resume_journal [-rj] <journal_file_path_name>] (optional)...\n";
+		cout << "//       [-memory_budget [-mb] <background_memory_budget_mb>] (optional)...\n";
+		cout << "//       [-alphabet [-ab] <nucleotide [nt] | amino_acid [aa] |\n";
+		cout << "//            reduced_amino_acid [raa]>] (optional)...\n";
+		cout << "//       [-cds_table [-cdst] <cds_table_file_path_name>] (optional)...\n";
+		cout << "//       [-background_export [-be] <export_file_path_base_name>] (optional)...\n";
+		cout << "//       [-background_export_format [-bef] <text | 2bit | delta>] (optional)...\n";
+		cout << "//       [-background_export_set [-bes] <present | absent | both>] (optional)...\n";
+		cout << "//       [-results_store [-rs] <results_store_file_path_name>] (optional)...\n";
+		cout << "//       [-shuffle_count [-sc] <shuffles_per_genome>] (optional)...\n";
+		cout << "//       [-shuffle_table [-st] <shuffle_table_file_path_name>] (optional)...\n";
+		cout << "//       [-store_shuffles [-ss] <y | n>] (optional)...\n";
+		cout << "//       [-archive [-ar] <archive_file_path_name>] (optional)...\n";
+		cout << "//       [-shuffle_seed [-ssd] <seed>] (optional);\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -alphabet amino_acid six-frame translates background and foreground\n";
+		cout << "//       (three frames, if unidirectional) and scores amino acid nMers by\n";
+		cout << "//       minimum residue substitutions; residues pack 5 bits each (a 6-mer in\n";
+		cout << "//       30 bits, 128 MB background); reduced_amino_acid groups residues into\n";
+		cout << "//       ten classes of 4 bits (a 6-mer background is 2 MB); foreground ORF\n";
+		cout << "//       files (-list_parse_porf_to_orf) are read in frame one, only;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -memory_budget bounds the 16-mer background representation; 16-mers\n";
+		cout << "//       are collected as sorted runs and, once the background is loaded,\n";
+		cout << "//       merged into a dense bitset (512 MB), a prefix-bucketed bitset or an\n";
+		cout << "//       Elias-Fano array: the fastest that fits the budget (0 = unlimited)\n";
+		cout << "//       and is within 8 times the smallest; runs that outgrow 256 MB switch\n";
+		cout << "//       to the dense bitset while loading, if it fits the budget;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  builds with BASE123_MPI (x64) may be launched by mpiexec/mpirun;\n";
+		cout << "//       ranks split the background list and combine their backgrounds (a\n";
+		cout << "//       bitwise-OR allreduce, or a gather of 16-mer runs), then claim\n";
+		cout << "//       foreground list chunks dynamically;\n";
+		cout << "//       rank 0 writes the output table and error files;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -cds_table aggregates each foreground nMer's mutation count into\n";
+		cout << "//       the catalog CDS (or inter-CDS segment) in which the nMer starts, and\n";
+		cout << "//       writes one row per segment (accession, segment, name, complement,\n";
+		cout << "//       start, stop, nMer count, forward/reverse totals and scores);\n";
+		cout << "//       nucleotide alphabet only;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -background_export writes the loaded background nMer set (default:\n";
+		cout << "//       present, text) to <base>_<set>_<chunk>.<txt|2bit|delta> files of 2^24\n";
+		cout << "//       ranks each, plus a <base>_<set>_manifest.txt table; 2bit packs each\n";
+		cout << "//       nMer into nMer / 4 bytes (little-endian); delta writes LEB128 gaps\n";
+		cout << "//       between ascending ranks, starting from the chunk's first rank;\n";
+		cout << "//       nucleotide alphabet only;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -results_store appends the foreground results (one binary columnar\n";
+		cout << "//       block per run; genome and .sh_N shuffle replicates) for\n";
+		cout << "//       -contabulate_results_store;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -shuffle_count shuffles each foreground genome (FRESH, catalog\n";
+		cout << "//       CDS-aware) and scores the genome and its shuffles in one pass; no\n";
+		cout << "//       shuffle .fa (unless -store_shuffles y) or shuffle .fdist file is\n";
+		cout << "//       written; -shuffle_table receives the contabulated table (see\n";
+		cout << "//       -help_contabulate_results_store); -results_store receives every\n";
+		cout << "//       genome and shuffle; -shuffle_seed (default 0) keys each replicate's\n";
+		cout << "//       random stream with the accession and replicate index, so replicates\n";
+		cout << "//       are the same for any thread or rank count; nucleotide alphabet only;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -archive reads the background and foreground .fa files from a\n";
+		cout << "//       sequence archive (see -help_create_sequence_archive [-hcsa]), by\n";
+		cout << "//       accession; nucleotide alphabet only;\n";
+		cout << "//\n";
+		cout << "//  NOTE:  -resume_journal records each completed foreground input and its\n";
+		cout << "//       table entry; on restart, inputs whose .fdist output validates\n";
+		cout << "//       against the journal are not rescored;\n";
 		cout << "//\n";
 		cout << "//  NOTE:  input file path name transforms can contain the following string\n";
 		cout << "//       replacement(s):\n";
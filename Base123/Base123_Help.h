@@ -29,12 +29,19 @@ void ReportFileSystemManagementHelp();
 void ReportListParseFNAtoFAHelp();
 void ReportListParseFAtoPORFHelp();
 void ReportListParsePORFtoORFHelp();
+void ReportCreateSequenceArchiveHelp();
 void ReportListParseGBKContainerHelp();
 void ReportDatCatalogHelp();
 void ReportGBKCatalogHelp();
+void ReportCompileCatalogHelp();
+void ReportQueryCatalogHelp();
+void ReportRefreshGBKCatalogHelp();
 void ReportFRESHHelp();
 void ReportFilterFDistanceListHelp();
 void ReportListContabulateFDistanceOutputHelp();
+void ReportContabulateResultsStoreHelp();
+void ReportListBuildSketchIndexHelp();
+void ReportListQuerySketchIndexHelp();
 void ReportListClearFDistanceOutputHelp();
 void ReportPerformFDistanceAnalysisHelp();
 void ReportListFoldFilesHelp();
@@ -0,0 +1,711 @@
+// Base123_MPI.cpp : Distributes Base123 F-Distance analysis across MPI ranks
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Distributes Base123 F-Distance analysis across MPI ranks; compiled as single-rank stubs unless
+//      BASE123_MPI is defined; MPI is called from the master thread only, outside of omp parallel
+//      regions (MPI_THREAD_FUNNELED);
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_MPI.h"
+#include "Base123_Utilities.h"
+
+#include <algorithm>
+#include <sstream>
+
+#ifdef BASE123_MPI
+	#include <mpi.h>
+#endif
+
+//  MPI rank
+int m_nRankMPI = 0;
+//  MPI rank count
+int m_nRankCountMPI = 1;
+//  MPI initialized by InitializeMPI(), if true
+bool m_bInitializedMPI = false;
+
+//  List chunks, list size
+long m_lListSizeMPI = 0;
+//  List chunks, dynamic chunk size
+long m_lChunkSizeMPI = 1;
+//  List chunks, claimed dynamically, if true; else, one contiguous block per rank
+bool m_bDynamicMPI = false;
+//  List chunks, static block issued, if true
+bool m_bBlockIssuedMPI = false;
+
+#ifdef BASE123_MPI
+	//  List chunks, dynamic claim counter window (counter resides on rank 0)
+	MPI_Win m_winCounterMPI;
+	//  List chunks, dynamic claim counter
+	long* m_lpCounterMPI = NULL;
+	//  Maximum words per reduction call (MPI counts are int)
+	const uint64_t m_ullMaxReduceWordsMPI = 1 << 26;
+	//  Maximum bytes per gather message (MPI counts are int)
+	const uint64_t m_ullMaxMessageBytesMPI = 1 << 30;
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Initializes MPI; a run without mpiexec/mpirun is a single rank
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [int*] npArgumentCount   :  main() argument count
+//  [char***] chpppArguments :  main() arguments
+//                          :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool InitializeMPI(int* npArgumentCount, char*** chpppArguments)
+{
+	try
+	{
+		#ifdef BASE123_MPI
+			//  Provided thread support
+			int nProvided = 0;
+
+			if (MPI_Init_thread(npArgumentCount, chpppArguments, MPI_THREAD_FUNNELED, &nProvided) == MPI_SUCCESS)
+			{
+				m_bInitializedMPI = true;
+
+				MPI_Comm_rank(MPI_COMM_WORLD, &m_nRankMPI);
+				MPI_Comm_size(MPI_COMM_WORLD, &m_nRankCountMPI);
+
+				if ((m_nRankMPI == 0) && (m_nRankCountMPI > 1))
+					ReportTimeStamp("[InitializeMPI]", "NOTE:  MPI Rank Count = " + ConvertIntToString(m_nRankCountMPI));
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[InitializeMPI]", "ERROR:  MPI Initialization Failed");
+			}
+		#else
+			//  Arguments are only passed to MPI
+			(void)npArgumentCount;
+			(void)chpppArguments;
+
+			return true;
+		#endif
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [InitializeMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Finalizes MPI
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool FinalizeMPI()
+{
+	try
+	{
+		#ifdef BASE123_MPI
+			if (m_bInitializedMPI)
+			{
+				m_bInitializedMPI = false;
+
+				return (MPI_Finalize() == MPI_SUCCESS);
+			}
+		#endif
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [FinalizeMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the MPI rank
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns rank (0, if not distributed)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int GetRankMPI()
+{
+	return m_nRankMPI;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the MPI rank count
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns rank count (1, if not distributed)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int GetRankCountMPI()
+{
+	return m_nRankCountMPI;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets a rank-private file path name, so ranks never append to the same file
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName :  file path name
+//                          :  returns <file path name>.<rank>, if distributed; else, the file path name
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetRankFilePathNameMPI(string strFilePathName)
+{
+	if ((m_nRankCountMPI > 1) && (!strFilePathName.empty()))
+		return strFilePathName + "." + ConvertIntToString(m_nRankMPI);
+
+	return strFilePathName;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Tests for the root (output) rank
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if rank 0; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool IsRootMPI()
+{
+	return (m_nRankMPI == 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Combines a bitset across ranks; in-place bitwise-OR allreduce (collective)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t*] ullaWords    :  bitset words
+//  [uint64_t] ullWordCount  :  bitset word count
+//                          :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReduceBitwiseOrMPI(uint64_t* ullaWords, uint64_t ullWordCount)
+{
+	try
+	{
+		//  If words are set
+		if ((ullaWords != NULL) || (ullWordCount == 0))
+		{
+			#ifdef BASE123_MPI
+				if (m_nRankCountMPI > 1)
+				{
+					for (uint64_t ullOffset = 0; ullOffset < ullWordCount; ullOffset += m_ullMaxReduceWordsMPI)
+					{
+						//  Words in this call
+						int nCount = (int)(((ullWordCount - ullOffset) < m_ullMaxReduceWordsMPI) ? (ullWordCount - ullOffset) : m_ullMaxReduceWordsMPI);
+
+						if (MPI_Allreduce(MPI_IN_PLACE, ullaWords + ullOffset, nCount, MPI_UINT64_T, MPI_BOR, MPI_COMM_WORLD) != MPI_SUCCESS)
+						{
+							ReportTimeStamp("[ReduceBitwiseOrMPI]", "ERROR:  MPI Allreduce Failed");
+
+							return false;
+						}
+					}
+				}
+			#endif
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[ReduceBitwiseOrMPI]", "ERROR:  Words are Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReduceBitwiseOrMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Combines a 16-bit flag array across ranks; in-place bitwise-OR allreduce (collective)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint16_t*] unaWords     :  flag array
+//  [uint64_t] ullWordCount  :  flag array size
+//                          :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReduceBitwiseOrMPI(uint16_t* unaWords, uint64_t ullWordCount)
+{
+	try
+	{
+		//  If words are set
+		if ((unaWords != NULL) || (ullWordCount == 0))
+		{
+			#ifdef BASE123_MPI
+				if (m_nRankCountMPI > 1)
+				{
+					for (uint64_t ullOffset = 0; ullOffset < ullWordCount; ullOffset += m_ullMaxReduceWordsMPI)
+					{
+						//  Words in this call
+						int nCount = (int)(((ullWordCount - ullOffset) < m_ullMaxReduceWordsMPI) ? (ullWordCount - ullOffset) : m_ullMaxReduceWordsMPI);
+
+						if (MPI_Allreduce(MPI_IN_PLACE, unaWords + ullOffset, nCount, MPI_UINT16_T, MPI_BOR, MPI_COMM_WORLD) != MPI_SUCCESS)
+						{
+							ReportTimeStamp("[ReduceBitwiseOrMPI]", "ERROR:  MPI Allreduce Failed");
+
+							return false;
+						}
+					}
+				}
+			#endif
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[ReduceBitwiseOrMPI]", "ERROR:  Words are Not Set");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReduceBitwiseOrMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Combines a flag across ranks; logical-OR allreduce (collective)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [bool&] bValue:  flag to combine
+//               :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReduceLogicalOrMPI(bool& bValue)
+{
+	try
+	{
+		#ifdef BASE123_MPI
+			if (m_nRankCountMPI > 1)
+			{
+				//  Flag, as int
+				int nValue = bValue ? 1 : 0;
+
+				if (MPI_Allreduce(MPI_IN_PLACE, &nValue, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD) != MPI_SUCCESS)
+				{
+					ReportTimeStamp("[ReduceLogicalOrMPI]", "ERROR:  MPI Allreduce Failed");
+
+					return false;
+				}
+
+				bValue = (nValue != 0);
+			}
+		#else
+			//  A single rank's flag is already combined
+			(void)bValue;
+		#endif
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReduceLogicalOrMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Opens a list for chunked processing (collective); see GetNextListChunkMPI()
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lListSize  :  list size
+//  [bool] bDynamic   :  if true, ranks claim chunks dynamically; else, each rank takes one contiguous block
+//  [long] lChunkSize :  dynamic chunk size
+//                   :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool OpenListChunksMPI(long lListSize, bool bDynamic, long lChunkSize)
+{
+	try
+	{
+		m_lListSizeMPI = lListSize;
+		m_lChunkSizeMPI = (lChunkSize > 0) ? lChunkSize : 1;
+		m_bDynamicMPI = bDynamic;
+		m_bBlockIssuedMPI = false;
+
+		#ifdef BASE123_MPI
+			if ((m_nRankCountMPI > 1) && (m_bDynamicMPI))
+			{
+				//  Counter window size, rank 0 only
+				MPI_Aint aintWindowSize = (m_nRankMPI == 0) ? sizeof(long) : 0;
+
+				if (MPI_Win_allocate(aintWindowSize, sizeof(long), MPI_INFO_NULL, MPI_COMM_WORLD, &m_lpCounterMPI, &m_winCounterMPI) != MPI_SUCCESS)
+				{
+					ReportTimeStamp("[OpenListChunksMPI]", "ERROR:  MPI Counter Window Allocation Failed");
+
+					return false;
+				}
+
+				//  Reset the counter before any rank claims
+				if (m_nRankMPI == 0)
+				{
+					MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, m_winCounterMPI);
+					*m_lpCounterMPI = 0;
+					MPI_Win_unlock(0, m_winCounterMPI);
+				}
+
+				MPI_Barrier(MPI_COMM_WORLD);
+			}
+		#endif
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [OpenListChunksMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the next list chunk for this rank; a single rank receives the whole list as one chunk
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long&] lChunkStart:  chunk start index
+//  [long&] lChunkEnd  :  chunk end index (exclusive)
+//                    :  returns true, if a chunk was issued; else (list exhausted), false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetNextListChunkMPI(long& lChunkStart, long& lChunkEnd)
+{
+	try
+	{
+		#ifdef BASE123_MPI
+			if ((m_nRankCountMPI > 1) && (m_bDynamicMPI))
+			{
+				//  Claim the next chunk
+				MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, m_winCounterMPI);
+				MPI_Fetch_and_op(&m_lChunkSizeMPI, &lChunkStart, MPI_LONG, 0, 0, MPI_SUM, m_winCounterMPI);
+				MPI_Win_unlock(0, m_winCounterMPI);
+
+				if (lChunkStart >= m_lListSizeMPI)
+					return false;
+
+				lChunkEnd = ((lChunkStart + m_lChunkSizeMPI) < m_lListSizeMPI) ? (lChunkStart + m_lChunkSizeMPI) : m_lListSizeMPI;
+
+				return true;
+			}
+		#endif
+
+		//  One contiguous block per rank
+		if (!m_bBlockIssuedMPI)
+		{
+			m_bBlockIssuedMPI = true;
+
+			lChunkStart = (long)(((int64_t)m_lListSizeMPI * m_nRankMPI) / m_nRankCountMPI);
+			lChunkEnd = (long)(((int64_t)m_lListSizeMPI * (m_nRankMPI + 1)) / m_nRankCountMPI);
+
+			return (lChunkStart < lChunkEnd);
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetNextListChunkMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Closes the chunked list (collective)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CloseListChunksMPI()
+{
+	try
+	{
+		#ifdef BASE123_MPI
+			if ((m_nRankCountMPI > 1) && (m_bDynamicMPI))
+			{
+				MPI_Win_free(&m_winCounterMPI);
+				m_lpCounterMPI = NULL;
+			}
+		#endif
+
+		m_lListSizeMPI = 0;
+		m_bBlockIssuedMPI = false;
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CloseListChunksMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gathers every rank's nMers on every rank (collective), in rank order; counts are 64-bit and
+//      each rank's nMers are broadcast in messages of at most m_ullMaxMessageBytesMPI
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<uint32_t>&] vSequences   :  this rank's nMers (all ranks' nMers, on return)
+//  [vector<uint64_t>&] vRankCounts  :  nMer counts, by rank
+//                                  :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool AllGatherSequencesMPI(vector<uint32_t>& vSequences, vector<uint64_t>& vRankCounts)
+{
+	try
+	{
+		#ifdef BASE123_MPI
+			if (m_nRankCountMPI > 1)
+			{
+				//  Local count
+				uint64_t ullLocalCount = (uint64_t)vSequences.size();
+				//  Gathered nMers
+				vector<uint32_t> vGathered;
+				//  Rank offset
+				uint64_t ullRankOffset = 0;
+				//  nMers per message
+				const uint64_t ullMaxMessageSequences = m_ullMaxMessageBytesMPI / sizeof(uint32_t);
+
+				vRankCounts.assign(m_nRankCountMPI, 0);
+
+				if (MPI_Allgather(&ullLocalCount, 1, MPI_UINT64_T, &vRankCounts[0], 1, MPI_UINT64_T, MPI_COMM_WORLD) != MPI_SUCCESS)
+				{
+					ReportTimeStamp("[AllGatherSequencesMPI]", "ERROR:  MPI Allgather Failed");
+
+					return false;
+				}
+
+				for (int nRank = 0; nRank < m_nRankCountMPI; nRank++)
+					ullRankOffset += vRankCounts[nRank];
+
+				vGathered.resize((size_t)ullRankOffset);
+				ullRankOffset = 0;
+
+				for (int nRank = 0; nRank < m_nRankCountMPI; nRank++)
+				{
+					//  This rank's nMers, in place
+					if (nRank == m_nRankMPI)
+					{
+						copy(vSequences.begin(), vSequences.end(), vGathered.begin() + ullRankOffset);
+						vector<uint32_t>().swap(vSequences);
+					}
+
+					//  Broadcast this rank's nMers in chunks
+					for (uint64_t ullOffset = 0; ullOffset < vRankCounts[nRank]; ullOffset += ullMaxMessageSequences)
+					{
+						//  nMers in this message
+						int nCount = (int)(((vRankCounts[nRank] - ullOffset) < ullMaxMessageSequences) ? (vRankCounts[nRank] - ullOffset) : ullMaxMessageSequences);
+
+						if (MPI_Bcast(&vGathered[ullRankOffset + ullOffset], nCount, MPI_UINT32_T, nRank, MPI_COMM_WORLD) != MPI_SUCCESS)
+						{
+							ReportTimeStamp("[AllGatherSequencesMPI]", "ERROR:  MPI Broadcast Failed");
+
+							return false;
+						}
+					}
+
+					ullRankOffset += vRankCounts[nRank];
+				}
+
+				vSequences.swap(vGathered);
+
+				return true;
+			}
+		#endif
+
+		//  A single rank's nMers are already complete
+		vRankCounts.assign(1, (uint64_t)vSequences.size());
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AllGatherSequencesMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gathers the non-empty entries of a list-indexed vector on rank 0 (collective); each list index
+//      is processed by exactly one rank, so entries never collide; sizes are 64-bit and each rank's
+//      entries are sent in messages of at most m_ullMaxMessageBytesMPI, so tables may exceed 2 GiB
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<string>&] vEntries:  list-indexed entries (complete on rank 0, on return)
+//                           :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool GatherListEntriesMPI(vector<string>& vEntries)
+{
+	try
+	{
+		#ifdef BASE123_MPI
+			if (m_nRankCountMPI > 1)
+			{
+				//  Local entries, serialized as <index>:<length>:<entry>
+				string strLocal = "";
+				//  Local size
+				uint64_t ullLocalSize = 0;
+				//  Rank sizes
+				vector<uint64_t> vSizes(m_nRankCountMPI, 0);
+
+				//  Rank 0 keeps its own entries in place
+				if (m_nRankMPI != 0)
+				{
+					for (long lCount = 0; lCount < vEntries.size(); lCount++)
+					{
+						if (!vEntries[lCount].empty())
+							strLocal += ConvertLongToString(lCount) + ":" + ConvertLongToString((long)vEntries[lCount].length()) + ":" + vEntries[lCount];
+					}
+				}
+
+				ullLocalSize = (uint64_t)strLocal.length();
+
+				if (MPI_Gather(&ullLocalSize, 1, MPI_UINT64_T, &vSizes[0], 1, MPI_UINT64_T, 0, MPI_COMM_WORLD) != MPI_SUCCESS)
+				{
+					ReportTimeStamp("[GatherListEntriesMPI]", "ERROR:  MPI Gather Failed");
+
+					return false;
+				}
+
+				//  Send this rank's entries in chunks
+				if (m_nRankMPI != 0)
+				{
+					for (uint64_t ullOffset = 0; ullOffset < ullLocalSize; ullOffset += m_ullMaxMessageBytesMPI)
+					{
+						//  Bytes in this message
+						int nCount = (int)(((ullLocalSize - ullOffset) < m_ullMaxMessageBytesMPI) ? (ullLocalSize - ullOffset) : m_ullMaxMessageBytesMPI);
+
+						if (MPI_Send(&strLocal[ullOffset], nCount, MPI_CHAR, 0, 0, MPI_COMM_WORLD) != MPI_SUCCESS)
+						{
+							ReportTimeStamp("[GatherListEntriesMPI]", "ERROR:  MPI Send Failed");
+
+							return false;
+						}
+					}
+				}
+				//  Receive and restore the entries of each rank
+				else
+				{
+					for (int nRank = 1; nRank < m_nRankCountMPI; nRank++)
+					{
+						//  Gathered text
+						string strGathered(vSizes[nRank], '\0');
+						//  Parse position
+						size_t posParse = 0;
+
+						for (uint64_t ullOffset = 0; ullOffset < vSizes[nRank]; ullOffset += m_ullMaxMessageBytesMPI)
+						{
+							//  Bytes in this message
+							int nCount = (int)(((vSizes[nRank] - ullOffset) < m_ullMaxMessageBytesMPI) ? (vSizes[nRank] - ullOffset) : m_ullMaxMessageBytesMPI);
+
+							if (MPI_Recv(&strGathered[ullOffset], nCount, MPI_CHAR, nRank, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE) != MPI_SUCCESS)
+							{
+								ReportTimeStamp("[GatherListEntriesMPI]", "ERROR:  MPI Receive Failed");
+
+								return false;
+							}
+						}
+
+						while (posParse < strGathered.length())
+						{
+							//  Index delimiter
+							size_t posIndex = strGathered.find(':', posParse);
+							//  Length delimiter
+							size_t posLength = (posIndex != string::npos) ? strGathered.find(':', posIndex + 1) : string::npos;
+							//  Entry index
+							long lIndex = 0;
+							//  Entry length
+							long lLength = 0;
+
+							if ((posIndex == string::npos) || (posLength == string::npos))
+							{
+								ReportTimeStamp("[GatherListEntriesMPI]", "ERROR:  Gathered Entries are Not Properly Formatted");
+
+								return false;
+							}
+
+							stringstream(strGathered.substr(posParse, posIndex - posParse)) >> lIndex;
+							stringstream(strGathered.substr(posIndex + 1, posLength - posIndex - 1)) >> lLength;
+
+							if ((lIndex >= 0) && (lIndex < vEntries.size()))
+								vEntries[lIndex] = strGathered.substr(posLength + 1, lLength);
+
+							posParse = posLength + 1 + lLength;
+						}
+					}
+				}
+			}
+		#else
+			//  A single rank's entries are already complete
+			(void)vEntries;
+		#endif
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GatherListEntriesMPI] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
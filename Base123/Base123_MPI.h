@@ -0,0 +1,40 @@
+// Base123_MPI.h : Distributes Base123 F-Distance analysis across MPI ranks
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Distributes Base123 F-Distance analysis across MPI ranks (header); compiled as single-rank stubs
+//      unless BASE123_MPI is defined (x64 configurations, MS-MPI; or mpicxx -DBASE123_MPI elsewhere);
+//
+//      background :  each rank marks a contiguous block of the list; tables are combined by an
+//                    in-place bitwise-OR allreduce (sorted 16-mer runs are gathered on every rank)
+//      foreground :  ranks claim chunks of the list dynamically from a counter on rank 0; table
+//                    and error entries are gathered on rank 0, which writes all output tables
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+bool InitializeMPI(int* npArgumentCount, char*** chpppArguments);
+bool FinalizeMPI();
+int GetRankMPI();
+int GetRankCountMPI();
+bool IsRootMPI();
+string GetRankFilePathNameMPI(string strFilePathName);
+bool ReduceBitwiseOrMPI(uint64_t* ullaWords, uint64_t ullWordCount);
+bool ReduceBitwiseOrMPI(uint16_t* unaWords, uint64_t ullWordCount);
+bool ReduceLogicalOrMPI(bool& bValue);
+bool AllGatherSequencesMPI(vector<uint32_t>& vSequences, vector<uint64_t>& vRankCounts);
+bool OpenListChunksMPI(long lListSize, bool bDynamic, long lChunkSize);
+bool GetNextListChunkMPI(long& lChunkStart, long& lChunkEnd);
+bool CloseListChunksMPI();
+bool GatherListEntriesMPI(vector<string>& vEntries);
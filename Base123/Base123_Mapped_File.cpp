@@ -0,0 +1,231 @@
+// Base123_Mapped_File.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Mapped_File class maps a file read-only into memory (mmap, or a file mapping view on
+//      Windows)
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Utilities.h"
+#include "Base123_Mapped_File.h"
+
+#ifdef _WIN64
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_Mapped_File class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Mapped_File::CBase123_Mapped_File()
+{
+	m_chpData = NULL;
+	m_ullSize = 0;
+
+	#ifdef _WIN64
+		m_hFile = INVALID_HANDLE_VALUE;
+		m_hMapping = NULL;
+	#else
+		m_nFile = -1;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_Mapped_File class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Mapped_File::~CBase123_Mapped_File()
+{
+	CloseMappedFile();
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Maps a file read-only into memory
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName:  file path name to map
+//                          :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Mapped_File::OpenMappedFile(string strFilePathName)
+{
+	try
+	{
+		CloseMappedFile();
+
+		if (!strFilePathName.empty())
+		{
+			#ifdef _WIN64
+				//  File size
+				LARGE_INTEGER liSize;
+
+				m_hFile = CreateFileA(strFilePathName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+
+				if ((m_hFile != INVALID_HANDLE_VALUE) && (GetFileSizeEx(m_hFile, &liSize)) && (liSize.QuadPart > 0))
+				{
+					m_ullSize = (uint64_t)liSize.QuadPart;
+					m_hMapping = CreateFileMappingA(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+
+					if (m_hMapping != NULL)
+						m_chpData = (const char*)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+				}
+			#else
+				//  File status
+				struct stat stStatus;
+
+				m_nFile = open(strFilePathName.c_str(), O_RDONLY);
+
+				if ((m_nFile >= 0) && (fstat(m_nFile, &stStatus) == 0) && (stStatus.st_size > 0))
+				{
+					//  Mapped image
+					void* pData = mmap(NULL, (size_t)stStatus.st_size, PROT_READ, MAP_SHARED, m_nFile, 0);
+
+					m_ullSize = (uint64_t)stStatus.st_size;
+
+					if (pData != MAP_FAILED)
+						m_chpData = (const char*)pData;
+				}
+			#endif
+
+			if (m_chpData != NULL)
+				return true;
+			else
+			{
+				ReportTimeStamp("[OpenMappedFile]", "ERROR:  File [" + strFilePathName + "] Open/Map Failed or File is Empty");
+
+				CloseMappedFile();
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[OpenMappedFile]", "ERROR:  File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [OpenMappedFile] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Unmaps and closes the file
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Mapped_File::CloseMappedFile()
+{
+	try
+	{
+		#ifdef _WIN64
+			if (m_chpData != NULL)
+				UnmapViewOfFile(m_chpData);
+			if (m_hMapping != NULL)
+				CloseHandle(m_hMapping);
+			if (m_hFile != INVALID_HANDLE_VALUE)
+				CloseHandle(m_hFile);
+
+			m_hMapping = NULL;
+			m_hFile = INVALID_HANDLE_VALUE;
+		#else
+			if (m_chpData != NULL)
+				munmap((void*)m_chpData, (size_t)m_ullSize);
+			if (m_nFile >= 0)
+				close(m_nFile);
+
+			m_nFile = -1;
+		#endif
+
+		m_chpData = NULL;
+		m_ullSize = 0;
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CloseMappedFile] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets whether a file is mapped
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if a file is mapped; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Mapped_File::GetIsOpen()
+{
+	return (m_chpData != NULL);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the mapped image
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the mapped image, if a file is mapped; else, NULL
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+const char* CBase123_Mapped_File::GetData()
+{
+	return m_chpData;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the mapped image size
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the mapped image size, bytes
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Mapped_File::GetSize()
+{
+	return m_ullSize;
+}
@@ -0,0 +1,60 @@
+// Base123_Mapped_File.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Mapped_File class (header) maps a file read-only into memory (mmap, or a file mapping
+//      view on Windows); the mapped image is shared by every thread and released on close
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstdint>
+#include <string>
+
+class CBase123_Mapped_File
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_Mapped_File();
+	//  Destructor
+	virtual ~CBase123_Mapped_File();
+
+	//  Interface (public)
+
+public:
+
+	bool OpenMappedFile(string strFilePathName);
+	bool CloseMappedFile();
+	bool GetIsOpen();
+	const char* GetData();
+	uint64_t GetSize();
+
+	//  Implementation (private)
+
+private:
+
+	//  Mapped image
+	const char* m_chpData;
+	//  Mapped image size, bytes
+	uint64_t m_ullSize;
+
+	#ifdef _WIN64
+		//  File handle
+		void* m_hFile;
+		//  File mapping handle
+		void* m_hMapping;
+	#else
+		//  File descriptor
+		int m_nFile;
+	#endif
+};
@@ -17,6 +17,9 @@
 #include "Base123_Utilities.h"
 #include "Base123_Catalog_Entry.h"
 #include "Base123_Catalog.h"
+#include "Base123_GBK_Parser.h"
+#include "Base123_Mapped_File.h"
+#include "Base123_Sequence_Archive.h"
 
 #include <sstream>
 #include <omp.h>
@@ -163,10 +166,12 @@ bool CreateORFFile(string strORFFilePathName)
 
 bool ParseGBKContainerFile(string strInputFilePathName, string strOutputFilePathNameTransform, string& strListEntry, string& strErrorEntry)
 {
-	//  The container file text
-	stringstream ssContainerFileText;
-	//  Input file text line
-	string strLine = "";
+	//  The container file (mapped)
+	CBase123_Mapped_File b123ContainerFile;
+	//  Input file text line (view into the container file text)
+	structGBKView stLine;
+	//  Start of the current .gbk file text
+	const char* chpGBKFileStart = NULL;
 	//  The .gbk file accession
 	string strAccession = "";
 	//  The output .gbk file path name
@@ -182,18 +187,24 @@ bool ParseGBKContainerFile(string strInputFilePathName, string strOutputFilePath
 		if (!strInputFilePathName.empty())
 		{
 			//  Parse individual container file
-			if (GetFileText(strInputFilePathName, ssContainerFileText))
+			if (b123ContainerFile.OpenMappedFile(strInputFilePathName))
 			{
+				//  Container scanner (sequence blocks are passed over, not split into lines)
+				CBase123_GBK_Parser b123Parser(b123ContainerFile.GetData(), (size_t)b123ContainerFile.GetSize(), false);
+
+				chpGBKFileStart = b123ContainerFile.GetData();
+
 				//  Read container and parse to file
-				while (getline(ssContainerFileText, strLine))
+				while (b123Parser.GetNextLine(stLine))
 				{
-					//  Increment line count (error reporting)
-					lCountLines++;
+					//  Line count (error reporting)
+					lCountLines = b123Parser.GetLineNumber();
 
 					//  End of file
-					if (strLine.substr(0, 2) == "//")
+					if (CBase123_GBK_Parser::GetHasPrefix(stLine, m_chaGBKKeywordEnd, sizeof(m_chaGBKKeywordEnd) - 1))
 					{
-						//  Complete the file
+						//  Complete the file (the container text, as is, to the end of file line)
+						strGBKFileText.assign(chpGBKFileStart, stLine.chpText - chpGBKFileStart);
 						strGBKFileText += "//";
 
 						//  If file path name is not empty
@@ -218,14 +229,14 @@ bool ParseGBKContainerFile(string strInputFilePathName, string strOutputFilePath
 						strGBKFileText = "";
 						strAccession = "";
 						strGBKFilePathName = "";
-}
-					//  Concatenate file text
-					else
-						strGBKFileText += strLine + '\n';
+						chpGBKFileStart = b123Parser.GetPosition();
+					}
 
 					//  LOCUS line, get accession
-					if (ConvertStringToLowerCase(strLine.substr(0, 5)) == "locus")
+					if (CBase123_GBK_Parser::GetHasPrefix(stLine, "locus", 5))
 					{
+						//  LOCUS line
+						string strLine = CBase123_GBK_Parser::GetText(stLine, 0, string::npos);
 						//  LOCUS vector<string>
 						vector<string> vLocus;
 
@@ -252,9 +263,6 @@ bool ParseGBKContainerFile(string strInputFilePathName, string strOutputFilePath
 							ReportTimeStamp("[ParseGBKContainerFile]", "ERROR:  Output .gbk File [" + ConvertLongToString(lCountLines) + "] Locus [" + strLine + "] is Not Properly Formatted");
 						}
 					}
-
-					//  Clear the line
-					strLine = "";
 				}
 
 				return true;
@@ -275,7 +283,7 @@ bool ParseGBKContainerFile(string strInputFilePathName, string strOutputFilePath
 	}
 
 	return false;
-						}
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -637,16 +645,17 @@ bool ParsePORFtoORF(string strPORFFilePathName, string strORFFolderName, int nMi
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string] strFAFilePathName      :  original fa file path name
-//  [int] nMinORFLength             :  minimum sequence length for ORF parse
-//  [int] nMaxORFLength             :  maximum sequence length for ORF parse
-//  [string&] strListEntry          :  output list file entry
-//  [string&] strErrorEntry         :  error file entry
-//                                  :  returns true, if successful; else, false
+//  [string] strFAFilePathName              :  original fa file path name
+//  [CBase123_Sequence_Archive&] b123Archive:  sequence archive (if open, the file is read from the archive)
+//  [int] nMinORFLength                     :  minimum sequence length for ORF parse
+//  [int] nMaxORFLength                     :  maximum sequence length for ORF parse
+//  [string&] strListEntry                  :  output list file entry
+//  [string&] strErrorEntry                 :  error file entry
+//                                          :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool ParseFAtoPORF(string strFAFilePathName, int nMinORFLength, int nMaxORFLength, string& strListEntry, string& strErrorEntry)
+bool ParseFAtoPORF(string strFAFilePathName, CBase123_Sequence_Archive& b123Archive, int nMinORFLength, int nMaxORFLength, string& strListEntry, string& strErrorEntry)
 {
 	//  FA file text
 	string strFAFileText = "";
@@ -693,7 +702,7 @@ bool ParseFAtoPORF(string strFAFilePathName, int nMinORFLength, int nMaxORFLengt
 		if (!strFAFilePathName.empty())
 		{
 			//  If the FA file open
-			if (GetFileText(strFAFilePathName, strFAFileText))
+			if (b123Archive.GetFAFileText(strFAFilePathName, strFAFileText))
 			{
 				//  If the FA file text is not empty, then process the file
 				if (!strFAFileText.empty())
@@ -1299,13 +1308,16 @@ bool ListProcessFNAtoFA(string strInputFilePathNameList, string strOutputFilePat
 //  [string] strOutputListFilePathName    :  list file path name
 //  [string] strErrorFilePathName         :  error file path name
 //  [int] nMaxProcs                       :  maximum processors for openMP
+//  [string] strArchiveFilePathName       :  sequence archive file path name [optional; if set, files are read from the archive]
 //                                        :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
 bool ListParseFAtoPORF(string strInputFilePathNameList, string strInputFilePathNameTransform, int nMinORFLength, int nMaxORFLength, string strOutputListFilePathName,
-	string strErrorFilePathName, int nMaxProcs)
+	string strErrorFilePathName, int nMaxProcs, string strArchiveFilePathName)
 {
+	//  Sequence archive (files are read, unless opened)
+	CBase123_Sequence_Archive b123Archive;
 	//  List lock
 	omp_lock_t lockList;
 	//  List file text
@@ -1323,6 +1335,14 @@ bool ListParseFAtoPORF(string strInputFilePathNameList, string strInputFilePathN
 
 	try
 	{
+		//  Open the sequence archive, if set
+		if ((!strArchiveFilePathName.empty()) && (!b123Archive.OpenArchive(strArchiveFilePathName)))
+		{
+			ReportTimeStamp("[ListParseFAtoPORF]", "ERROR:  Sequence Archive [" + strArchiveFilePathName + "] Open Failed");
+
+			return false;
+		}
+
 		//  If input file path name list is not empty
 		if (!strInputFilePathNameList.empty())
 		{
@@ -1380,7 +1400,7 @@ bool ListParseFAtoPORF(string strInputFilePathNameList, string strInputFilePathN
 									strWorkingFilePathName = vFilePathNames[lCount];
 
 								//  Parse file
-								if (!ParseFAtoPORF(strWorkingFilePathName, nMinORFLength, nMaxORFLength, vListEntries[lCount], vErrorEntries[lCount]))
+								if (!ParseFAtoPORF(strWorkingFilePathName, b123Archive, nMinORFLength, nMaxORFLength, vListEntries[lCount], vErrorEntries[lCount]))
 								{
 									vErrorEntries[lCount] += strWorkingFilePathName + "~.fa to .pORF Parse Failed\n";
 
@@ -0,0 +1,759 @@
+// Base123_Results_Store.cpp : Stores Base123 F-Distance results in a binary columnar file
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Stores Base123 F-Distance results in a binary columnar file; F-Distance analysis appends a block
+//      per run, and contabulation scores each genome against its shuffle replicates without
+//      reopening any .fdist file; see Base123_Results_Store.h for the block layout
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Utilities.h"
+#include "Base123_Catalog_Entry.h"
+#include "Base123_Catalog.h"
+#include "Base123_Results_Store.h"
+
+#include <fstream>
+#include <sstream>
+#include <math.h>
+#include <omp.h>
+#include <unordered_map>
+
+//  Results store block magic
+const char m_chaResultsStoreMagic[8] = { 'B', '1', '2', '3', 'F', 'D', 'R', 'S' };
+//  Results store block version
+const uint32_t m_untResultsStoreVersion = 1;
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes a column of fixed-size values to a binary stream
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [ofstream&] oFile      :  binary output stream
+//  [vector<T>&] vColumn   :  column values
+//
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T> static void WriteResultsStoreColumn(ofstream& oFile, vector<T>& vColumn)
+{
+	if (!vColumn.empty())
+		oFile.write((const char*)&vColumn[0], sizeof(T) * vColumn.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reads a column of fixed-size values from a binary stream
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [ifstream&] iFile      :  binary input stream
+//  [uint32_t] untCount    :  value count
+//  [vector<T>&] vColumn   :  column values to set
+//                        :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T> static bool ReadResultsStoreColumn(ifstream& iFile, uint32_t untCount, vector<T>& vColumn)
+{
+	vColumn.resize(untCount);
+
+	if (untCount > 0)
+		iFile.read((char*)&vColumn[0], sizeof(T) * untCount);
+
+	return iFile.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the shuffle replicate of an input file path name (<base>.sh_N.fa)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName:  input file path name
+//                         :  returns replicate N, if a shuffle file; else, -1 (genome)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int GetReplicateFromFilePathName(string strFilePathName)
+{
+	//  File name
+	string strFileName = GetFileName(strFilePathName);
+	//  Replicate marker position
+	size_t ulPosition = strFileName.rfind(".sh_");
+	//  Replicate
+	int nReplicate = m_nResultsStoreGenome;
+
+	try
+	{
+		if (ulPosition != string::npos)
+		{
+			//  Digits end
+			size_t ulEnd = strFileName.find_first_not_of("0123456789", ulPosition + 4);
+
+			if ((ulEnd != ulPosition + 4) && ((ulEnd == string::npos) || (strFileName[ulEnd] == '.')))
+				stringstream(strFileName.substr(ulPosition + 4, ulEnd - ulPosition - 4)) >> nReplicate;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetReplicateFromFilePathName] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return nReplicate;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Parses an F-Distance output table entry (accession~length~forward total~forward score~
+//      reverse total~reverse score) into a result
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strTableEntry           :  F-Distance output table entry
+//  [int] nReplicate                  :  replicate of the entry
+//  [structFDistanceResult&] stResult :  result to set
+//                                   :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ParseFDistanceTableEntry(string& strTableEntry, int nReplicate, structFDistanceResult& stResult)
+{
+	//  Entry fields
+	vector<string> vFields;
+
+	try
+	{
+		SplitStringAllowEmptyEntries(strTableEntry, "~", vFields);
+
+		if ((vFields.size() == 6) && (!vFields[0].empty()))
+		{
+			stResult.strAccession = vFields[0];
+			stResult.nReplicate = nReplicate;
+			stringstream(vFields[1]) >> stResult.llLength;
+			stringstream(vFields[2]) >> stResult.llForwardTotal;
+			stringstream(vFields[3]) >> stResult.dForwardScore;
+			stringstream(vFields[4]) >> stResult.llReverseTotal;
+			stringstream(vFields[5]) >> stResult.dReverseScore;
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[ParseFDistanceTableEntry]", "ERROR:  Table Entry [" + strTableEntry + "] is Not Properly Formatted");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ParseFDistanceTableEntry] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Appends a block of results to the results store
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strStoreFilePathName             :  results store file path name
+//  [vector<structFDistanceResult>&] vResults :  results to append
+//                                           :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool AppendResultsStore(string strStoreFilePathName, vector<structFDistanceResult>& vResults)
+{
+	//  Store file
+	ofstream oFile;
+	//  Record count
+	uint32_t untCount = (uint32_t)vResults.size();
+	//  Columns
+	vector<int32_t> vReplicates(untCount);
+	vector<int64_t> vLengths(untCount);
+	vector<int64_t> vForwardTotals(untCount);
+	vector<double> vForwardScores(untCount);
+	vector<int64_t> vReverseTotals(untCount);
+	vector<double> vReverseScores(untCount);
+	vector<uint32_t> vAccessionLengths(untCount);
+	//  Accession bytes
+	string strAccessions = "";
+
+	try
+	{
+		//  If store file path name is not empty
+		if (!strStoreFilePathName.empty())
+		{
+			//  Transpose records to columns
+			for (uint32_t untRecord = 0; untRecord < untCount; untRecord++)
+			{
+				vReplicates[untRecord] = vResults[untRecord].nReplicate;
+				vLengths[untRecord] = vResults[untRecord].llLength;
+				vForwardTotals[untRecord] = vResults[untRecord].llForwardTotal;
+				vForwardScores[untRecord] = vResults[untRecord].dForwardScore;
+				vReverseTotals[untRecord] = vResults[untRecord].llReverseTotal;
+				vReverseScores[untRecord] = vResults[untRecord].dReverseScore;
+				vAccessionLengths[untRecord] = (uint32_t)vResults[untRecord].strAccession.length();
+				strAccessions += vResults[untRecord].strAccession;
+			}
+
+			oFile.open(strStoreFilePathName.c_str(), ios::out | ios::app | ios::binary);
+
+			if (oFile.is_open())
+			{
+				oFile.write(m_chaResultsStoreMagic, sizeof(m_chaResultsStoreMagic));
+				oFile.write((const char*)&m_untResultsStoreVersion, sizeof(uint32_t));
+				oFile.write((const char*)&untCount, sizeof(uint32_t));
+				WriteResultsStoreColumn(oFile, vReplicates);
+				WriteResultsStoreColumn(oFile, vLengths);
+				WriteResultsStoreColumn(oFile, vForwardTotals);
+				WriteResultsStoreColumn(oFile, vForwardScores);
+				WriteResultsStoreColumn(oFile, vReverseTotals);
+				WriteResultsStoreColumn(oFile, vReverseScores);
+				WriteResultsStoreColumn(oFile, vAccessionLengths);
+				oFile.write(strAccessions.c_str(), strAccessions.length());
+
+				//  Write status
+				bool bWritten = oFile.good();
+
+				oFile.close();
+
+				if (bWritten)
+					return true;
+				else
+				{
+					ReportTimeStamp("[AppendResultsStore]", "ERROR:  Results Store [" + strStoreFilePathName + "] Write Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[AppendResultsStore]", "ERROR:  Results Store [" + strStoreFilePathName + "] Create/Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[AppendResultsStore]", "ERROR:  Results Store File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AppendResultsStore] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reads every block of the results store
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strStoreFilePathName             :  results store file path name
+//  [vector<structFDistanceResult>&] vResults :  results to append, in store order
+//                                           :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReadResultsStore(string strStoreFilePathName, vector<structFDistanceResult>& vResults)
+{
+	//  Store file
+	ifstream iFile;
+	//  Block magic
+	char chaMagic[8];
+	//  Block version
+	uint32_t untVersion = 0;
+	//  Block record count
+	uint32_t untCount = 0;
+	//  Columns
+	vector<int32_t> vReplicates;
+	vector<int64_t> vLengths;
+	vector<int64_t> vForwardTotals;
+	vector<double> vForwardScores;
+	vector<int64_t> vReverseTotals;
+	vector<double> vReverseScores;
+	vector<uint32_t> vAccessionLengths;
+	//  Accession bytes
+	string strAccessions = "";
+
+	try
+	{
+		//  If store file path name is not empty
+		if (!strStoreFilePathName.empty())
+		{
+			iFile.open(strStoreFilePathName.c_str(), ios::in | ios::binary);
+
+			if (iFile.is_open())
+			{
+				//  Iterate blocks
+				while (iFile.read(chaMagic, sizeof(chaMagic)))
+				{
+					//  Accession byte count
+					uint64_t ullAccessionBytes = 0;
+					//  Accession offset
+					uint64_t ullOffset = 0;
+
+					iFile.read((char*)&untVersion, sizeof(uint32_t));
+					iFile.read((char*)&untCount, sizeof(uint32_t));
+
+					if ((!iFile.good()) || (string(chaMagic, sizeof(chaMagic)) != string(m_chaResultsStoreMagic, sizeof(m_chaResultsStoreMagic))) || (untVersion != m_untResultsStoreVersion))
+					{
+						ReportTimeStamp("[ReadResultsStore]", "ERROR:  Results Store [" + strStoreFilePathName + "] Block Header is Not Properly Formatted");
+
+						return false;
+					}
+
+					if ((!ReadResultsStoreColumn(iFile, untCount, vReplicates)) || (!ReadResultsStoreColumn(iFile, untCount, vLengths)) ||
+						(!ReadResultsStoreColumn(iFile, untCount, vForwardTotals)) || (!ReadResultsStoreColumn(iFile, untCount, vForwardScores)) ||
+						(!ReadResultsStoreColumn(iFile, untCount, vReverseTotals)) || (!ReadResultsStoreColumn(iFile, untCount, vReverseScores)) ||
+						(!ReadResultsStoreColumn(iFile, untCount, vAccessionLengths)))
+					{
+						ReportTimeStamp("[ReadResultsStore]", "ERROR:  Results Store [" + strStoreFilePathName + "] Block is Truncated");
+
+						return false;
+					}
+
+					for (uint32_t untRecord = 0; untRecord < untCount; untRecord++)
+						ullAccessionBytes += vAccessionLengths[untRecord];
+
+					strAccessions.resize((size_t)ullAccessionBytes);
+					if ((ullAccessionBytes > 0) && (!iFile.read(&strAccessions[0], (streamsize)ullAccessionBytes)))
+					{
+						ReportTimeStamp("[ReadResultsStore]", "ERROR:  Results Store [" + strStoreFilePathName + "] Block is Truncated");
+
+						return false;
+					}
+
+					//  Transpose columns to records
+					for (uint32_t untRecord = 0; untRecord < untCount; untRecord++)
+					{
+						//  Result
+						structFDistanceResult stResult;
+
+						stResult.strAccession = strAccessions.substr((size_t)ullOffset, vAccessionLengths[untRecord]);
+						stResult.nReplicate = vReplicates[untRecord];
+						stResult.llLength = vLengths[untRecord];
+						stResult.llForwardTotal = vForwardTotals[untRecord];
+						stResult.dForwardScore = vForwardScores[untRecord];
+						stResult.llReverseTotal = vReverseTotals[untRecord];
+						stResult.dReverseScore = vReverseScores[untRecord];
+
+						vResults.push_back(stResult);
+						ullOffset += vAccessionLengths[untRecord];
+					}
+				}
+
+				iFile.close();
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[ReadResultsStore]", "ERROR:  Results Store [" + strStoreFilePathName + "] Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ReadResultsStore]", "ERROR:  Results Store File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReadResultsStore] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Appends the F-Distance output table entries of a foreground list to the results store; the
+//      replicate of each entry is taken from its list file path name
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strStoreFilePathName         :  results store file path name
+//  [string] strInputListFilePathName     :  foreground input file path name list (entries align with the list)
+//  [vector<string>&] vOutputTableEntries :  F-Distance output table entries
+//                                       :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool StoreFDistanceTableEntries(string strStoreFilePathName, string strInputListFilePathName, vector<string>& vOutputTableEntries)
+{
+	//  Input list file text
+	string strInputListFileText = "";
+	//  File path names
+	vector<string> vFilePathNames;
+	//  Results
+	vector<structFDistanceResult> vResults;
+
+	try
+	{
+		//  Get list file text
+		if (GetFileText(strInputListFilePathName, strInputListFileText))
+		{
+			//  Split file path names, as the F-Distance list pass did
+			SplitString(strInputListFileText, '\n', vFilePathNames);
+
+			if (vFilePathNames.size() == vOutputTableEntries.size())
+			{
+				for (long lCount = 0; lCount < vOutputTableEntries.size(); lCount++)
+				{
+					//  Result
+					structFDistanceResult stResult;
+
+					//  Failed entries are left empty by the list pass
+					if ((!vOutputTableEntries[lCount].empty()) && (ParseFDistanceTableEntry(vOutputTableEntries[lCount], GetReplicateFromFilePathName(vFilePathNames[lCount]), stResult)))
+						vResults.push_back(stResult);
+				}
+
+				return AppendResultsStore(strStoreFilePathName, vResults);
+			}
+			else
+			{
+				ReportTimeStamp("[StoreFDistanceTableEntries]", "ERROR:  Input List [" + strInputListFilePathName + "] and Table Entries Do Not Align");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[StoreFDistanceTableEntries]", "ERROR:  Input List [" + strInputListFilePathName + "] Open Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [StoreFDistanceTableEntries] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Compiles the shuffle statistics of a genome score; the p-value is the empirical lower tail,
+//      (1 + replicates scoring <= genome) / (1 + replicates), as a genome closer to the background
+//      than its shuffles scores lower
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<double>&] vReplicateScores:  shuffle replicate scores
+//  [double] dGenomeScore             :  genome score
+//  [double&] dMean                   :  replicate mean to set
+//  [double&] dStandardDeviation      :  replicate sample standard deviation to set (0, if < 2 replicates)
+//  [double&] dZScore                 :  genome z-score to set (0, if standard deviation is 0)
+//  [double&] dPValue                 :  empirical p-value to set
+//                                   :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CompileShuffleStatistics(vector<double>& vReplicateScores, double dGenomeScore, double& dMean, double& dStandardDeviation, double& dZScore, double& dPValue)
+{
+	//  Replicate count
+	long lCount = (long)vReplicateScores.size();
+	//  Sum of squared deviations
+	double dSquares = 0;
+	//  Replicates scoring <= genome
+	long lLower = 0;
+
+	try
+	{
+		dMean = 0;
+		dStandardDeviation = 0;
+		dZScore = 0;
+		dPValue = 1;
+
+		if (lCount > 0)
+		{
+			for (long lReplicate = 0; lReplicate < lCount; lReplicate++)
+			{
+				dMean += vReplicateScores[lReplicate];
+
+				if (vReplicateScores[lReplicate] <= dGenomeScore)
+					lLower++;
+			}
+
+			dMean /= (double)lCount;
+
+			for (long lReplicate = 0; lReplicate < lCount; lReplicate++)
+				dSquares += (vReplicateScores[lReplicate] - dMean) * (vReplicateScores[lReplicate] - dMean);
+
+			if (lCount > 1)
+				dStandardDeviation = sqrt(dSquares / (double)(lCount - 1));
+
+			if (dStandardDeviation > 0)
+				dZScore = (dGenomeScore - dMean) / dStandardDeviation;
+
+			dPValue = (double)(1 + lLower) / (double)(1 + lCount);
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CompileShuffleStatistics] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the results store contabulation table header (follows the catalog demographics header)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns table header, if successful; else, empty string
+//
+////////////////////////////////////////////////////////////////////////////////
+
+string GetResultsStoreTableHeader()
+{
+	//  Header to return
+	string strHeader = "";
+
+	try
+	{
+		strHeader += "~Length (F-Distance)~Shuffle Count";
+		strHeader += "~Forward Mutation Total (gen)~Forward F-Distance Score (gen)~Forward Shuffle Mean~Forward Shuffle SD~Forward Z-Score~Forward p-Value";
+		strHeader += "~Reverse Mutation Total (gen)~Reverse F-Distance Score (gen)~Reverse Shuffle Mean~Reverse Shuffle SD~Reverse Z-Score~Reverse p-Value";
+		strHeader += "\n";
+
+		return strHeader;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetResultsStoreTableHeader] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strHeader;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Contabulates F-Distance results; scores each genome against its shuffle replicates, in parallel
+//      by accession, combining them with the foreground genome's catalog, and writes the table
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strOutputTableFilePathName       :  output table file path name
+//  [string] strErrorFilePathName             :  error file path name; if empty, none is written
+//  [CBase123_Catalog&] bCatalog              :  foreground catalog
+//  [vector<structFDistanceResult>&] vResults :  results (a later record of an accession/replicate replaces an earlier one)
+//  [int] nMaxProcs                           :  maximum processors for openMP
+//                                           :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool WriteContabulatedResults(string strOutputTableFilePathName, string strErrorFilePathName, CBase123_Catalog& bCatalog, vector<structFDistanceResult>& vResults, int nMaxProcs)
+{
+	//  Accession group, by accession
+	unordered_map<string, long> umGroups;
+	//  Group record indices, by replicate (later records replace earlier ones)
+	vector<unordered_map<int, long>> vGroupRecords;
+	//  Output table entries
+	vector<string> vOutputTableEntries;
+	//  Error entries
+	vector<string> vErrorEntries;
+	//  Output table file text
+	string strOutputTableFileText = "";
+	//  Error file text
+	string strErrorFileText = "";
+
+	try
+	{
+		//  If output table file path name is not empty
+		if (!strOutputTableFilePathName.empty())
+		{
+			//  Group records by accession
+			for (long lCount = 0; lCount < vResults.size(); lCount++)
+			{
+				//  Group iterator
+				unordered_map<string, long>::iterator itGroup = umGroups.find(vResults[lCount].strAccession);
+
+				if (itGroup == umGroups.end())
+				{
+					itGroup = umGroups.insert(make_pair(vResults[lCount].strAccession, (long)vGroupRecords.size())).first;
+					vGroupRecords.resize(vGroupRecords.size() + 1);
+				}
+
+				vGroupRecords[itGroup->second][vResults[lCount].nReplicate] = lCount;
+			}
+
+			vOutputTableEntries.resize(vGroupRecords.size());
+			vErrorEntries.resize(vGroupRecords.size());
+
+			//  Declare team size
+			#pragma omp parallel num_threads(nMaxProcs)
+			{
+				//  Iterate and contabulate accessions
+				#pragma omp for schedule(dynamic)
+				for (long lCount = 0; lCount < vGroupRecords.size(); lCount++)
+				{
+					//  Genome record iterator
+					unordered_map<int, long>::iterator itGenome = vGroupRecords[lCount].find(m_nResultsStoreGenome);
+
+					if (itGenome != vGroupRecords[lCount].end())
+					{
+						//  Genome result
+						structFDistanceResult& stGenome = vResults[itGenome->second];
+						//  Catalog entry
+						CBase123_Catalog_Entry* pbceGet = bCatalog.GetEntryPointerByAccession(stGenome.strAccession);
+
+						if (pbceGet != NULL)
+						{
+							//  Replicate scores
+							vector<double> vForwardScores;
+							vector<double> vReverseScores;
+							//  Statistics
+							double dMean = 0, dStandardDeviation = 0, dZScore = 0, dPValue = 1;
+
+							for (unordered_map<int, long>::iterator itRecord = vGroupRecords[lCount].begin(); itRecord != vGroupRecords[lCount].end(); itRecord++)
+							{
+								if (itRecord->first != m_nResultsStoreGenome)
+								{
+									vForwardScores.push_back(vResults[itRecord->second].dForwardScore);
+									vReverseScores.push_back(vResults[itRecord->second].dReverseScore);
+								}
+							}
+
+							vOutputTableEntries[lCount] = pbceGet->GetDemographics() + "~" + ConvertLongToString((long)stGenome.llLength) + "~" + ConvertLongToString((long)vForwardScores.size());
+
+							CompileShuffleStatistics(vForwardScores, stGenome.dForwardScore, dMean, dStandardDeviation, dZScore, dPValue);
+							vOutputTableEntries[lCount] += "~" + ConvertLongToString((long)stGenome.llForwardTotal) + "~" + ConvertDoubleToString(stGenome.dForwardScore);
+							vOutputTableEntries[lCount] += "~" + ConvertDoubleToString(dMean) + "~" + ConvertDoubleToString(dStandardDeviation) + "~" + ConvertDoubleToString(dZScore) + "~" + ConvertDoubleToString(dPValue);
+
+							CompileShuffleStatistics(vReverseScores, stGenome.dReverseScore, dMean, dStandardDeviation, dZScore, dPValue);
+							vOutputTableEntries[lCount] += "~" + ConvertLongToString((long)stGenome.llReverseTotal) + "~" + ConvertDoubleToString(stGenome.dReverseScore);
+							vOutputTableEntries[lCount] += "~" + ConvertDoubleToString(dMean) + "~" + ConvertDoubleToString(dStandardDeviation) + "~" + ConvertDoubleToString(dZScore) + "~" + ConvertDoubleToString(dPValue);
+						}
+						else
+						{
+							vErrorEntries[lCount] = stGenome.strAccession + "~Catalog Search Error";
+						}
+					}
+					else
+					{
+						vErrorEntries[lCount] = vResults[vGroupRecords[lCount].begin()->second].strAccession + "~Genome Record Missing";
+					}
+				}
+			}
+
+			//  Get table header
+			strOutputTableFileText = bCatalog.GetDemographicsHeader() + GetResultsStoreTableHeader();
+
+			//  Concatenate error and table file text
+			for (long lCount = 0; lCount < vOutputTableEntries.size(); lCount++)
+			{
+				if (!vOutputTableEntries[lCount].empty())
+					strOutputTableFileText += vOutputTableEntries[lCount] + "\n";
+
+				if (!vErrorEntries[lCount].empty())
+					strErrorFileText += vErrorEntries[lCount] + "\n";
+			}
+
+			//  Write the table
+			if (!WriteFileText(strOutputTableFilePathName, strOutputTableFileText))
+			{
+				ReportTimeStamp("[WriteContabulatedResults]", "ERROR:  Output Table [" + strOutputTableFilePathName + "] Write Failed");
+
+				return false;
+			}
+
+			//  If error file path name is not empty
+			if (!strErrorFilePathName.empty())
+			{
+				if (!WriteFileText(strErrorFilePathName, strErrorFileText))
+					ReportTimeStamp("[WriteContabulatedResults]", "ERROR:  Error File [" + strErrorFilePathName + "] Write Failed");
+			}
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[WriteContabulatedResults]", "ERROR:  Output Table File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteContabulatedResults] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Contabulates the results store; scores each genome against its shuffle replicates, combining
+//      them with the foreground genome's catalog
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strStoreFilePathName      :  results store file path name
+//  [string] strOutputTableFilePathName:  output table file path name
+//  [string] strCatalogFilePathName    :  foreground catalog file path name
+//  [long] lMaxCatalogSize             :  maximum foreground catalog size
+//  [string] strErrorFilePathName      :  error file path name
+//  [int] nMaxProcs                    :  maximum processors for openMP
+//                                    :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ContabulateResultsStore(string strStoreFilePathName, string strOutputTableFilePathName, string strCatalogFilePathName, long lMaxCatalogSize, string strErrorFilePathName, int nMaxProcs)
+{
+	//  Results
+	vector<structFDistanceResult> vResults;
+
+	try
+	{
+		//  If output table file path name is not empty
+		if (!strOutputTableFilePathName.empty())
+		{
+			//  If catalog file path name is not empty
+			if ((!strCatalogFilePathName.empty()) && (lMaxCatalogSize > 0))
+			{
+				//  Catalog
+				CBase123_Catalog bCatalog(lMaxCatalogSize, true);
+
+				//  Open catalog
+				if (bCatalog.OpenCatalog(strCatalogFilePathName, nMaxProcs))
+				{
+					//  Read store
+					if (ReadResultsStore(strStoreFilePathName, vResults))
+					{
+						ReportTimeStamp("[ContabulateResultsStore]", "NOTE:  Results Store Records = " + ConvertLongToString((long)vResults.size()));
+
+						return WriteContabulatedResults(strOutputTableFilePathName, strErrorFilePathName, bCatalog, vResults, nMaxProcs);
+					}
+					else
+					{
+						ReportTimeStamp("[ContabulateResultsStore]", "ERROR:  Results Store [" + strStoreFilePathName + "] Read Failed");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ContabulateResultsStore]", "ERROR:  Catalog [" + strCatalogFilePathName + "] Open Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ContabulateResultsStore]", "ERROR:  Catalog File Path Name is Empty or Maximum Catalog Size is Not Greater Than Zero");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ContabulateResultsStore]", "ERROR:  Output Table File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ContabulateResultsStore] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
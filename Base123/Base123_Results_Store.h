@@ -0,0 +1,62 @@
+// Base123_Results_Store.h : Stores Base123 F-Distance results in a binary columnar file
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Stores Base123 F-Distance results in a binary columnar file (header); one record per accession and
+//      replicate (-1, the genome; N, its .sh_N shuffle); each F-Distance run appends one block:
+//
+//      "B123FDRS" (8 bytes), version (uint32), record count n (uint32), then n-element columns:
+//      replicate (int32), length (int64), forward total (int64), forward score (double),
+//      reverse total (int64), reverse score (double), accession length (uint32), accession bytes
+//
+//      contabulation reads all blocks (a later record of the same accession/replicate replaces an
+//      earlier one) and scores each genome against its shuffles (mean, sd, z-score, p-value)
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Base123_Catalog_Entry.h"
+#include "Base123_Catalog.h"
+
+using namespace std;
+
+//  Results store replicate, the (unshuffled) genome
+const int m_nResultsStoreGenome = -1;
+
+//  F-Distance result, one accession and replicate
+struct structFDistanceResult
+{
+	//  Accession
+	string strAccession;
+	//  Replicate (-1, genome; N, .sh_N shuffle)
+	int nReplicate;
+	//  F-Distance length
+	int64_t llLength;
+	//  Forward mutation total
+	int64_t llForwardTotal;
+	//  Forward F-Distance score
+	double dForwardScore;
+	//  Reverse mutation total
+	int64_t llReverseTotal;
+	//  Reverse F-Distance score
+	double dReverseScore;
+};
+
+int GetReplicateFromFilePathName(string strFilePathName);
+bool ParseFDistanceTableEntry(string& strTableEntry, int nReplicate, structFDistanceResult& stResult);
+bool AppendResultsStore(string strStoreFilePathName, vector<structFDistanceResult>& vResults);
+bool ReadResultsStore(string strStoreFilePathName, vector<structFDistanceResult>& vResults);
+bool StoreFDistanceTableEntries(string strStoreFilePathName, string strInputListFilePathName, vector<string>& vOutputTableEntries);
+bool CompileShuffleStatistics(vector<double>& vReplicateScores, double dGenomeScore, double& dMean, double& dStandardDeviation, double& dZScore, double& dPValue);
+string GetResultsStoreTableHeader();
+bool WriteContabulatedResults(string strOutputTableFilePathName, string strErrorFilePathName, CBase123_Catalog& bCatalog, vector<structFDistanceResult>& vResults, int nMaxProcs);
+bool ContabulateResultsStore(string strStoreFilePathName, string strOutputTableFilePathName, string strCatalogFilePathName, long lMaxCatalogSize, string strErrorFilePathName, int nMaxProcs);
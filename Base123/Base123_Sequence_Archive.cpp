@@ -0,0 +1,730 @@
+// Base123_Sequence_Archive.cpp
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Sequence_Archive class packs BIG .fa files into one memory-mapped archive (2-bit bases,
+//      exception runs, accession index) and reads them back by accession
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Utilities.h"
+#include "Base123_Sequence_Archive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <omp.h>
+
+//  Initialization
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_Sequence_Archive class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Sequence_Archive::CBase123_Sequence_Archive()
+{
+	memset(&m_stHeader, 0, sizeof(m_stHeader));
+	m_stpEntries = NULL;
+	m_stpExceptions = NULL;
+	m_untpPacked = NULL;
+	m_chpStrings = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Destructs the CBase123_Sequence_Archive class object
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Sequence_Archive::~CBase123_Sequence_Archive()
+{
+	CloseArchive();
+}
+
+//  Interface (public)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Creates a sequence archive from a list of BIG .fa files; files are read and packed in parallel,
+//      a block at a time, and written in list order; files that are not a single header line and
+//      sequence line, or whose accession is empty or repeated, are written to the error file
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathNameList     :  input .fa file path name list
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [string] strOutputArchiveFilePathName :  output archive file path name
+//  [string] strErrorFilePathName         :  error file path name
+//  [int] nMaxProcs                       :  maximum processors for openMP
+//                                        :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Sequence_Archive::CreateArchive(string strInputFilePathNameList, string strInputFilePathNameTransform, string strOutputArchiveFilePathName, string strErrorFilePathName, int nMaxProcs)
+{
+	//  Input list file text
+	string strInputListFileText = "";
+	//  File path name vector<string>
+	vector<string> vFilePathNames;
+	//  Error file text
+	string strErrorFileText = "";
+	//  Archive header
+	structSequenceArchiveHeader stHeader;
+	//  Archive entries (list order)
+	vector<structSequenceArchiveEntry> vEntries;
+	//  Archive entry accessions (list order)
+	vector<string> vAccessions;
+	//  Accessions archived (accession, entry index)
+	unordered_map<string, long> umAccessions;
+	//  Archive entry order (sorted by accession)
+	vector<long> vOrder;
+	//  Exception runs
+	vector<structSequenceArchiveException> vExceptions;
+	//  String bytes
+	string strStrings = "";
+	//  Packed bases written, bytes
+	uint64_t ullPackedBytes = 0;
+	//  Output file
+	ofstream oFile;
+	//  Alignment padding
+	const char chaPadding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	try
+	{
+		//  If input file path name list is not empty
+		if (!strInputFilePathNameList.empty())
+		{
+			//  If output archive file path name is not empty
+			if (!strOutputArchiveFilePathName.empty())
+			{
+				//  Get .fa list file text
+				if (GetFileText(strInputFilePathNameList, strInputListFileText))
+				{
+					//  Split list
+					SplitString(strInputListFileText, '\n', vFilePathNames);
+
+					oFile.open(strOutputArchiveFilePathName.c_str(), ios::out | ios::trunc | ios::binary);
+
+					if (oFile.is_open())
+					{
+						//  Header placeholder (rewritten once the section offsets are known)
+						memset(&stHeader, 0, sizeof(stHeader));
+						oFile.write((const char*)&stHeader, sizeof(stHeader));
+
+						for (long lBlockStart = 0; lBlockStart < (long)vFilePathNames.size(); lBlockStart += m_lSequenceArchiveBlockSize)
+						{
+							//  Block size
+							long lBlockSize = min(m_lSequenceArchiveBlockSize, (long)vFilePathNames.size() - lBlockStart);
+							//  Working file path names, by block entry
+							vector<string> vWorkingFilePathNames(lBlockSize);
+							//  Header lines, by block entry
+							vector<string> vHeaders(lBlockSize);
+							//  Packed bases, by block entry
+							vector<vector<uint8_t>> vPacked(lBlockSize);
+							//  Exception runs, by block entry
+							vector<vector<structSequenceArchiveException>> vBlockExceptions(lBlockSize);
+							//  Sequence lengths, by block entry
+							vector<uint64_t> vLengths(lBlockSize, 0);
+							//  Flags, by block entry
+							vector<uint32_t> vFlags(lBlockSize, 0);
+							//  Errors, by block entry (empty, if packed)
+							vector<string> vErrorEntries(lBlockSize);
+
+							ReportTimeStamp("[CreateArchive]", "NOTE:  Processing Entry [" + ConvertLongToString(lBlockStart) + "] [" + vFilePathNames[lBlockStart] + "]");
+
+							//  Read and pack the block
+							#pragma omp parallel for num_threads(nMaxProcs) schedule(dynamic, 16)
+							for (long lCount = 0; lCount < lBlockSize; lCount++)
+							{
+								//  .fa file text
+								string strFileText = "";
+
+								//  If input file path name transform is not empty
+								if (!strInputFilePathNameTransform.empty())
+									vWorkingFilePathNames[lCount] = TransformFilePathName(vFilePathNames[lBlockStart + lCount], strInputFilePathNameTransform, "");
+								else
+									vWorkingFilePathNames[lCount] = vFilePathNames[lBlockStart + lCount];
+
+								if (!GetFileText(vWorkingFilePathNames[lCount], strFileText))
+									vErrorEntries[lCount] = vWorkingFilePathNames[lCount] + "~Open Failed\n";
+								else if (!PackFAFileText(strFileText, vHeaders[lCount], vPacked[lCount], vBlockExceptions[lCount], vLengths[lCount], vFlags[lCount]))
+									vErrorEntries[lCount] = vWorkingFilePathNames[lCount] + "~Not Properly Formatted\n";
+							}
+
+							//  Write the block, in list order
+							for (long lCount = 0; lCount < lBlockSize; lCount++)
+							{
+								//  Accession
+								string strAccession = GetAccessionFromBIGFilePathName(vWorkingFilePathNames[lCount]);
+
+								if ((vErrorEntries[lCount].empty()) && (strAccession.empty()))
+									vErrorEntries[lCount] = vWorkingFilePathNames[lCount] + "~Accession is Empty\n";
+								else if ((vErrorEntries[lCount].empty()) && (umAccessions.find(strAccession) != umAccessions.end()))
+									vErrorEntries[lCount] = vWorkingFilePathNames[lCount] + "~Accession is Repeated\n";
+
+								if (vErrorEntries[lCount].empty())
+								{
+									//  Archive entry
+									structSequenceArchiveEntry stEntry;
+
+									memset(&stEntry, 0, sizeof(stEntry));
+									stEntry.ullAccessionOffset = strStrings.length();
+									stEntry.untAccessionLength = (uint32_t)strAccession.length();
+									strStrings += strAccession;
+									stEntry.ullHeaderOffset = strStrings.length();
+									stEntry.untHeaderLength = (uint32_t)vHeaders[lCount].length();
+									strStrings += vHeaders[lCount];
+									stEntry.ullLength = vLengths[lCount];
+									stEntry.ullPackedOffset = ullPackedBytes;
+									stEntry.ullExceptionStart = vExceptions.size();
+									stEntry.untExceptionCount = (uint32_t)vBlockExceptions[lCount].size();
+									stEntry.untFlags = vFlags[lCount];
+
+									if (!vPacked[lCount].empty())
+										oFile.write((const char*)&vPacked[lCount][0], vPacked[lCount].size());
+
+									ullPackedBytes += vPacked[lCount].size();
+									vExceptions.insert(vExceptions.end(), vBlockExceptions[lCount].begin(), vBlockExceptions[lCount].end());
+
+									umAccessions.emplace(strAccession, (long)vEntries.size());
+									vEntries.push_back(stEntry);
+									vAccessions.push_back(strAccession);
+								}
+								else
+								{
+									strErrorFileText += vErrorEntries[lCount];
+
+									ReportTimeStamp("[CreateArchive]", "ERROR:  .fa File [" + vWorkingFilePathNames[lCount] + "] Archive Failed");
+								}
+							}
+						}
+
+						//  Entry order, by accession
+						vOrder.resize(vEntries.size());
+						for (long lCount = 0; lCount < (long)vOrder.size(); lCount++)
+							vOrder[lCount] = lCount;
+
+						sort(vOrder.begin(), vOrder.end(), [&vAccessions](long lLeft, long lRight) { return vAccessions[lLeft] < vAccessions[lRight]; });
+
+						//  Set the header
+						memcpy(stHeader.chaMagic, m_chaSequenceArchiveMagic, sizeof(stHeader.chaMagic));
+						stHeader.untVersion = m_untSequenceArchiveVersion;
+						stHeader.ullEntryCount = vEntries.size();
+						stHeader.ullExceptionCount = vExceptions.size();
+						stHeader.ullPackedOffset = sizeof(stHeader);
+						stHeader.ullExceptionOffset = (stHeader.ullPackedOffset + ullPackedBytes + 7) & ~(uint64_t)7;
+						stHeader.ullEntryOffset = stHeader.ullExceptionOffset + sizeof(structSequenceArchiveException) * vExceptions.size();
+						stHeader.ullStringOffset = stHeader.ullEntryOffset + sizeof(structSequenceArchiveEntry) * vEntries.size();
+
+						//  Write the tables
+						oFile.write(chaPadding, stHeader.ullExceptionOffset - (stHeader.ullPackedOffset + ullPackedBytes));
+						if (!vExceptions.empty())
+							oFile.write((const char*)&vExceptions[0], sizeof(structSequenceArchiveException) * vExceptions.size());
+						for (size_t stCount = 0; stCount < vOrder.size(); stCount++)
+							oFile.write((const char*)&vEntries[vOrder[stCount]], sizeof(structSequenceArchiveEntry));
+						oFile.write(strStrings.data(), strStrings.length());
+
+						//  Write the header
+						oFile.seekp(0);
+						oFile.write((const char*)&stHeader, sizeof(stHeader));
+
+						oFile.close();
+
+						ReportTimeStamp("[CreateArchive]", "NOTE:  Archived Entries = " + ConvertLongToString((long)vEntries.size()) + " of " + ConvertLongToString((long)vFilePathNames.size()));
+
+						//  Write error file
+						if (!strErrorFilePathName.empty())
+						{
+							if (!WriteFileText(strErrorFilePathName, strErrorFileText))
+								ReportTimeStamp("[CreateArchive]", "ERROR:  Archive Error File [" + strErrorFilePathName + "] Write Failed");
+						}
+
+						if (!oFile.fail())
+							return true;
+						else
+						{
+							ReportTimeStamp("[CreateArchive]", "ERROR:  Archive File [" + strOutputArchiveFilePathName + "] Write Failed");
+						}
+					}
+					else
+					{
+						ReportTimeStamp("[CreateArchive]", "ERROR:  Archive File [" + strOutputArchiveFilePathName + "] Open Failed");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[CreateArchive]", "ERROR:  .fa List File [" + strInputFilePathNameList + "] Open Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[CreateArchive]", "ERROR:  Archive File Path Name is Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[CreateArchive]", "ERROR:  .fa Input File Path Name List is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CreateArchive] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Opens (maps) a sequence archive; the tables are read in place
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strArchiveFilePathName:  archive file path name
+//                                 :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Sequence_Archive::OpenArchive(string strArchiveFilePathName)
+{
+	//  Mapped image
+	const char* chpData = NULL;
+	//  Mapped image size, bytes
+	uint64_t ullSize = 0;
+
+	try
+	{
+		CloseArchive();
+
+		if (m_b123ArchiveFile.OpenMappedFile(strArchiveFilePathName))
+		{
+			chpData = m_b123ArchiveFile.GetData();
+			ullSize = m_b123ArchiveFile.GetSize();
+
+			if (ullSize >= sizeof(m_stHeader))
+				memcpy(&m_stHeader, chpData, sizeof(m_stHeader));
+
+			//  If the header and the section bounds are consistent with the file
+			if ((ullSize >= sizeof(m_stHeader)) && (memcmp(m_stHeader.chaMagic, m_chaSequenceArchiveMagic, sizeof(m_stHeader.chaMagic)) == 0) &&
+				(m_stHeader.untVersion == m_untSequenceArchiveVersion) && (m_stHeader.ullPackedOffset >= sizeof(m_stHeader)) &&
+				(m_stHeader.ullPackedOffset <= m_stHeader.ullExceptionOffset) && (m_stHeader.ullExceptionOffset % 8 == 0) &&
+				(m_stHeader.ullExceptionOffset + sizeof(structSequenceArchiveException) * m_stHeader.ullExceptionCount <= m_stHeader.ullEntryOffset) &&
+				(m_stHeader.ullEntryOffset + sizeof(structSequenceArchiveEntry) * m_stHeader.ullEntryCount <= m_stHeader.ullStringOffset) &&
+				(m_stHeader.ullStringOffset <= ullSize))
+			{
+				m_untpPacked = (const uint8_t*)(chpData + m_stHeader.ullPackedOffset);
+				m_stpExceptions = (const structSequenceArchiveException*)(chpData + m_stHeader.ullExceptionOffset);
+				m_stpEntries = (const structSequenceArchiveEntry*)(chpData + m_stHeader.ullEntryOffset);
+				m_chpStrings = chpData + m_stHeader.ullStringOffset;
+
+				for (uint64_t ullCount = 0; ullCount < m_stHeader.ullEntryCount; ullCount++)
+				{
+					if ((m_stpEntries[ullCount].ullAccessionOffset + m_stpEntries[ullCount].untAccessionLength > ullSize - m_stHeader.ullStringOffset) ||
+						(m_stpEntries[ullCount].ullHeaderOffset + m_stpEntries[ullCount].untHeaderLength > ullSize - m_stHeader.ullStringOffset) ||
+						(m_stpEntries[ullCount].ullPackedOffset + (m_stpEntries[ullCount].ullLength + 3) / 4 > m_stHeader.ullExceptionOffset - m_stHeader.ullPackedOffset) ||
+						(m_stpEntries[ullCount].ullExceptionStart + m_stpEntries[ullCount].untExceptionCount > m_stHeader.ullExceptionCount))
+					{
+						ReportTimeStamp("[OpenArchive]", "ERROR:  Archive File [" + strArchiveFilePathName + "] Entry [" + ConvertLongToString((long)ullCount) + "] is Out of Bounds");
+
+						CloseArchive();
+
+						return false;
+					}
+				}
+
+				ReportTimeStamp("[OpenArchive]", "NOTE:  Archive [" + strArchiveFilePathName + "] Opened, Entries = " + ConvertLongToString(GetEntryCount()));
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[OpenArchive]", "ERROR:  Archive File [" + strArchiveFilePathName + "] Header is Not Properly Formatted");
+			}
+
+			CloseArchive();
+		}
+		else
+		{
+			ReportTimeStamp("[OpenArchive]", "ERROR:  Archive File [" + strArchiveFilePathName + "] Open Failed");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [OpenArchive] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Closes (unmaps) the sequence archive
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Sequence_Archive::CloseArchive()
+{
+	try
+	{
+		memset(&m_stHeader, 0, sizeof(m_stHeader));
+		m_stpEntries = NULL;
+		m_stpExceptions = NULL;
+		m_untpPacked = NULL;
+		m_chpStrings = NULL;
+
+		return m_b123ArchiveFile.CloseMappedFile();
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CloseArchive] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets whether the sequence archive is open
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns true, if open; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Sequence_Archive::GetIsOpen()
+{
+	return (m_stpEntries != NULL);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the archive entry count
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns the entry count (0, if not open)
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_Sequence_Archive::GetEntryCount()
+{
+	return (long)m_stHeader.ullEntryCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the text of a BIG .fa file; if the archive is open, the file is not opened, and its text is
+//      read from the archive by the accession of the file path name; else, the file is read
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName:  .fa file path name
+//  [string&] strFileText   :  the file text
+//                          :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Sequence_Archive::GetFAFileText(string strFilePathName, string& strFileText)
+{
+	//  Accession
+	string strAccession = "";
+	//  Entry index
+	long lIndex = -1;
+
+	try
+	{
+		if (!GetIsOpen())
+			return GetFileText(strFilePathName, strFileText);
+
+		strFileText = "";
+		strAccession = GetAccessionFromBIGFilePathName(strFilePathName);
+		lIndex = GetEntryIndex(strAccession);
+
+		if (lIndex >= 0)
+		{
+			//  Entry
+			const structSequenceArchiveEntry& stEntry = m_stpEntries[lIndex];
+			//  Sequence start (file text position)
+			size_t stStart = (size_t)stEntry.untHeaderLength + 1;
+
+			strFileText.reserve(stStart + (size_t)stEntry.ullLength + 1);
+			strFileText.assign(m_chpStrings + stEntry.ullHeaderOffset, stEntry.untHeaderLength);
+			strFileText += '\n';
+			strFileText.resize(stStart + (size_t)stEntry.ullLength);
+
+			if (DecodeSequence(lIndex, &strFileText[0] + stStart))
+			{
+				if (stEntry.untFlags & m_untSequenceArchiveTrailingNewLine)
+					strFileText += '\n';
+
+				return true;
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[GetFAFileText]", "ERROR:  Accession [" + strAccession + "] of [" + strFilePathName + "] is Not Archived");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFAFileText] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets an archived header line and sequence by accession
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strAccession :  accession
+//  [string&] strHeader   :  the header line
+//  [string&] strSequence :  the sequence
+//                        :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Sequence_Archive::GetSequence(string strAccession, string& strHeader, string& strSequence)
+{
+	//  Entry index
+	long lIndex = -1;
+
+	try
+	{
+		strHeader = "";
+		strSequence = "";
+
+		if (GetIsOpen())
+		{
+			lIndex = GetEntryIndex(strAccession);
+
+			if (lIndex >= 0)
+			{
+				strHeader.assign(m_chpStrings + m_stpEntries[lIndex].ullHeaderOffset, m_stpEntries[lIndex].untHeaderLength);
+				strSequence.resize((size_t)m_stpEntries[lIndex].ullLength);
+
+				return ((strSequence.empty()) || (DecodeSequence(lIndex, &strSequence[0])));
+			}
+			else
+			{
+				ReportTimeStamp("[GetSequence]", "ERROR:  Accession [" + strAccession + "] is Not Archived");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[GetSequence]", "ERROR:  Archive is Not Open");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetSequence] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+//  Implementation (private)
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the index of an archive entry by accession (binary search of the sorted entry table)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strAccession:  accession
+//                        :  returns the entry index, if archived; else, -1
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+long CBase123_Sequence_Archive::GetEntryIndex(string& strAccession)
+{
+	//  Search bounds
+	long lLow = 0;
+	long lHigh = GetEntryCount() - 1;
+
+	while (lLow <= lHigh)
+	{
+		//  Probe
+		long lMiddle = lLow + (lHigh - lLow) / 2;
+		//  Comparison
+		int nCompare = strAccession.compare(0, string::npos, m_chpStrings + m_stpEntries[lMiddle].ullAccessionOffset, m_stpEntries[lMiddle].untAccessionLength);
+
+		if (nCompare == 0)
+			return lMiddle;
+		else if (nCompare < 0)
+			lHigh = lMiddle - 1;
+		else
+			lLow = lMiddle + 1;
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Decodes an archived sequence (packed bases, then exception runs)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [long] lIndex        :  entry index
+//  [char*] chpSequence  :  the sequence (entry length, bytes; not terminated)
+//                       :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Sequence_Archive::DecodeSequence(long lIndex, char* chpSequence)
+{
+	//  Entry
+	const structSequenceArchiveEntry& stEntry = m_stpEntries[lIndex];
+	//  Packed bases
+	const uint8_t* untpPacked = m_untpPacked + stEntry.ullPackedOffset;
+	//  Whole packed bytes
+	uint64_t ullBytes = stEntry.ullLength / 4;
+
+	//  Four bases per byte, low bits first
+	for (uint64_t ullCount = 0; ullCount < ullBytes; ullCount++)
+	{
+		chpSequence[0] = m_chaSequenceArchiveBases[untpPacked[ullCount] & 0x3];
+		chpSequence[1] = m_chaSequenceArchiveBases[(untpPacked[ullCount] >> 2) & 0x3];
+		chpSequence[2] = m_chaSequenceArchiveBases[(untpPacked[ullCount] >> 4) & 0x3];
+		chpSequence[3] = m_chaSequenceArchiveBases[(untpPacked[ullCount] >> 6) & 0x3];
+		chpSequence += 4;
+	}
+
+	for (uint64_t ullCount = ullBytes * 4; ullCount < stEntry.ullLength; ullCount++)
+		*chpSequence++ = m_chaSequenceArchiveBases[(untpPacked[ullBytes] >> ((ullCount % 4) * 2)) & 0x3];
+
+	chpSequence -= stEntry.ullLength;
+
+	//  Exception runs
+	for (uint64_t ullCount = 0; ullCount < stEntry.untExceptionCount; ullCount++)
+	{
+		//  Run
+		const structSequenceArchiveException& stException = m_stpExceptions[stEntry.ullExceptionStart + ullCount];
+
+		if (stException.ullPosition + stException.untLength > stEntry.ullLength)
+		{
+			ReportTimeStamp("[DecodeSequence]", "ERROR:  Archive Entry [" + ConvertLongToString(lIndex) + "] Exception Run is Out of Bounds");
+
+			return false;
+		}
+
+		memset(chpSequence + stException.ullPosition, stException.chBase, stException.untLength);
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Packs BIG .fa file text (a header line, a sequence line and, optionally, a new-line)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strFileText                                  :  .fa file text
+//  [string&] strHeader                                    :  the header line
+//  [vector<uint8_t>&] vPacked                             :  the packed bases
+//  [vector<structSequenceArchiveException>&] vExceptions  :  the exception runs
+//  [uint64_t&] ullLength                                  :  the sequence length
+//  [uint32_t&] untFlags                                   :  the entry flags
+//                                                         :  returns true, if successful; else (not a single sequence), false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Sequence_Archive::PackFAFileText(string& strFileText, string& strHeader, vector<uint8_t>& vPacked, vector<structSequenceArchiveException>& vExceptions, uint64_t& ullLength, uint32_t& untFlags)
+{
+	//  Header line end
+	size_t stHeaderEnd = strFileText.find('\n');
+	//  Sequence end
+	size_t stSequenceEnd = strFileText.length();
+
+	vPacked.clear();
+	vExceptions.clear();
+	ullLength = 0;
+	untFlags = 0;
+
+	if ((stHeaderEnd == string::npos) || (stHeaderEnd == 0))
+		return false;
+
+	if (strFileText[stSequenceEnd - 1] == '\n')
+	{
+		untFlags |= m_untSequenceArchiveTrailingNewLine;
+		stSequenceEnd--;
+	}
+
+	//  A single, non-empty sequence line, only
+	if ((stSequenceEnd <= stHeaderEnd + 1) || (strFileText.find('\n', stHeaderEnd + 1) < stSequenceEnd))
+		return false;
+
+	strHeader = strFileText.substr(0, stHeaderEnd);
+	ullLength = stSequenceEnd - (stHeaderEnd + 1);
+	vPacked.assign((size_t)((ullLength + 3) / 4), 0);
+
+	for (uint64_t ullCount = 0; ullCount < ullLength; ullCount++)
+	{
+		//  Character
+		char chBase = strFileText[stHeaderEnd + 1 + ullCount];
+		//  2-bit value
+		unsigned int untBase = m_untA;
+
+		switch (chBase)
+		{
+			case 'a':
+				untBase = m_untA;
+				break;
+			case 'c':
+				untBase = m_untC;
+				break;
+			case 'g':
+				untBase = m_untG;
+				break;
+			case 'u':
+				untBase = m_untTU;
+				break;
+			default:
+				//  Extend the last run, or start a new one
+				if ((!vExceptions.empty()) && (vExceptions.back().chBase == chBase) && (vExceptions.back().ullPosition + vExceptions.back().untLength == ullCount) && (vExceptions.back().untLength < UINT32_MAX))
+					vExceptions.back().untLength++;
+				else
+				{
+					//  Exception run
+					structSequenceArchiveException stException;
+
+					memset(&stException, 0, sizeof(stException));
+					stException.ullPosition = ullCount;
+					stException.untLength = 1;
+					stException.chBase = chBase;
+
+					vExceptions.push_back(stException);
+				}
+				break;
+		}
+
+		vPacked[(size_t)(ullCount / 4)] |= (uint8_t)(untBase << ((ullCount % 4) * 2));
+	}
+
+	return true;
+}
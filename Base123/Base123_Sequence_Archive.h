@@ -0,0 +1,148 @@
+// Base123_Sequence_Archive.h
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Base123_Sequence_Archive class (header) packs BIG .fa files into one memory-mapped file, so list
+//      commands read sequences by accession instead of opening one small file per genome; bases
+//      (a, c, g, u) are packed four per byte, every other character (n, IUPAC codes, t, upper-case,
+//      ...) is held as an exception run, and the header line is held as text; layout:
+//
+//      structSequenceArchiveHeader
+//      packed bases                            (list order, each entry starts on a byte)
+//      structSequenceArchiveException[count]   (8-byte aligned; each entry's runs contiguous, ascending)
+//      structSequenceArchiveEntry[count]       (sorted by accession, for binary search)
+//      string bytes                            (accessions and header lines)
+//
+//      an entry is keyed by the accession of its .fa file path name (see GetAccessionFromBIGFilePathName),
+//      and an archived file reads back as its exact text (header line, sequence line, trailing new-line)
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+using namespace std;
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Base123_Mapped_File.h"
+
+//  Sequence archive magic
+const char m_chaSequenceArchiveMagic[8] = { 'B', '1', '2', '3', 'S', 'E', 'Q', 'A' };
+//  Sequence archive version
+const uint32_t m_untSequenceArchiveVersion = 1;
+//  Sequence archive entry flag:  the .fa file text ends with a new-line
+const uint32_t m_untSequenceArchiveTrailingNewLine = 0x1;
+//  Sequence archive build block size (files read and packed in parallel, then written in list order)
+const long m_lSequenceArchiveBlockSize = 4096;
+//  Sequence archive packed base characters, by 2-bit value (see m_untA, m_untC, m_untG, m_untTU)
+const char m_chaSequenceArchiveBases[4] = { 'a', 'c', 'g', 'u' };
+
+//  Sequence archive header
+struct structSequenceArchiveHeader
+{
+	//  Magic
+	char chaMagic[8];
+	//  Version
+	uint32_t untVersion;
+	//  Reserved (alignment)
+	uint32_t untReserved;
+	//  Entry count
+	uint64_t ullEntryCount;
+	//  Exception count
+	uint64_t ullExceptionCount;
+	//  Packed bases offset
+	uint64_t ullPackedOffset;
+	//  Exception table offset
+	uint64_t ullExceptionOffset;
+	//  Entry table offset
+	uint64_t ullEntryOffset;
+	//  String bytes offset
+	uint64_t ullStringOffset;
+};
+
+//  Sequence archive entry
+struct structSequenceArchiveEntry
+{
+	//  Accession (string bytes offset)
+	uint64_t ullAccessionOffset;
+	//  Header line, without new-line (string bytes offset)
+	uint64_t ullHeaderOffset;
+	//  Accession length, bytes
+	uint32_t untAccessionLength;
+	//  Header line length, bytes
+	uint32_t untHeaderLength;
+	//  Sequence length, bases
+	uint64_t ullLength;
+	//  Packed bases (packed bases offset)
+	uint64_t ullPackedOffset;
+	//  First exception run (exception table index)
+	uint64_t ullExceptionStart;
+	//  Exception run count
+	uint32_t untExceptionCount;
+	//  Flags
+	uint32_t untFlags;
+};
+
+//  Sequence archive exception run (characters other than a, c, g, u; packed as a)
+struct structSequenceArchiveException
+{
+	//  Start (sequence position)
+	uint64_t ullPosition;
+	//  Length, characters
+	uint32_t untLength;
+	//  Character
+	char chBase;
+	//  Reserved (alignment)
+	char chaReserved[3];
+};
+
+class CBase123_Sequence_Archive
+{
+	//  Initialization
+
+public:
+
+	//  Constructor
+	CBase123_Sequence_Archive();
+	//  Destructor
+	virtual ~CBase123_Sequence_Archive();
+
+	//  Interface (public)
+
+public:
+
+	bool CreateArchive(string strInputFilePathNameList, string strInputFilePathNameTransform, string strOutputArchiveFilePathName, string strErrorFilePathName, int nMaxProcs);
+	bool OpenArchive(string strArchiveFilePathName);
+	bool CloseArchive();
+	bool GetIsOpen();
+	long GetEntryCount();
+	bool GetFAFileText(string strFilePathName, string& strFileText);
+	bool GetSequence(string strAccession, string& strHeader, string& strSequence);
+
+	//  Implementation (private)
+
+private:
+
+	long GetEntryIndex(string& strAccession);
+	bool DecodeSequence(long lIndex, char* chpSequence);
+	bool PackFAFileText(string& strFileText, string& strHeader, vector<uint8_t>& vPacked, vector<structSequenceArchiveException>& vExceptions, uint64_t& ullLength, uint32_t& untFlags);
+
+	//  Mapped archive file
+	CBase123_Mapped_File m_b123ArchiveFile;
+	//  Archive header (copy)
+	structSequenceArchiveHeader m_stHeader;
+	//  Entries (in the mapped file)
+	const structSequenceArchiveEntry* m_stpEntries;
+	//  Exception runs (in the mapped file)
+	const structSequenceArchiveException* m_stpExceptions;
+	//  Packed bases (in the mapped file)
+	const uint8_t* m_untpPacked;
+	//  String bytes (in the mapped file)
+	const char* m_chpStrings;
+};
@@ -0,0 +1,340 @@
+// Base123_Sequence_Profile.cpp : Profiles a nucleotide sequence in a single pass
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Profiles a nucleotide sequence in a single pass; see Base123_Sequence_Profile.h
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Utilities.h"
+#include "Base123_Sequence_Profile.h"
+
+#include <cstring>
+
+#if defined(_WIN64) || defined(__SSE2__)
+	#include <emmintrin.h>
+	#define BASE123_PROFILE_SSE2
+#endif
+
+//  Interleaved histogram count (consecutive bytes update different tables)
+const int m_nProfileHistograms = 4;
+//  Profile block length, bytes
+const size_t m_ulProfileBlockLength = 16;
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Profiles a sequence; counts every byte value and records the longest run of each
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [const char*] chpSequence            :  sequence
+//  [size_t] ulLength                    :  sequence length
+//  [structSequenceProfile&] stProfile   :  profile to set
+//                                       :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetSequenceProfile(const char* chpSequence, size_t ulLength, structSequenceProfile& stProfile)
+{
+	//  Sequence bytes
+	const unsigned char* uchpSequence = (const unsigned char*)chpSequence;
+	//  Interleaved histograms
+	uint64_t ullaaCounts[m_nProfileHistograms][256];
+	//  Current position
+	size_t ulPosition = 0;
+	//  Current run character
+	unsigned char uchRun = 0;
+	//  Current run length
+	uint64_t ullRun = 0;
+
+	try
+	{
+		memset(&stProfile, 0, sizeof(structSequenceProfile));
+		memset(ullaaCounts, 0, sizeof(ullaaCounts));
+
+		if ((chpSequence != NULL) || (ulLength == 0))
+		{
+			stProfile.ullLength = ulLength;
+
+			if (ulLength > 0)
+				uchRun = uchpSequence[0];
+
+			while (ulPosition < ulLength)
+			{
+				//  Block end
+				size_t ulEnd = ulLength;
+
+				#ifdef BASE123_PROFILE_SSE2
+					//  If the next block repeats the run character throughout, consume it whole
+					if ((ulPosition > 0) && (ulPosition + m_ulProfileBlockLength <= ulLength))
+					{
+						__m128i xmmBlock = _mm_loadu_si128((const __m128i*)(uchpSequence + ulPosition));
+						__m128i xmmPrior = _mm_loadu_si128((const __m128i*)(uchpSequence + ulPosition - 1));
+
+						if (_mm_movemask_epi8(_mm_cmpeq_epi8(xmmBlock, xmmPrior)) == 0xFFFF)
+						{
+							ullaaCounts[0][uchRun] += m_ulProfileBlockLength;
+							ullRun += m_ulProfileBlockLength;
+							ulPosition += m_ulProfileBlockLength;
+
+							continue;
+						}
+					}
+
+					if (ulPosition + m_ulProfileBlockLength < ulLength)
+						ulEnd = ulPosition + m_ulProfileBlockLength;
+				#endif
+
+				for (; ulPosition < ulEnd; ulPosition++)
+				{
+					//  Current character
+					unsigned char uchCharacter = uchpSequence[ulPosition];
+
+					ullaaCounts[ulPosition & (m_nProfileHistograms - 1)][uchCharacter]++;
+
+					if (uchCharacter == uchRun)
+						ullRun++;
+					else
+					{
+						if (ullRun > stProfile.ullaLongestRuns[uchRun])
+							stProfile.ullaLongestRuns[uchRun] = ullRun;
+
+						uchRun = uchCharacter;
+						ullRun = 1;
+					}
+				}
+			}
+
+			if (ullRun > stProfile.ullaLongestRuns[uchRun])
+				stProfile.ullaLongestRuns[uchRun] = ullRun;
+
+			//  Combine histograms
+			for (int nCharacter = 0; nCharacter < 256; nCharacter++)
+			{
+				for (int nHistogram = 0; nHistogram < m_nProfileHistograms; nHistogram++)
+					stProfile.ullaCounts[nCharacter] += ullaaCounts[nHistogram][nCharacter];
+			}
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[GetSequenceProfile]", "ERROR:  Sequence is NULL");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetSequenceProfile] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Profiles a sequence string
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strSequence                :  sequence
+//  [structSequenceProfile&] stProfile   :  profile to set
+//                                       :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetSequenceProfile(string& strSequence, structSequenceProfile& stProfile)
+{
+	return GetSequenceProfile(strSequence.data(), strSequence.length(), stProfile);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Profiles the sequence of BIG FA format file text (the first non-empty line after the header),
+//      in place
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strFileText                :  BIG FA format file text
+//  [structSequenceProfile&] stProfile   :  profile to set
+//                                       :  returns true, if a non-empty sequence line was profiled; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetFASequenceProfile(string& strFileText, structSequenceProfile& stProfile)
+{
+	//  Header start
+	size_t ulHeader = strFileText.find_first_not_of('\n');
+	//  Sequence start
+	size_t ulStart = string::npos;
+	//  Sequence end
+	size_t ulEnd = string::npos;
+
+	try
+	{
+		if (ulHeader != string::npos)
+		{
+			ulStart = strFileText.find('\n', ulHeader);
+
+			if (ulStart != string::npos)
+				ulStart = strFileText.find_first_not_of('\n', ulStart);
+		}
+
+		if (ulStart != string::npos)
+		{
+			ulEnd = strFileText.find('\n', ulStart);
+
+			if (ulEnd == string::npos)
+				ulEnd = strFileText.length();
+
+			return GetSequenceProfile(strFileText.data() + ulStart, ulEnd - ulStart, stProfile);
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFASequenceProfile] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the total count of a set of characters
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSequenceProfile&] stProfile   :  profile
+//  [string] strCharacters               :  characters to count (case-sensitive)
+//                                       :  returns count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetProfileCount(structSequenceProfile& stProfile, string strCharacters)
+{
+	//  Count to return
+	uint64_t ullCount = 0;
+
+	for (size_t ulCount = 0; ulCount < strCharacters.length(); ulCount++)
+		ullCount += stProfile.ullaCounts[(unsigned char)strCharacters[ulCount]];
+
+	return ullCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the G + C count (either case)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSequenceProfile&] stProfile   :  profile
+//                                       :  returns count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetProfileGCCount(structSequenceProfile& stProfile)
+{
+	return GetProfileCount(stProfile, "gcGC");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the GC content, as a fraction of the unambiguous nucleotides (a, c, g, t, u; either case)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSequenceProfile&] stProfile   :  profile
+//                                       :  returns GC content, or 0 if no unambiguous nucleotides
+//
+////////////////////////////////////////////////////////////////////////////////
+
+double GetProfileGCContent(structSequenceProfile& stProfile)
+{
+	//  Unambiguous nucleotide count
+	uint64_t ullNucleotides = GetProfileCount(stProfile, "acgtuACGTU");
+
+	if (ullNucleotides > 0)
+		return (double)GetProfileGCCount(stProfile) / (double)ullNucleotides;
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the IUPAC ambiguity code count (r, y, k, m, s, w, b, d, h, v, n; either case)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSequenceProfile&] stProfile   :  profile
+//                                       :  returns count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetProfileAmbiguityCount(structSequenceProfile& stProfile)
+{
+	return GetProfileCount(stProfile, "rykmswbdhvnRYKMSWBDHVN");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the gap (-) count
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSequenceProfile&] stProfile   :  profile
+//                                       :  returns count
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetProfileGapCount(structSequenceProfile& stProfile)
+{
+	return stProfile.ullaCounts[(unsigned char)'-'];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the longest run of a character (e.g., 'n' for the longest poly-n run)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSequenceProfile&] stProfile   :  profile
+//  [char] chCharacter                   :  character (case-sensitive)
+//                                       :  returns run length
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetProfileLongestRun(structSequenceProfile& stProfile, char chCharacter)
+{
+	return stProfile.ullaLongestRuns[(unsigned char)chCharacter];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the longest homopolymer (a run of a, c, g, t, or u; either case)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [structSequenceProfile&] stProfile   :  profile
+//                                       :  returns run length
+//
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t GetProfileLongestHomopolymer(structSequenceProfile& stProfile)
+{
+	//  Nucleotides
+	const string strNucleotides = "acgtuACGTU";
+	//  Longest run to return
+	uint64_t ullLongest = 0;
+
+	for (size_t ulCount = 0; ulCount < strNucleotides.length(); ulCount++)
+	{
+		if (stProfile.ullaLongestRuns[(unsigned char)strNucleotides[ulCount]] > ullLongest)
+			ullLongest = stProfile.ullaLongestRuns[(unsigned char)strNucleotides[ulCount]];
+	}
+
+	return ullLongest;
+}
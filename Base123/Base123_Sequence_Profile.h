@@ -0,0 +1,44 @@
+// Base123_Sequence_Profile.h : Profiles a nucleotide sequence in a single pass
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Profiles a nucleotide sequence in a single pass (header); one scan fills a 256-entry character
+//      histogram and the longest run of every character, from which GC content, ambiguity and gap
+//      counts, the longest poly-n run and the longest homopolymer are derived; runs of 16 identical
+//      bytes are consumed a block at a time (SSE2), the rest byte-wise into four interleaved
+//      histograms
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+//  Sequence profile structure
+struct structSequenceProfile
+{
+	//  Sequence length
+	uint64_t ullLength;
+	//  Character counts, by byte value
+	uint64_t ullaCounts[256];
+	//  Longest run of each character, by byte value
+	uint64_t ullaLongestRuns[256];
+};
+
+bool GetSequenceProfile(const char* chpSequence, size_t ulLength, structSequenceProfile& stProfile);
+bool GetSequenceProfile(string& strSequence, structSequenceProfile& stProfile);
+bool GetFASequenceProfile(string& strFileText, structSequenceProfile& stProfile);
+uint64_t GetProfileCount(structSequenceProfile& stProfile, string strCharacters);
+uint64_t GetProfileGCCount(structSequenceProfile& stProfile);
+double GetProfileGCContent(structSequenceProfile& stProfile);
+uint64_t GetProfileAmbiguityCount(structSequenceProfile& stProfile);
+uint64_t GetProfileGapCount(structSequenceProfile& stProfile);
+uint64_t GetProfileLongestRun(structSequenceProfile& stProfile, char chCharacter);
+uint64_t GetProfileLongestHomopolymer(structSequenceProfile& stProfile);
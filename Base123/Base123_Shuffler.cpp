@@ -17,9 +17,7 @@
 #include "Base123_Utilities.h"
 #include "Base123_Shuffler.h"
 
-#include <stdlib.h> 
 #include <math.h>
-#include <time.h>
 
 //  Initialization
 
@@ -41,6 +39,39 @@ CBase123_Shuffler::CBase123_Shuffler()
 		m_nMaxBases = 4;
 		m_nMaxFrames = 3;
 		m_dBaseSimilarities = 0;
+
+		//  Seed the random stream
+		SeedRandom(m_ullShuffleDefaultSeed, "", 0);
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CBase123_Shuffler] Exception Code:  " << ex.what() << "\n";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Constructs the CBase123_Shuffler class object, seeding the random stream of one replicate
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullSeed    :  shuffle seed
+//  [string] strAccession :  accession of the sequence to shuffle
+//  [int] nReplicate      :  replicate index
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+CBase123_Shuffler::CBase123_Shuffler(uint64_t ullSeed, string strAccession, int nReplicate)
+{
+	try
+	{
+		//  Set defaults
+		m_nMaxBases = 4;
+		m_nMaxFrames = 3;
+		m_dBaseSimilarities = 0;
+
+		//  Seed the random stream
+		SeedRandom(ullSeed, strAccession, nReplicate);
 	}
 	catch (exception ex)
 	{
@@ -87,10 +118,6 @@ string CBase123_Shuffler::shuffleSequence(string& strSequence, vector<structStar
 {
 	//  shuffle to return
 	string strshuffle = "";
-	//  Max shuffle attempts to break while loop in case of no solution
-	int nMaxshuffleAttempts = 100000;
-	//  Max shuffle counter
-	int nshuffleCount = 0;
 	//  Sub-sequence to shuffle
 	string strSubSequence = "";
 	//  Codon shuffle
@@ -103,6 +130,9 @@ string CBase123_Shuffler::shuffleSequence(string& strSequence, vector<structStar
 		//  If sequence contains at least one CDS start/stop pair
 		if (vStartsStops.size() >= 1)
 		{
+			//  Size the shuffle once (segments are appended)
+			strshuffle.reserve(strSequence.length());
+
 			//  Iterate starts/stops, parse and shuffle sequence
 			for (int nCount = 0; nCount < vStartsStops.size(); nCount++)
 			{
@@ -116,31 +146,18 @@ string CBase123_Shuffler::shuffleSequence(string& strSequence, vector<structStar
 
 					strshuffle += strBaseshuffle;
 				}
-				//  Else codon shuffle
+				//  Else codon shuffle (one pass; a codon shuffle always exists, if only the sub-sequence itself)
 				else
 				{
-					strCodonshuffle = "";
-					nshuffleCount = 0;
-					while ((strCodonshuffle.empty()) && (nshuffleCount < nMaxshuffleAttempts))
-					{
-						strCodonshuffle = GetCodonshuffle(strSubSequence);
-
-						//  Reject same-sequence shuffle
-						if (strCodonshuffle == strSubSequence)
-						{
-							strCodonshuffle = "";
+					strCodonshuffle = GetCodonshuffle(strSubSequence);
 
-							//  Accelerate shuffle count, as a same-sequence return indicates a short sequence and unlikely prospects for true shuffle
-							nshuffleCount += 10000;
-						}
+					//  If codon shuffle failed
+					if (strCodonshuffle.empty())
+					{
+						ReportTimeStamp("[shuffleSequence]", "ERROR:  Codon shuffle Failed [" + ConvertLongToString(vStartsStops[nCount].lStart) + ":" + ConvertLongToString(vStartsStops[nCount].lStop) + "]");
 
-						//  Increment counter
-						nshuffleCount++;
+						return "";
 					}
-					
-					//  Last pass base shuffle is better than nothing
-					if (strCodonshuffle.empty())
-						strCodonshuffle = GetBaseshuffle(strSubSequence);
 
 					strshuffle += strCodonshuffle;
 				}
@@ -186,8 +203,132 @@ double CBase123_Shuffler::GetBaseSimilarities()
 	return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Seeds the random stream; the stream depends only on the seed, accession and replicate index, so
+//      a replicate is the same for any thread count or schedule
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullSeed    :  shuffle seed
+//  [string] strAccession :  accession of the sequence to shuffle
+//  [int] nReplicate      :  replicate index
+//                        :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Shuffler::SeedRandom(uint64_t ullSeed, string strAccession, int nReplicate)
+{
+	//  Accession hash
+	uint64_t ullAccessionHash = m_ullShuffleHashBasis;
+	//  Stream key state
+	uint64_t ullState = 0;
+
+	try
+	{
+		//  Hash the accession (FNV-1a)
+		for (size_t stCount = 0; stCount < strAccession.length(); stCount++)
+		{
+			ullAccessionHash ^= (uint64_t)(unsigned char)strAccession[stCount];
+			ullAccessionHash *= m_ullShuffleHashPrime;
+		}
+
+		//  Mix the seed, then the accession hash, then the replicate index into the stream key
+		ullState = ullSeed;
+		ullState = GetSplitMix64(ullState) ^ ullAccessionHash;
+		ullState = GetSplitMix64(ullState) ^ (uint64_t)(uint32_t)nReplicate;
+
+		//  Fill the stream state from the key (SplitMix64 output is never all zero)
+		for (int nCount = 0; nCount < 4; nCount++)
+			m_ullaRandomState[nCount] = GetSplitMix64(ullState);
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [SeedRandom] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 //  Implementation (private)
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the next random value of the stream (xoshiro256**), uniform over [0, ullBound)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullBound:  exclusive upper bound
+//                     :  returns a random value less than the bound, if successful; else, zero
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Shuffler::GetRandom(uint64_t ullBound)
+{
+	//  Random value
+	uint64_t ullRandom = 0;
+	//  Rejection threshold (values below it would bias the modulus)
+	uint64_t ullThreshold = 0;
+	//  State shift
+	uint64_t ullShift = 0;
+
+	try
+	{
+		if (ullBound > 1)
+		{
+			ullThreshold = (0 - ullBound) % ullBound;
+
+			do
+			{
+				ullRandom = m_ullaRandomState[1] * 5;
+				ullRandom = ((ullRandom << 7) | (ullRandom >> 57)) * 9;
+
+				ullShift = m_ullaRandomState[1] << 17;
+				m_ullaRandomState[2] ^= m_ullaRandomState[0];
+				m_ullaRandomState[3] ^= m_ullaRandomState[1];
+				m_ullaRandomState[1] ^= m_ullaRandomState[2];
+				m_ullaRandomState[0] ^= m_ullaRandomState[3];
+				m_ullaRandomState[2] ^= ullShift;
+				m_ullaRandomState[3] = (m_ullaRandomState[3] << 45) | (m_ullaRandomState[3] >> 19);
+			} while (ullRandom < ullThreshold);
+
+			return ullRandom % ullBound;
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetRandom] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Advances a SplitMix64 state and returns its next output (used to key and fill the random stream)
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t&] ullState:  SplitMix64 state
+//                      :  returns the next output
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t CBase123_Shuffler::GetSplitMix64(uint64_t& ullState)
+{
+	//  Output
+	uint64_t ullOutput = 0;
+
+	ullState += 0x9E3779B97F4A7C15ULL;
+	ullOutput = ullState;
+	ullOutput = (ullOutput ^ (ullOutput >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	ullOutput = (ullOutput ^ (ullOutput >> 27)) * 0x94D049BB133111EBULL;
+
+	return ullOutput ^ (ullOutput >> 31);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Resets the Shuffler
@@ -222,23 +363,67 @@ bool CBase123_Shuffler::ZeroEdgeCounts()
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Codes a sequence as 2-bit base values (m_untA, m_untC, m_untG, m_untTU); characters other than
+//      a, c, g and u are coded as a
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strSequence     :  sequence to code
+//  [vector<uint8_t>&] vCodes :  base codes to set, one per sequence character
+//                            :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CBase123_Shuffler::GetBaseCodes(string& strSequence, vector<uint8_t>& vCodes)
+{
+	try
+	{
+		vCodes.resize(strSequence.length());
+
+		for (size_t stCount = 0; stCount < strSequence.length(); stCount++)
+		{
+			switch (strSequence[stCount])
+			{
+			case 'c':
+				vCodes[stCount] = m_untC;
+				break;
+			case 'g':
+				vCodes[stCount] = m_untG;
+				break;
+			case 'u':
+				vCodes[stCount] = m_untTU;
+				break;
+			default:
+				vCodes[stCount] = m_untA;
+				break;
+			}
+		}
+
+		return true;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetBaseCodes] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Loads the edges collection for a random shuffle
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  [string&] strSequence:  sequence to shuffle, character by character
-//                      :  returns true, if successful; else, false
+//  [vector<uint8_t>&] vCodes:  sequence to shuffle, as base codes
+//                           :  returns true, if successful; else, false
 //         
 ////////////////////////////////////////////////////////////////////////////////
 
-bool CBase123_Shuffler::LoadEdges(string& strSequence)
+bool CBase123_Shuffler::LoadEdges(vector<uint8_t>& vCodes)
 {
-	//  Edge selectors
-	int nSelect1 = 0;
-	int nSelect2 = 0;
-	int nSelect3 = 0;
 	//  Frame
 	int nFrame = 0;
 
@@ -248,52 +433,17 @@ bool CBase123_Shuffler::LoadEdges(string& strSequence)
 		if (ZeroEdgeCounts())
 		{
 			//  If sequence is not empty
-			if (!strSequence.empty())
+			if (!vCodes.empty())
 			{
 				//  Iterate sequence, codon by codon
-				for (long lCountSequence = 0; lCountSequence < strSequence.length() - 2; lCountSequence++)
+				for (long lCountSequence = 0; lCountSequence < (long)vCodes.size() - 2; lCountSequence++)
 				{
-					//  Set frame
-					if (lCountSequence % 3 == 2)
-						nFrame = 2;
-					else if (lCountSequence % 3 == 1)
-						nFrame = 1;
-					else
-						nFrame = 0;
-
-					//  Set edge selector 1 according to codon base 1
-					if (strSequence[lCountSequence] == 'a')
-						nSelect1 = 0;
-					else if (strSequence[lCountSequence] == 'c')
-						nSelect1 = 1;
-					else if (strSequence[lCountSequence] == 'g')
-						nSelect1 = 2;
-					else if (strSequence[lCountSequence] == 'u')
-						nSelect1 = 3;
-
-					//  Set edge selector 2 according to codon base 2
-					if (strSequence[lCountSequence+1] == 'a')
-						nSelect2 = 0;
-					else if (strSequence[lCountSequence + 1] == 'c')
-						nSelect2 = 1;
-					else if (strSequence[lCountSequence + 1] == 'g')
-						nSelect2 = 2;
-					else if (strSequence[lCountSequence + 1] == 'u')
-						nSelect2 = 3;
-
-					//  Set edge selector 3 according to codon base 3
-					if (strSequence[lCountSequence+2] == 'a')
-						nSelect3 = 0;
-					else if (strSequence[lCountSequence + 2] == 'c')
-						nSelect3 = 1;
-					else if (strSequence[lCountSequence + 2] == 'g')
-						nSelect3 = 2;
-					else if (strSequence[lCountSequence + 2] == 'u')
-						nSelect3 = 3;
-
 					//Edges[eval(S1[b]) * 4 + eval(S1[b + 1])][eval(S1[b + 2])][b % 3] += 1
-					m_arlEdges[(nSelect1 * 4) + nSelect2][nSelect3][nFrame]++;
+					m_arlEdges[(vCodes[lCountSequence] * 4) + vCodes[lCountSequence + 1]][vCodes[lCountSequence + 2]][nFrame]++;
 
+					//  Next frame
+					if (++nFrame == m_nMaxFrames)
+						nFrame = 0;
 				}
 
 				return true;
@@ -318,7 +468,11 @@ bool CBase123_Shuffler::LoadEdges(string& strSequence)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  shuffles a sequence, codon by codon
+//  shuffles a sequence, codon by codon; the shuffle is a random Eulerian path through the frame-aware
+//      edge graph (node:  doublet and frame; edge:  next base), so every frame's doublet-to-base
+//      counts are kept; each node but the last is given a last exit edge from a random arborescence
+//      rooted at the last node (Wilson's loop-erased walk), every other exit is randomly ordered, and
+//      the path is walked once (Altschul-Erickson/Kandel et al.; uniform over such shuffles)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -331,120 +485,142 @@ string CBase123_Shuffler::GetCodonshuffle(string& strSequence)
 {
 	//  shuffled sequence
 	string strshuffle = "";
-	//  Base selector
-	int nBaseSelect = 0;
-	//  Base index
+	//  Sequence base codes
+	vector<uint8_t> vCodes;
+	//  Node count (doublets x frames)
+	const int nNodes = 16 * 3;
+	//  Node exits (next bases), in walk order, by node
+	vector<uint8_t> vaExits[nNodes];
+	//  Next exit to walk, by node
+	size_t staExit[nNodes];
+	//  Last exit (next base), by node; -1, if none
+	int naLastExit[nNodes];
+	//  Node is in the arborescence, if true
+	bool baInTree[nNodes];
+	//  Remaining edge count, by node
+	long laEdgeTotals[nNodes];
+	//  Path start and end nodes
+	int nStartNode = 0;
+	int nEndNode = 0;
+	//  Walk node
+	int nNode = 0;
+	//  Edge selector
+	long lSelect = 0;
+	//  Next base index
 	int nBaseIndex = 0;
-	//  Edge selectors
-	int nSelect1 = 0;
-	int nSelect2 = 0;
-	//  Next base choice
-	string strNextBaseChoice = "";
-	//  Next base
-	char chrNextBase = '\0';
-	//  Frame
-	int nFrame = 0;
+	//  Exit swap
+	uint8_t untSwap = 0;
 
 	try
 	{
 		//  If sequence is not empty
 		if (!strSequence.empty())
 		{
-			//  Reset edges
-			if (LoadEdges(strSequence))
+			//  Code the sequence and load its edges
+			if ((GetBaseCodes(strSequence, vCodes)) && (LoadEdges(vCodes)))
 			{
-				//  First two bases always return
+				//  First two bases always return; a sequence of fewer than three bases has no edges
 				//  S2 = S1[:2]
-				strshuffle = strSequence.substr(0, 2);
+				strshuffle = strSequence;
 
-				//  Iterate sequence, codon by codon
-				//  for b in range(0, len(S1) - 2) :
-				for (long lCountSequence = 0; lCountSequence < strSequence.length() - 2; lCountSequence++)
+				if (vCodes.size() >= 3)
 				{
-					//  Set frame
-					if (lCountSequence % 3 == 2)
-						nFrame = 2;
-					else if (lCountSequence % 3 == 1)
-						nFrame = 1;
-					else
-						nFrame = 0;
+					//  Node edge totals
+					for (nNode = 0; nNode < nNodes; nNode++)
+					{
+						laEdgeTotals[nNode] = 0;
+						for (int nCountBases = 0; nCountBases < m_nMaxBases; nCountBases++)
+							laEdgeTotals[nNode] += m_arlEdges[nNode / 3][nCountBases][nNode % 3];
 
-					//  Set edge selector 1 according to codon base 1
-					if (strshuffle[lCountSequence] == 'a')
-						nSelect1 = 0;
-					else if (strshuffle[lCountSequence] == 'c')
-						nSelect1 = 1;
-					else if (strshuffle[lCountSequence] == 'g')
-						nSelect1 = 2;
-					else if (strshuffle[lCountSequence] == 'u')
-						nSelect1 = 3;
-
-					//  Set edge selector 2 according to codon base 2
-					if (strshuffle[lCountSequence + 1] == 'a')
-						nSelect2 = 0;
-					else if (strshuffle[lCountSequence + 1] == 'c')
-						nSelect2 = 1;
-					else if (strshuffle[lCountSequence + 1] == 'g')
-						nSelect2 = 2;
-					else if (strshuffle[lCountSequence + 1] == 'u')
-						nSelect2 = 3;
-						
-					//  Clear next base choice
-					//  nextBase = ''
-					strNextBaseChoice = "";
+						naLastExit[nNode] = -1;
+						baInTree[nNode] = false;
+						staExit[nNode] = 0;
+					}
+
+					//  Path start and end nodes
+					nStartNode = (((vCodes[0] * 4) + vCodes[1]) * 3);
+					nEndNode = (((vCodes[vCodes.size() - 2] * 4) + vCodes[vCodes.size() - 1]) * 3) + (int)((vCodes.size() - 2) % 3);
 
-					//  Iterate bases
-					//  for i in range(4) :
-					for (int nCountBases = 0; nCountBases < m_nMaxBases; nCountBases++)
+					//  Random arborescence toward the end node:  walk from each node by random edges until the tree is met, then
+					//      keep the loop-erased walk (the last step taken from each node) as that node's last exit
+					baInTree[nEndNode] = true;
+
+					for (int nCountNodes = 0; nCountNodes < nNodes; nCountNodes++)
 					{
-						if (nCountBases == 0)
-							chrNextBase = 'a';
-						else if (nCountBases == 1)
-							chrNextBase = 'c';
-						else if (nCountBases == 2)
-							chrNextBase = 'g';
-						else if (nCountBases == 3)
-							chrNextBase = 'u';
-
-						//  Iterate frames, concatenate next base choice
-						//  for j in range(Edges[eval(S2[b]) * 4 + eval(S2[b + 1])][i][b % 3]) :
-						for (int nCountEdges = 0; nCountEdges < m_arlEdges[(nSelect1 * 4) + nSelect2][nCountBases][nFrame]; nCountEdges++)
+						nNode = nCountNodes;
+
+						while ((!baInTree[nNode]) && (laEdgeTotals[nNode] > 0))
 						{
-							// nextBase += Bases[i]
-							strNextBaseChoice += chrNextBase;
+							lSelect = (long)GetRandom((uint64_t)laEdgeTotals[nNode]);
+
+							for (nBaseIndex = 0; lSelect >= m_arlEdges[nNode / 3][nBaseIndex][nNode % 3]; nBaseIndex++)
+								lSelect -= m_arlEdges[nNode / 3][nBaseIndex][nNode % 3];
+
+							naLastExit[nNode] = nBaseIndex;
+							nNode = (((((nNode / 3) % 4) * 4) + nBaseIndex) * 3) + (((nNode % 3) + 1) % 3);
+						}
+
+						nNode = nCountNodes;
+
+						while ((!baInTree[nNode]) && (laEdgeTotals[nNode] > 0))
+						{
+							baInTree[nNode] = true;
+							nNode = (((((nNode / 3) % 4) * 4) + naLastExit[nNode]) * 3) + (((nNode % 3) + 1) % 3);
 						}
 					}
 
-					//  If edge choices remain
-					if (!strNextBaseChoice.empty())
+					//  Node exits:  every edge but the last exit, randomly ordered (Fisher-Yates), then the last exit
+					for (nNode = 0; nNode < nNodes; nNode++)
 					{
-						//  Select one of the available edges randomly
-						//  B = random.choice(nextBase)
-						nBaseSelect = int((strNextBaseChoice.length() * rand()) / (RAND_MAX + 1.0));
-
-						//  Concatenate the shuffle
-						//  S2 += B
-						strshuffle += strNextBaseChoice[nBaseSelect];
-
-						//  Decrement edges, identify base index
-						if (strNextBaseChoice[nBaseSelect] == 'a')
-							nBaseIndex = 0;
-						else if (strNextBaseChoice[nBaseSelect] == 'c')
-							nBaseIndex = 1;
-						else if (strNextBaseChoice[nBaseSelect] == 'g')
-							nBaseIndex = 2;
-						else if (strNextBaseChoice[nBaseSelect] == 'u')
-							nBaseIndex = 3;
-
-						//  Decrement edges for the given base choice
-						m_arlEdges[(nSelect1 * 4) + nSelect2][nBaseIndex][nFrame]--;
+						if (laEdgeTotals[nNode] > 0)
+						{
+							vaExits[nNode].reserve(laEdgeTotals[nNode]);
+
+							for (int nCountBases = 0; nCountBases < m_nMaxBases; nCountBases++)
+							{
+								for (long lCountEdges = m_arlEdges[nNode / 3][nCountBases][nNode % 3] - ((nNode != nEndNode) && (naLastExit[nNode] == nCountBases) ? 1 : 0); lCountEdges > 0; lCountEdges--)
+									vaExits[nNode].push_back((uint8_t)nCountBases);
+							}
+
+							for (size_t stCount = vaExits[nNode].size(); stCount > 1; stCount--)
+							{
+								lSelect = (long)GetRandom(stCount);
+
+								untSwap = vaExits[nNode][stCount - 1];
+								vaExits[nNode][stCount - 1] = vaExits[nNode][lSelect];
+								vaExits[nNode][lSelect] = untSwap;
+							}
+
+							if (nNode != nEndNode)
+								vaExits[nNode].push_back((uint8_t)naLastExit[nNode]);
+						}
 					}
-					else
+
+					//  Walk the Eulerian path from the start node, taking each node's exits in order
+					nNode = nStartNode;
+
+					//  for b in range(0, len(S1) - 2) :
+					for (size_t stCountSequence = 0; stCountSequence < vCodes.size() - 2; stCountSequence++)
 					{
-						//  Return empty sequence
-						strshuffle = "";
+						//  If exits remain (always, for a loaded sequence)
+						if (staExit[nNode] < vaExits[nNode].size())
+						{
+							nBaseIndex = vaExits[nNode][staExit[nNode]++];
 
-						break;
+							//  S2 += B
+							strshuffle[stCountSequence + 2] = m_chaShuffleBases[nBaseIndex];
+
+							nNode = (((((nNode / 3) % 4) * 4) + nBaseIndex) * 3) + (((nNode % 3) + 1) % 3);
+						}
+						else
+						{
+							ReportTimeStamp("[GetCodonshuffle]", "ERROR:  Eulerian Path Ended Early [" + ConvertLongToString((long)stCountSequence) + "]");
+
+							//  Return empty sequence
+							strshuffle = "";
+
+							break;
+						}
 					}
 				}
 
@@ -474,7 +650,7 @@ string CBase123_Shuffler::GetCodonshuffle(string& strSequence)
 
 ////////////////////////////////////////////////////////////////////////////////
 //
-//  shuffles a sequence, base by base
+//  shuffles a sequence, base by base (Fisher-Yates, in place on a copy of the sequence)
 //         
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -487,31 +663,27 @@ string CBase123_Shuffler::GetBaseshuffle(string& strSequence)
 {
 	//  shuffled sequence
 	string strshuffle = "";
-	//  Character vector
-	vector<char> vSequence;
 	//  Character selector
-	int nSelect = 0;
+	size_t stSelect = 0;
+	//  Swap character
+	char chrSwap = '\0';
 
 	try
 	{
 		//  If sequence is not empty
 		if (!strSequence.empty())
 		{
-			//  Fill options vector<char>
-			for (int nCount = 0; nCount < strSequence.length(); nCount++)
-				vSequence.push_back(strSequence[nCount]);
-			
-			//  Randomly select characters from the sequence
-			while (vSequence.size() > 0)
-			{
-				//  Select a random base from the options vector
-				nSelect = (int)((vSequence.size() * rand()) / (RAND_MAX + 1.0));
+			//  Copy the sequence (one allocation)
+			strshuffle = strSequence;
 
-				//  Concatenate shuffle
-				strshuffle += vSequence[nSelect];
+			//  Swap each position, last to first, with a random position at or before it
+			for (size_t stCount = strshuffle.length() - 1; stCount > 0; stCount--)
+			{
+				stSelect = (size_t)GetRandom(stCount + 1);
 
-				//  Remove the selected base from the options vector
-				vSequence.erase(vSequence.begin() + nSelect);
+				chrSwap = strshuffle[stCount];
+				strshuffle[stCount] = strshuffle[stSelect];
+				strshuffle[stSelect] = chrSwap;
 			}
 		}
 		else
@@ -521,6 +693,9 @@ string CBase123_Shuffler::GetBaseshuffle(string& strSequence)
 	}
 	catch (exception ex)
 	{
+		//  Make sure to return an empty sequence
+		strshuffle = "";
+
 		cout << "ERROR [GetBaseshuffle] Exception Code:  " << ex.what() << "\n";
 	}
 
@@ -17,11 +17,20 @@
 
 #include "Base123.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 using namespace std;
 
+//  Shuffle default seed (replicates are reproducible, unless a seed is given)
+const uint64_t m_ullShuffleDefaultSeed = 0;
+//  Shuffle stream key hash (FNV-1a, accession)
+const uint64_t m_ullShuffleHashBasis = 14695981039346656037ULL;
+const uint64_t m_ullShuffleHashPrime = 1099511628211ULL;
+//  Shuffle base characters, by 2-bit value (see m_untA, m_untC, m_untG, m_untTU)
+const char m_chaShuffleBases[4] = { 'a', 'c', 'g', 'u' };
+
 class CBase123_Shuffler
 {
 	//  Initialization
@@ -30,6 +39,7 @@ public:
 
 	//  Constructor
 	CBase123_Shuffler();
+	CBase123_Shuffler(uint64_t ullSeed, string strAccession, int nReplicate);
 	//  Destructor
 	virtual ~CBase123_Shuffler();
 
@@ -39,6 +49,7 @@ public:
 
 	string shuffleSequence(string& strSequence, vector<structStartStop>& vStartsStops);
 	double GetBaseSimilarities();
+	bool SeedRandom(uint64_t ullSeed, string strAccession, int nReplicate);
 
 	//  Implementation (private)
 
@@ -49,10 +60,14 @@ private:
 	void ZeroCodonCounts(long(&arlCodonCounts)[4][4][4]);
 	long AnalyzeBaseSimilarites(string& strSequence, string& strshuffle);
 	void AnalyzeOutput(string& strSequence, string& strshuffle);
-	bool LoadEdges(string& strSequence);
+	bool GetBaseCodes(string& strSequence, vector<uint8_t>& vCodes);
+	bool LoadEdges(vector<uint8_t>& vCodes);
 	string GetCodonshuffle(string& strSequence);
 	string GetBaseshuffle(string& strSequence);
 	bool ZeroEdgeCounts();
+	uint64_t GetRandom(uint64_t ullBound);
+
+	static uint64_t GetSplitMix64(uint64_t& ullState);
 
 	//  Max bases
 	int m_nMaxBases;
@@ -66,5 +81,8 @@ private:
 
 	//  Positional base similarities
 	double m_dBaseSimilarities;
+
+	//  Random stream state (xoshiro256**; one stream per shuffler, keyed by seed, accession and replicate)
+	uint64_t m_ullaRandomState[4];
 };
 
@@ -0,0 +1,684 @@
+// Base123_Sketch.cpp : Builds and queries a MinHash sketch index of BIG FA format genomes
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds and queries a MinHash sketch index of BIG FA format genomes; see Base123_Sketch.h for the
+//      index layout
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Base123.h"
+#include "Base123_Utilities.h"
+#include "Base123_Sketch.h"
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <unordered_set>
+#include <omp.h>
+
+//  Sketch index magic
+const char m_chaSketchIndexMagic[8] = { 'B', '1', '2', '3', 'S', 'K', 'I', 'X' };
+//  Sketch index version
+const uint32_t m_untSketchIndexVersion = 1;
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Hashes a 2-bit packed k-mer (64-bit finalizer; uniform over the full 64 bits)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [uint64_t] ullKMer:  packed k-mer
+//                    :  returns hash
+//
+////////////////////////////////////////////////////////////////////////////////
+
+static inline uint64_t HashKMer(uint64_t ullKMer)
+{
+	ullKMer ^= ullKMer >> 33;
+	ullKMer *= 0xFF51AFD7ED558CCDULL;
+	ullKMer ^= ullKMer >> 33;
+	ullKMer *= 0xC4CEB9FE1A85EC53ULL;
+	ullKMer ^= ullKMer >> 33;
+
+	return ullKMer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sketches a sequence; keeps the nSketchSize smallest distinct hashes of its canonical k-mers (the
+//      lesser of each k-mer and its reverse complement); k-mers spanning an unknown base are skipped
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strSequence       :  sequence to sketch
+//  [int] nKMerLength           :  k-mer length [1:32]
+//  [int] nSketchSize           :  sketch size (bottom-k)
+//  [vector<uint64_t>&] vHashes :  sketch hashes to set, ascending
+//                             :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetSequenceSketch(string& strSequence, int nKMerLength, int nSketchSize, vector<uint64_t>& vHashes)
+{
+	//  Forward k-mer
+	uint64_t ullForward = 0;
+	//  Reverse complement k-mer
+	uint64_t ullReverse = 0;
+	//  k-mer mask
+	uint64_t ullMask = 0;
+	//  Reverse complement shift (high base position)
+	int nShift = 0;
+	//  Known bases in the current window
+	int nKnown = 0;
+	//  Bottom-k hashes
+	set<uint64_t> stHashes;
+
+	try
+	{
+		vHashes.clear();
+
+		if ((nKMerLength > 0) && (nKMerLength <= m_nMaxSketchKMerLength) && (nSketchSize > 0))
+		{
+			ullMask = (nKMerLength == 32) ? UINT64_MAX : ((1ULL << (2 * nKMerLength)) - 1);
+			nShift = 2 * (nKMerLength - 1);
+
+			for (size_t ulCount = 0; ulCount < strSequence.length(); ulCount++)
+			{
+				//  Base value
+				uint64_t ullBase = 0;
+
+				switch (strSequence[ulCount])
+				{
+				case 'a': case 'A': ullBase = m_untA; break;
+				case 'c': case 'C': ullBase = m_untC; break;
+				case 'g': case 'G': ullBase = m_untG; break;
+				case 't': case 'T': case 'u': case 'U': ullBase = m_untTU; break;
+				default: nKnown = 0; continue;
+				}
+
+				ullForward = ((ullForward << 2) | ullBase) & ullMask;
+				ullReverse = (ullReverse >> 2) | ((3 - ullBase) << nShift);
+
+				if (++nKnown >= nKMerLength)
+				{
+					//  Canonical k-mer hash
+					uint64_t ullHash = HashKMer(ullForward < ullReverse ? ullForward : ullReverse);
+
+					if ((stHashes.size() < (size_t)nSketchSize) || (ullHash < *stHashes.rbegin()))
+					{
+						if ((stHashes.insert(ullHash).second) && (stHashes.size() > (size_t)nSketchSize))
+							stHashes.erase(prev(stHashes.end()));
+					}
+				}
+			}
+
+			vHashes.assign(stHashes.begin(), stHashes.end());
+
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[GetSequenceSketch]", "ERROR:  k-mer Length Must be [1:" + ConvertIntToString(m_nMaxSketchKMerLength) + "] and Sketch Size Must be Greater Than Zero");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetSequenceSketch] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Estimates the Jaccard similarity of two sketches; of the nSketchSize smallest hashes of their
+//      union, the fraction present in both
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [vector<uint64_t>&] vHashes1:  first sketch, ascending
+//  [vector<uint64_t>&] vHashes2:  second sketch, ascending
+//  [int] nSketchSize           :  sketch size
+//                             :  returns estimated Jaccard similarity [0:1]
+//
+////////////////////////////////////////////////////////////////////////////////
+
+double GetSketchJaccard(vector<uint64_t>& vHashes1, vector<uint64_t>& vHashes2, int nSketchSize)
+{
+	//  Sketch positions
+	size_t ulPosition1 = 0, ulPosition2 = 0;
+	//  Union hashes visited
+	int nUnion = 0;
+	//  Shared hashes visited
+	int nShared = 0;
+
+	while ((nUnion < nSketchSize) && ((ulPosition1 < vHashes1.size()) || (ulPosition2 < vHashes2.size())))
+	{
+		if ((ulPosition2 >= vHashes2.size()) || ((ulPosition1 < vHashes1.size()) && (vHashes1[ulPosition1] < vHashes2[ulPosition2])))
+			ulPosition1++;
+		else if ((ulPosition1 >= vHashes1.size()) || (vHashes2[ulPosition2] < vHashes1[ulPosition1]))
+			ulPosition2++;
+		else
+		{
+			nShared++;
+			ulPosition1++;
+			ulPosition2++;
+		}
+
+		nUnion++;
+	}
+
+	if (nUnion > 0)
+		return (double)nShared / (double)nUnion;
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes a sketch index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strIndexFilePathName        :  index file path name
+//  [int] nKMerLength                    :  k-mer length
+//  [int] nSketchSize                    :  sketch size
+//  [vector<structSketch>&] vSketches    :  sketches to write (empty sketches are skipped)
+//                                      :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool WriteSketchIndex(string strIndexFilePathName, int nKMerLength, int nSketchSize, vector<structSketch>& vSketches)
+{
+	//  Index file
+	ofstream oFile;
+	//  Header values
+	uint32_t untKMerLength = (uint32_t)nKMerLength, untSketchSize = (uint32_t)nSketchSize, untCount = 0;
+
+	try
+	{
+		if (!strIndexFilePathName.empty())
+		{
+			for (size_t ulCount = 0; ulCount < vSketches.size(); ulCount++)
+			{
+				if (!vSketches[ulCount].vHashes.empty())
+					untCount++;
+			}
+
+			oFile.open(strIndexFilePathName.c_str(), ios::out | ios::trunc | ios::binary);
+
+			if (oFile.is_open())
+			{
+				oFile.write(m_chaSketchIndexMagic, sizeof(m_chaSketchIndexMagic));
+				oFile.write((const char*)&m_untSketchIndexVersion, sizeof(uint32_t));
+				oFile.write((const char*)&untKMerLength, sizeof(uint32_t));
+				oFile.write((const char*)&untSketchSize, sizeof(uint32_t));
+				oFile.write((const char*)&untCount, sizeof(uint32_t));
+
+				for (size_t ulCount = 0; ulCount < vSketches.size(); ulCount++)
+				{
+					//  Field lengths
+					uint32_t untAccessionLength = (uint32_t)vSketches[ulCount].strAccession.length();
+					uint32_t untPathLength = (uint32_t)vSketches[ulCount].strFilePathName.length();
+					uint32_t untHashCount = (uint32_t)vSketches[ulCount].vHashes.size();
+
+					if (untHashCount == 0)
+						continue;
+
+					oFile.write((const char*)&untAccessionLength, sizeof(uint32_t));
+					oFile.write(vSketches[ulCount].strAccession.c_str(), untAccessionLength);
+					oFile.write((const char*)&untPathLength, sizeof(uint32_t));
+					oFile.write(vSketches[ulCount].strFilePathName.c_str(), untPathLength);
+					oFile.write((const char*)&vSketches[ulCount].ullLength, sizeof(uint64_t));
+					oFile.write((const char*)&untHashCount, sizeof(uint32_t));
+					oFile.write((const char*)&vSketches[ulCount].vHashes[0], sizeof(uint64_t) * untHashCount);
+				}
+
+				//  Write status
+				bool bWritten = oFile.good();
+
+				oFile.close();
+
+				if (bWritten)
+					return true;
+				else
+				{
+					ReportTimeStamp("[WriteSketchIndex]", "ERROR:  Sketch Index [" + strIndexFilePathName + "] Write Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[WriteSketchIndex]", "ERROR:  Sketch Index [" + strIndexFilePathName + "] Create/Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[WriteSketchIndex]", "ERROR:  Sketch Index File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteSketchIndex] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reads a sketch index
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strIndexFilePathName        :  index file path name
+//  [int&] nKMerLength                   :  k-mer length to set
+//  [int&] nSketchSize                   :  sketch size to set
+//  [vector<structSketch>&] vSketches    :  sketches to set
+//                                      :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReadSketchIndex(string strIndexFilePathName, int& nKMerLength, int& nSketchSize, vector<structSketch>& vSketches)
+{
+	//  Index file
+	ifstream iFile;
+	//  Magic
+	char chaMagic[8];
+	//  Header values
+	uint32_t untVersion = 0, untKMerLength = 0, untSketchSize = 0, untCount = 0;
+
+	try
+	{
+		if (!strIndexFilePathName.empty())
+		{
+			iFile.open(strIndexFilePathName.c_str(), ios::in | ios::binary);
+
+			if (iFile.is_open())
+			{
+				iFile.read(chaMagic, sizeof(chaMagic));
+				iFile.read((char*)&untVersion, sizeof(uint32_t));
+				iFile.read((char*)&untKMerLength, sizeof(uint32_t));
+				iFile.read((char*)&untSketchSize, sizeof(uint32_t));
+				iFile.read((char*)&untCount, sizeof(uint32_t));
+
+				if ((iFile.good()) && (string(chaMagic, sizeof(chaMagic)) == string(m_chaSketchIndexMagic, sizeof(m_chaSketchIndexMagic))) && (untVersion == m_untSketchIndexVersion))
+				{
+					nKMerLength = (int)untKMerLength;
+					nSketchSize = (int)untSketchSize;
+					vSketches.resize(untCount);
+
+					for (uint32_t untEntry = 0; untEntry < untCount; untEntry++)
+					{
+						//  Field lengths
+						uint32_t untAccessionLength = 0, untPathLength = 0, untHashCount = 0;
+
+						iFile.read((char*)&untAccessionLength, sizeof(uint32_t));
+						vSketches[untEntry].strAccession.resize(untAccessionLength);
+						if (untAccessionLength > 0)
+							iFile.read(&vSketches[untEntry].strAccession[0], untAccessionLength);
+						iFile.read((char*)&untPathLength, sizeof(uint32_t));
+						vSketches[untEntry].strFilePathName.resize(untPathLength);
+						if (untPathLength > 0)
+							iFile.read(&vSketches[untEntry].strFilePathName[0], untPathLength);
+						iFile.read((char*)&vSketches[untEntry].ullLength, sizeof(uint64_t));
+						iFile.read((char*)&untHashCount, sizeof(uint32_t));
+						vSketches[untEntry].vHashes.resize(untHashCount);
+						if (untHashCount > 0)
+							iFile.read((char*)&vSketches[untEntry].vHashes[0], sizeof(uint64_t) * untHashCount);
+
+						if (!iFile.good())
+						{
+							ReportTimeStamp("[ReadSketchIndex]", "ERROR:  Sketch Index [" + strIndexFilePathName + "] is Truncated");
+
+							return false;
+						}
+					}
+
+					iFile.close();
+
+					return true;
+				}
+				else
+				{
+					ReportTimeStamp("[ReadSketchIndex]", "ERROR:  Sketch Index [" + strIndexFilePathName + "] Header is Not Properly Formatted");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ReadSketchIndex]", "ERROR:  Sketch Index [" + strIndexFilePathName + "] Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ReadSketchIndex]", "ERROR:  Sketch Index File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReadSketchIndex] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Sketches a BIG FA format file
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName     :  listed file path name (stored in the sketch)
+//  [string] strWorkingFilePathName:  working (transformed) file path name to read
+//  [int] nKMerLength            :  k-mer length
+//  [int] nSketchSize            :  sketch size
+//  [structSketch&] stSketch     :  sketch to set
+//  [string&] strErrorEntry      :  error entry to set
+//                              :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+static bool SketchFAFile(string strFilePathName, string strWorkingFilePathName, int nKMerLength, int nSketchSize, structSketch& stSketch, string& strErrorEntry)
+{
+	//  File text
+	string strFileText = "";
+	//  Sequence
+	string strSequence = "";
+
+	if (!GetFileText(strWorkingFilePathName, strFileText))
+		strErrorEntry = strWorkingFilePathName + "~File Open Failed\n";
+	else if ((stSketch.strAccession = GetAccessionFromFileHeader(strFileText)).empty())
+		strErrorEntry = strWorkingFilePathName + "~Empty Accession\n";
+	else if ((strSequence = GetSequenceFromFAFile(strFileText)).empty())
+		strErrorEntry = strWorkingFilePathName + "~Empty Sequence\n";
+	else if (!GetSequenceSketch(strSequence, nKMerLength, nSketchSize, stSketch.vHashes))
+		strErrorEntry = strWorkingFilePathName + "~Sketch Failed\n";
+	else
+	{
+		stSketch.strFilePathName = strFilePathName;
+		stSketch.ullLength = strSequence.length();
+
+		return true;
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds a sketch index of a BIG FA format file list, in parallel
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strInputFilePathNameList     :  input file path name list (BIG .fa format)
+//  [string] strInputFilePathNameTransform:  input file path name transform (includes string replacements, see help)
+//  [int] nKMerLength                     :  k-mer length [1:32]
+//  [int] nSketchSize                     :  sketch size (bottom-k)
+//  [string] strIndexFilePathName         :  index file path name
+//  [string] strErrorFilePathName         :  error file path name
+//  [int] nMaxProcs                       :  maximum processors for openMP
+//                                       :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ListBuildSketchIndex(string strInputFilePathNameList, string strInputFilePathNameTransform, int nKMerLength, int nSketchSize, string strIndexFilePathName, string strErrorFilePathName, int nMaxProcs)
+{
+	//  List file text
+	string strInputListFileText = "";
+	//  File path names
+	vector<string> vFilePathNames;
+	//  Sketches
+	vector<structSketch> vSketches;
+	//  Error entries
+	vector<string> vErrorEntries;
+	//  Error file text
+	string strErrorFileText = "";
+	//  Sketched entry count
+	long lSketched = 0;
+
+	try
+	{
+		if ((nKMerLength > 0) && (nKMerLength <= m_nMaxSketchKMerLength) && (nSketchSize > 0))
+		{
+			//  Get list file text
+			if (GetFileText(strInputFilePathNameList, strInputListFileText))
+			{
+				//  Split file text into file list
+				SplitString(strInputListFileText, '\n', vFilePathNames);
+
+				vSketches.resize(vFilePathNames.size());
+				vErrorEntries.resize(vFilePathNames.size());
+
+				//  Declare team size
+				#pragma omp parallel for schedule(dynamic) num_threads(nMaxProcs)
+				for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+				{
+					//  Working file path name
+					string strWorkingFilePathName = vFilePathNames[lCount];
+
+					//  If input file path name transform is not empty
+					if (!strInputFilePathNameTransform.empty())
+						strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
+
+					SketchFAFile(vFilePathNames[lCount], strWorkingFilePathName, nKMerLength, nSketchSize, vSketches[lCount], vErrorEntries[lCount]);
+				}
+
+				//  Concatenate error file text
+				for (long lCount = 0; lCount < vErrorEntries.size(); lCount++)
+				{
+					if (vErrorEntries[lCount].empty())
+						lSketched++;
+					else
+						strErrorFileText += vErrorEntries[lCount];
+				}
+
+				ReportTimeStamp("[ListBuildSketchIndex]", "NOTE:  Sketched Entries = " + ConvertLongToString(lSketched) + " of " + ConvertLongToString((long)vFilePathNames.size()));
+
+				//  If error file path name is not empty
+				if (!strErrorFilePathName.empty())
+				{
+					strErrorFileText = "File Path Name~Error\n" + strErrorFileText;
+
+					if (!WriteFileText(strErrorFilePathName, strErrorFileText))
+						ReportTimeStamp("[ListBuildSketchIndex]", "ERROR:  Error File [" + strErrorFilePathName + "] Write Failed");
+				}
+
+				return WriteSketchIndex(strIndexFilePathName, nKMerLength, nSketchSize, vSketches);
+			}
+			else
+			{
+				ReportTimeStamp("[ListBuildSketchIndex]", "ERROR:  Input List File [" + strInputFilePathNameList + "] Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ListBuildSketchIndex]", "ERROR:  k-mer Length Must be [1:" + ConvertIntToString(m_nMaxSketchKMerLength) + "] and Sketch Size Must be Greater Than Zero");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ListBuildSketchIndex] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Queries a sketch index with each genome of a BIG FA format file list, in parallel; ranks the
+//      index genomes (the foreground's own accession excluded) by estimated Jaccard similarity and
+//      writes a table, a background list per foreground (<base>_<accession>.txt), and the union
+//      of all listed backgrounds (<base>_union.txt)
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strIndexFilePathName             :  index file path name
+//  [string] strInputFilePathNameList         :  foreground file path name list (BIG .fa format)
+//  [string] strInputFilePathNameTransform    :  input file path name transform (includes string replacements, see help)
+//  [int] nTopCount                           :  nearest genomes to list per foreground
+//  [string] strOutputTableFilePathName       :  output table file path name
+//  [string] strBackgroundListFilePathBaseName:  background list file path base name; if empty, no lists are written
+//  [string] strErrorFilePathName             :  error file path name
+//  [int] nMaxProcs                           :  maximum processors for openMP
+//                                           :  returns true, if successful; else, false
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool ListQuerySketchIndex(string strIndexFilePathName, string strInputFilePathNameList, string strInputFilePathNameTransform, int nTopCount, string strOutputTableFilePathName,
+	string strBackgroundListFilePathBaseName, string strErrorFilePathName, int nMaxProcs)
+{
+	//  Index k-mer length
+	int nKMerLength = 0;
+	//  Index sketch size
+	int nSketchSize = 0;
+	//  Index sketches
+	vector<structSketch> vIndex;
+	//  List file text
+	string strInputListFileText = "";
+	//  File path names
+	vector<string> vFilePathNames;
+	//  Foreground sketches
+	vector<structSketch> vSketches;
+	//  Nearest index entries, by foreground
+	vector<vector<pair<double, long>>> vNearest;
+	//  Error entries
+	vector<string> vErrorEntries;
+	//  Output table file text
+	string strOutputTableFileText = "";
+	//  Error file text
+	string strErrorFileText = "";
+	//  Union background list file text
+	string strUnionListFileText = "";
+	//  Index entries in the union list
+	unordered_set<long> usUnion;
+
+	try
+	{
+		if (nTopCount > 0)
+		{
+			//  Read index
+			if (ReadSketchIndex(strIndexFilePathName, nKMerLength, nSketchSize, vIndex))
+			{
+				//  Get list file text
+				if (GetFileText(strInputFilePathNameList, strInputListFileText))
+				{
+					//  Split file text into file list
+					SplitString(strInputListFileText, '\n', vFilePathNames);
+
+					vSketches.resize(vFilePathNames.size());
+					vNearest.resize(vFilePathNames.size());
+					vErrorEntries.resize(vFilePathNames.size());
+
+					//  Declare team size
+					#pragma omp parallel for schedule(dynamic) num_threads(nMaxProcs)
+					for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+					{
+						//  Working file path name
+						string strWorkingFilePathName = vFilePathNames[lCount];
+						//  Candidates (similarity, index entry)
+						vector<pair<double, long>> vCandidates;
+
+						//  If input file path name transform is not empty
+						if (!strInputFilePathNameTransform.empty())
+							strWorkingFilePathName = TransformFilePathName(vFilePathNames[lCount], strInputFilePathNameTransform, "");
+
+						if (SketchFAFile(vFilePathNames[lCount], strWorkingFilePathName, nKMerLength, nSketchSize, vSketches[lCount], vErrorEntries[lCount]))
+						{
+							for (long lEntry = 0; lEntry < vIndex.size(); lEntry++)
+							{
+								if (vIndex[lEntry].strAccession != vSketches[lCount].strAccession)
+									vCandidates.push_back(make_pair(GetSketchJaccard(vSketches[lCount].vHashes, vIndex[lEntry].vHashes, nSketchSize), lEntry));
+							}
+
+							//  Rank by similarity (descending), then index order
+							if (vCandidates.size() > (size_t)nTopCount)
+							{
+								partial_sort(vCandidates.begin(), vCandidates.begin() + nTopCount, vCandidates.end(),
+									[](const pair<double, long>& p1, const pair<double, long>& p2) { return (p1.first > p2.first) || ((p1.first == p2.first) && (p1.second < p2.second)); });
+								vCandidates.resize(nTopCount);
+							}
+							else
+							{
+								sort(vCandidates.begin(), vCandidates.end(),
+									[](const pair<double, long>& p1, const pair<double, long>& p2) { return (p1.first > p2.first) || ((p1.first == p2.first) && (p1.second < p2.second)); });
+							}
+
+							vNearest[lCount].swap(vCandidates);
+						}
+					}
+
+					//  Compile table and background lists
+					strOutputTableFileText = "Foreground Accession~Rank~Background Accession~Estimated Jaccard~Background Length~Background File Path Name\n";
+
+					for (long lCount = 0; lCount < vFilePathNames.size(); lCount++)
+					{
+						//  Background list file text
+						string strListFileText = "";
+
+						strErrorFileText += vErrorEntries[lCount];
+
+						if (vSketches[lCount].vHashes.empty())
+							continue;
+
+						for (long lRank = 0; lRank < vNearest[lCount].size(); lRank++)
+						{
+							//  Index entry
+							structSketch& stEntry = vIndex[vNearest[lCount][lRank].second];
+
+							strOutputTableFileText += vSketches[lCount].strAccession + "~" + ConvertLongToString(lRank + 1) + "~" + stEntry.strAccession + "~" + ConvertDoubleToString(vNearest[lCount][lRank].first) + "~" + ConvertLongToString((long)stEntry.ullLength) + "~" + stEntry.strFilePathName + "\n";
+							strListFileText += stEntry.strFilePathName + "\n";
+
+							if (usUnion.insert(vNearest[lCount][lRank].second).second)
+								strUnionListFileText += stEntry.strFilePathName + "\n";
+						}
+
+						if ((!strBackgroundListFilePathBaseName.empty()) && (!WriteFileText(strBackgroundListFilePathBaseName + "_" + vSketches[lCount].strAccession + ".txt", strListFileText)))
+							ReportTimeStamp("[ListQuerySketchIndex]", "ERROR:  Background List [" + strBackgroundListFilePathBaseName + "_" + vSketches[lCount].strAccession + ".txt] Write Failed");
+					}
+
+					if ((!strBackgroundListFilePathBaseName.empty()) && (!WriteFileText(strBackgroundListFilePathBaseName + "_union.txt", strUnionListFileText)))
+						ReportTimeStamp("[ListQuerySketchIndex]", "ERROR:  Background List [" + strBackgroundListFilePathBaseName + "_union.txt] Write Failed");
+
+					//  If error file path name is not empty
+					if (!strErrorFilePathName.empty())
+					{
+						strErrorFileText = "File Path Name~Error\n" + strErrorFileText;
+
+						if (!WriteFileText(strErrorFilePathName, strErrorFileText))
+							ReportTimeStamp("[ListQuerySketchIndex]", "ERROR:  Error File [" + strErrorFilePathName + "] Write Failed");
+					}
+
+					//  Write the table
+					if (WriteFileText(strOutputTableFilePathName, strOutputTableFileText))
+						return true;
+					else
+					{
+						ReportTimeStamp("[ListQuerySketchIndex]", "ERROR:  Output Table [" + strOutputTableFilePathName + "] Write Failed");
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ListQuerySketchIndex]", "ERROR:  Input List File [" + strInputFilePathNameList + "] Open Failed");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ListQuerySketchIndex]", "ERROR:  Sketch Index [" + strIndexFilePathName + "] Read Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ListQuerySketchIndex]", "ERROR:  Nearest Genome Count Must be Greater Than Zero");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ListQuerySketchIndex] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
@@ -0,0 +1,50 @@
+// Base123_Sketch.h : Builds and queries a MinHash sketch index of BIG FA format genomes
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Builds and queries a MinHash sketch index of BIG FA format genomes (header); each genome is reduced
+//      to the bottom-k hashes of its canonical (strand-independent) 2-bit k-mers, so the Jaccard
+//      similarity of any two genomes is estimated from their sketches alone; a query ranks the index
+//      against each foreground genome and writes per-foreground background lists; index layout:
+//
+//      "B123SKIX" (8 bytes), version (uint32), k-mer length (uint32), sketch size (uint32), entry
+//      count (uint32), then per entry:  accession length (uint32), accession bytes, file path name
+//      length (uint32), file path name bytes, sequence length (uint64), hash count (uint32), hashes
+//      (uint64, ascending)
+//
+//  Developed by Stephen Donald Huff, PhD (Stephen.Huff.3@us.af.mil)
+//  Biological Informatics Group, RHDJ, 711HPW, United States Air Force Research Laboratory
+//  (All Rights Reserved)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+//  Maximum sketch k-mer length (2-bit packed in 64 bits)
+const int m_nMaxSketchKMerLength = 32;
+
+//  Sketch structure, one genome
+struct structSketch
+{
+	//  Accession
+	string strAccession;
+	//  File path name (as listed)
+	string strFilePathName;
+	//  Sequence length
+	uint64_t ullLength;
+	//  Bottom-k hashes, ascending
+	vector<uint64_t> vHashes;
+};
+
+bool GetSequenceSketch(string& strSequence, int nKMerLength, int nSketchSize, vector<uint64_t>& vHashes);
+double GetSketchJaccard(vector<uint64_t>& vHashes1, vector<uint64_t>& vHashes2, int nSketchSize);
+bool WriteSketchIndex(string strIndexFilePathName, int nKMerLength, int nSketchSize, vector<structSketch>& vSketches);
+bool ReadSketchIndex(string strIndexFilePathName, int& nKMerLength, int& nSketchSize, vector<structSketch>& vSketches);
+bool ListBuildSketchIndex(string strInputFilePathNameList, string strInputFilePathNameTransform, int nKMerLength, int nSketchSize, string strIndexFilePathName, string strErrorFilePathName, int nMaxProcs);
+bool ListQuerySketchIndex(string strIndexFilePathName, string strInputFilePathNameList, string strInputFilePathNameTransform, int nTopCount, string strOutputTableFilePathName, string strBackgroundListFilePathBaseName, string strErrorFilePathName, int nMaxProcs);
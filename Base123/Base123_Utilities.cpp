@@ -30,6 +30,7 @@
 
 #ifdef _WIN64
 	#include <direct.h>
+	#include <io.h>
 #else
 	#include <unistd.h>
 	#include <limits.h>
@@ -202,6 +203,67 @@ bool GetFileText(string strFilePathName, string& strFileText)
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the first line of a text file (e.g., a .fa header) without reading the whole file;
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName:  file path name of the file to read;
+//                                      NOTE:  strips carriage-return characters
+//  [string] strFirstLine   :  first line to fill
+//                         :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool GetFileFirstLine(string strFilePathName, string& strFirstLine)
+{
+	//  The input file
+	ifstream iFile;
+
+	try
+	{
+		//  Reset first line
+		strFirstLine = "";
+
+		//  If the file path name is not empty, then open the file
+		if (!strFilePathName.empty())
+		{
+			//  Open the file
+			iFile.open(strFilePathName.c_str(), ios::in);
+
+			//  If the file is open, then read the first line
+			if (iFile.is_open())
+			{
+				getline(iFile, strFirstLine);
+
+				//  Strip carriage-return chracter
+				if ((!strFirstLine.empty()) && (strFirstLine[strFirstLine.length() - 1] == '\r'))
+					strFirstLine.erase(strFirstLine.length() - 1);
+
+				//  Close the file
+				iFile.close();
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[GetFileFirstLine]", "ERROR:  Input File [" + strFilePathName + "] Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[GetFileFirstLine]", "ERROR:  Input File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFileFirstLine] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Writes a string to a text file;
@@ -267,6 +329,71 @@ bool WriteFileText(string strFilePathName, string& strFileText)
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Appends a string to a text file and flushes it to disk; creates the file, if absent;
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strFilePathName:  file path name of the file to append;
+//  [string] strFileText    :  text to append;
+//                         :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool AppendFileText(string strFilePathName, string& strFileText)
+{
+	//  The output file
+	ofstream oFile;
+
+	try
+	{
+		//  If the file path name is not empty, then open the file
+		if (!strFilePathName.empty())
+		{
+			//  Open the file
+			oFile.open(strFilePathName.c_str(), ios::out | ios::app);
+
+			//  If the file is open, then append to the file
+			if (oFile.is_open())
+			{
+				//  Append to the file, flush so the text survives an interrupted run
+				oFile.write(strFileText.c_str(), sizeof(char)*strFileText.length());
+				oFile.flush();
+
+				#ifdef _WIN64
+				#else
+
+					//  Set the umask
+					umask(0007);
+
+					chmod(strFilePathName.c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+
+				#endif
+
+				//  Close the file
+				oFile.close();
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[AppendFileText]", "ERROR:  Output File [" + strFilePathName + "] Create/Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[AppendFileText]", "ERROR:  Output File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [AppendFileText] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Creates the requested folder path
@@ -384,6 +511,9 @@ bool IsFilePresent(string strInputFilePathName)
 		if (!strInputFilePathName.empty())
 		{
 			#ifdef _WIN64
+				//  If file exists
+				if (_access(strInputFilePathName.c_str(), 0) == 0)
+					return true;
 			#else
 				//  If file exists
 				if (access(strInputFilePathName.c_str(), 0) == 0)
@@ -797,7 +927,7 @@ double ScoreFDistanceMutationString(string& strMutationCount, long& lTotalCount)
 //
 //  [string&] strAccession       :  sequence accession
 //  [string&] strForwardOutput   :  forawrd F-Distance mutation
-//  [string&] strReverseOutput   :  reverse F-Distance mutation scores
+//  [string&] strReverseOutput   :  reverse F-Distance mutation scores (reading frame delimiters are skipped)
 //  [string&] strOutputTableEntry:  output table file text
 //  [bool] bForContabulation     :  if true, compilation is for contabulation output; else, compilation is for stand-alone output
 //  [bool] bAppendOnly           :  if true, append only the score to the table entry text; else, set entire table entry text
@@ -820,6 +950,28 @@ bool CompileFDistanceTableOutput(string& strAccession, string& strForwardOutput,
 
 	try
 	{
+		//  Translated outputs delimit reading frames, compile the mutation counts only
+		if ((strForwardOutput.find(m_chFDistanceFrameDelimiter) != string::npos) || (strReverseOutput.find(m_chFDistanceFrameDelimiter) != string::npos))
+		{
+			//  Forward mutation counts
+			string strForwardCounts = "";
+			//  Reverse mutation counts
+			string strReverseCounts = "";
+
+			for (long lCount = 0; lCount < strForwardOutput.length(); lCount++)
+			{
+				if (strForwardOutput[lCount] != m_chFDistanceFrameDelimiter)
+					strForwardCounts += strForwardOutput[lCount];
+			}
+			for (long lCount = 0; lCount < strReverseOutput.length(); lCount++)
+			{
+				if (strReverseOutput[lCount] != m_chFDistanceFrameDelimiter)
+					strReverseCounts += strReverseOutput[lCount];
+			}
+
+			return CompileFDistanceTableOutput(strAccession, strForwardCounts, strReverseCounts, strOutputTableEntry, bForContabulation, bAppendOnly);
+		}
+
 		//  If accession is not empty
 		if (!strAccession.empty())
 		{
@@ -882,6 +1034,518 @@ bool CompileFDistanceTableOutput(string& strAccession, string& strForwardOutput,
 	return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the F-Distance (.fdist) output file path name for an input file path name
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strInputFilePathName   :  input (.fa) file path name
+//  [string&] strOutputFileNameSuffix:  output file name suffix; may be empty
+//                                  :  returns output file path name, if successful; else, empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string GetFDistanceOutputFilePathName(string& strInputFilePathName, string& strOutputFileNameSuffix)
+{
+	//  Output file path name
+	string strOutputFilePathName = "";
+	//  Path delimiter
+	char chrPathDelimiter = strPathDelimiter;
+
+	try
+	{
+		//  If input file path name is not empty
+		if (!strInputFilePathName.empty())
+		{
+			//  Get base path name and concatenate output file path name
+			if (!strOutputFileNameSuffix.empty())
+				strOutputFilePathName = GetBasePath(strInputFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(strInputFilePathName) + "." + strOutputFileNameSuffix + ".fdist";
+			else
+				strOutputFilePathName = GetBasePath(strInputFilePathName) + chrPathDelimiter + GetFileNameExceptLastExtension(strInputFilePathName) + ".fdist";
+		}
+		else
+		{
+			ReportTimeStamp("[GetFDistanceOutputFilePathName]", "ERROR:  Input File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFDistanceOutputFilePathName] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strOutputFilePathName;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reads an F-Distance resume journal; each journal line is formatted as
+//      <input file path name>|<F-Distance table entry>; the rank journals of a distributed pass
+//      (<journal file path name>.<rank>, see GetRankFilePathNameMPI()) are merged after the journal
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string] strJournalFilePathName                    :  journal file path name
+//  [unordered_map<string, string>&] umJournalEntries:  table entries keyed by input file path name, to fill
+//                                                    :  returns true, if successful (or journal is absent); else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReadFDistanceJournal(string strJournalFilePathName, unordered_map<string, string>& umJournalEntries)
+{
+	//  Journal file text
+	string strJournalFileText = "";
+	//  Journal lines
+	vector<string> vJournalLines;
+	//  Delimiter position
+	size_t sztDelimiter = 0;
+	//  Journal file path names to merge
+	vector<string> vJournalFilePathNames;
+
+	try
+	{
+		//  Clear journal entries
+		umJournalEntries.clear();
+
+		//  If journal file path name is not empty
+		if (!strJournalFilePathName.empty())
+		{
+			//  Journal, then rank journals (every rank creates its journal, so ranks are contiguous)
+			if (IsFilePresent(strJournalFilePathName))
+				vJournalFilePathNames.push_back(strJournalFilePathName);
+			for (int nRank = 0; IsFilePresent(strJournalFilePathName + "." + ConvertIntToString(nRank)); nRank++)
+				vJournalFilePathNames.push_back(strJournalFilePathName + "." + ConvertIntToString(nRank));
+
+			//  Iterate journals
+			for (int nCountFile = 0; nCountFile < vJournalFilePathNames.size(); nCountFile++)
+			{
+				//  Get journal file text
+				if (GetFileText(vJournalFilePathNames[nCountFile], strJournalFileText))
+				{
+					//  Split journal lines
+					SplitString(strJournalFileText, '\n', vJournalLines);
+
+					//  Iterate journal lines, last entry for a given input wins
+					for (long lCount = 0; lCount < vJournalLines.size(); lCount++)
+					{
+						//  Table entries never contain '|', so split at the last one
+						sztDelimiter = vJournalLines[lCount].rfind('|');
+
+						//  Skip truncated lines (interrupted append)
+						if ((sztDelimiter != string::npos) && (sztDelimiter > 0) && (sztDelimiter < vJournalLines[lCount].length() - 1))
+							umJournalEntries[vJournalLines[lCount].substr(0, sztDelimiter)] = vJournalLines[lCount].substr(sztDelimiter + 1);
+					}
+				}
+				else
+				{
+					ReportTimeStamp("[ReadFDistanceJournal]", "ERROR:  Journal File [" + vJournalFilePathNames[nCountFile] + "] Open Failed");
+
+					return false;
+				}
+			}
+
+			//  No journal yet, nothing to resume
+			return true;
+		}
+		else
+		{
+			ReportTimeStamp("[ReadFDistanceJournal]", "ERROR:  Journal File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReadFDistanceJournal] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Validates an existing F-Distance (.fdist) output file against its journal table entry;
+//      the file must hold only mutation count digits (and reading frame delimiters), the line
+//      count the engine writes, and must recompile to the identical table entry
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strOutputFilePathName:  F-Distance (.fdist) output file path name
+//  [string&] strJournalEntry      :  F-Distance table entry recorded in the journal
+//  [int] nLineCount               :  output line count (1, forward only; 2, forward and reverse)
+//                                :  returns true, if output is valid; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ValidateFDistanceOutput(string& strOutputFilePathName, string& strJournalEntry, int nLineCount)
+{
+	//  Output file text
+	string strOutputFileText = "";
+	//  Output lines
+	vector<string> vOutputLines;
+	//  Accession
+	string strAccession = "";
+	//  Forward output
+	string strForwardOutput = "";
+	//  Reverse output
+	string strReverseOutput = "";
+	//  Recompiled table entry
+	string strTableEntry = "";
+
+	try
+	{
+		//  If output file path name and journal entry are not empty
+		if ((!strOutputFilePathName.empty()) && (!strJournalEntry.empty()))
+		{
+			//  If output file is present, get its text
+			if ((IsFilePresent(strOutputFilePathName)) && (GetFileText(strOutputFilePathName, strOutputFileText)))
+			{
+				//  Split forward/reverse lines
+				SplitString(strOutputFileText, '\n', vOutputLines);
+
+				//  Line count must match the written output
+				if ((vOutputLines.size() == nLineCount) && ((nLineCount == 1) || (nLineCount == 2)))
+				{
+					//  Lines must contain mutation counts only
+					for (int nCount = 0; nCount < vOutputLines.size(); nCount++)
+					{
+						if (vOutputLines[nCount].find_first_not_of(string("0123456789") + m_chFDistanceFrameDelimiter) != string::npos)
+							return false;
+					}
+
+					//  Accession is the first table entry field
+					strAccession = strJournalEntry.substr(0, strJournalEntry.find('~'));
+					strForwardOutput = vOutputLines[0];
+					if (nLineCount == 2)
+						strReverseOutput = vOutputLines[1];
+
+					//  Recompile and compare
+					if (CompileFDistanceTableOutput(strAccession, strForwardOutput, strReverseOutput, strTableEntry, false, false))
+						return (strTableEntry == strJournalEntry);
+				}
+			}
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ValidateFDistanceOutput] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Reads the forward (and reverse) mutation counts of an F-Distance output (.fdist) file
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strOutputFilePathName:  F-Distance output file path name
+//  [string&] strForwardOutput     :  forward mutation counts
+//  [string&] strReverseOutput     :  reverse mutation counts (empty, if unidirectional)
+//                                :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReadFDistanceOutput(string& strOutputFilePathName, string& strForwardOutput, string& strReverseOutput)
+{
+	//  Output file text
+	string strOutputFileText = "";
+	//  Output lines
+	vector<string> vOutputLines;
+
+	try
+	{
+		//  If output file path name is not empty
+		if (!strOutputFilePathName.empty())
+		{
+			//  Get output file text
+			if (GetFileText(strOutputFilePathName, strOutputFileText))
+			{
+				//  Split forward/reverse lines
+				SplitString(strOutputFileText, '\n', vOutputLines);
+
+				if ((vOutputLines.size() == 1) || (vOutputLines.size() == 2))
+				{
+					strForwardOutput = vOutputLines[0];
+					strReverseOutput = (vOutputLines.size() == 2) ? vOutputLines[1] : "";
+
+					return true;
+				}
+				else
+				{
+					ReportTimeStamp("[ReadFDistanceOutput]", "ERROR:  F-Distance Output File [" + strOutputFilePathName + "] is Not Properly Formatted");
+				}
+			}
+			else
+			{
+				ReportTimeStamp("[ReadFDistanceOutput]", "ERROR:  F-Distance Output File [" + strOutputFilePathName + "] Open Failed");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[ReadFDistanceOutput]", "ERROR:  F-Distance Output File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [ReadFDistanceOutput] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Gets the F-Distance CDS table header
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  :  returns CDS table header, if successful; else, empty string
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+string GetFDistanceCDSTableHeader()
+{
+	//  Header to return
+	string strHeader = "";
+
+	try
+	{
+		strHeader += "Accession~Segment~Name~Complement~Start~Stop~nMer Count~Forward Mutation Total~Forward F-Distance Score~Reverse Mutation Total~Reverse F-Distance Score\n";
+
+		return strHeader;
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [GetFDistanceCDSTableHeader] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return strHeader;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Compiles the F-Distance CDS table entries of one sequence; mutation counts are aggregated into
+//      each CDS and each inter-CDS segment by a sweep over the CDSs sorted by start; an nMer belongs
+//      to a segment if it starts (leftmost forward base) within it; reverse counts are reindexed to
+//      forward coordinates (reverse count j is the nMer starting at forward position length - nMer - j,
+//      0-based), so both directions aggregate over the same bases; each score is the total over the
+//      nMers actually counted in that direction
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strAccession       :  sequence accession
+//  [string&] strForwardOutput   :  forward F-Distance mutation counts
+//  [string&] strReverseOutput   :  reverse F-Distance mutation counts (may be empty)
+//  [long] lSequenceLength       :  sequence length
+//  [int] nNMerLength            :  nMer length
+//  [vector<structCDS>&] vCDSs   :  CDS collection of the sequence (1-based, inclusive coordinates)
+//  [string&] strCDSTableEntries :  CDS table entries to set ('\n' delimited, no trailing line feed)
+//                              :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool CompileFDistanceCDSTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, long lSequenceLength, int nNMerLength, vector<structCDS>& vCDSs, string& strCDSTableEntries)
+{
+	//  nMer position count
+	long lPositions = 0;
+	//  Forward prefix sums
+	vector<long> vForwardSums;
+	//  Reverse prefix sums, forward coordinates
+	vector<long> vReverseSums;
+	//  Forward counted nMer prefix sums
+	vector<long> vForwardCounts;
+	//  Reverse counted nMer prefix sums, forward coordinates
+	vector<long> vReverseCounts;
+	//  CDS indices, sorted by start
+	vector<long> vSorted;
+	//  Last position covered by a CDS, 1-based
+	long lCovered = 0;
+	//  Inter-CDS segment count
+	long lInterCount = 0;
+
+	try
+	{
+		//  If accession is not empty
+		if (!strAccession.empty())
+		{
+			//  If mutation counts are set
+			if ((!strForwardOutput.empty()) || (!strReverseOutput.empty()))
+			{
+				//  nMer start positions of the sequence
+				lPositions = lSequenceLength - nNMerLength + 1;
+				if (lPositions < 1)
+				{
+					ReportTimeStamp("[CompileFDistanceCDSTableOutput]", "ERROR:  Sequence Length [" + ConvertLongToString(lSequenceLength) + "] is Less Than nMer Length [" + ConvertIntToString(nNMerLength) + "]");
+
+					return false;
+				}
+
+				//  Counts and counted nMers by position, then prefix sums, position p (1-based) sums [1, p]
+				vForwardSums.resize(lPositions + 1, 0);
+				vReverseSums.resize(lPositions + 1, 0);
+				vForwardCounts.resize(lPositions + 1, 0);
+				vReverseCounts.resize(lPositions + 1, 0);
+				for (long lCount = 0; (lCount < strForwardOutput.length()) && (lCount < lPositions); lCount++)
+				{
+					vForwardSums[lCount + 1] = strForwardOutput[lCount] - '0';
+					vForwardCounts[lCount + 1] = 1;
+				}
+				for (long lCount = 0; (lCount < strReverseOutput.length()) && (lCount < lPositions); lCount++)
+				{
+					//  The reverse count at index j is the nMer starting at forward position (length - nMer - j), 0-based
+					long lPosition = lPositions - lCount;
+
+					vReverseSums[lPosition] = strReverseOutput[lCount] - '0';
+					vReverseCounts[lPosition] = 1;
+				}
+				for (long lCount = 1; lCount <= lPositions; lCount++)
+				{
+					vForwardSums[lCount] += vForwardSums[lCount - 1];
+					vReverseSums[lCount] += vReverseSums[lCount - 1];
+					vForwardCounts[lCount] += vForwardCounts[lCount - 1];
+					vReverseCounts[lCount] += vReverseCounts[lCount - 1];
+				}
+
+				//  Sort CDSs by start
+				for (long lCount = 0; lCount < vCDSs.size(); lCount++)
+					vSorted.push_back(lCount);
+				sort(vSorted.begin(), vSorted.end(), [&vCDSs](long lA, long lB) { return vCDSs[lA].lStart < vCDSs[lB].lStart; });
+
+				strCDSTableEntries = "";
+
+				//  Sweep CDSs and the inter-CDS gaps between them
+				for (long lCount = 0; lCount <= vSorted.size(); lCount++)
+				{
+					//  Segment bounds, 1-based inclusive (past the last CDS, the gap runs to the end)
+					long lStart = (lCount < vSorted.size()) ? vCDSs[vSorted[lCount]].lStart : lPositions + 1;
+
+					//  Inter-CDS gap before this CDS
+					if (lStart > lCovered + 1)
+					{
+						//  Gap end
+						long lGapStop = ((lStart - 1) < lPositions) ? (lStart - 1) : lPositions;
+
+						if (lGapStop > lCovered)
+						{
+							//  Forward total
+							long lForward = vForwardSums[lGapStop] - vForwardSums[lCovered];
+							//  Reverse total
+							long lReverse = vReverseSums[lGapStop] - vReverseSums[lCovered];
+							//  nMer count
+							long lNMers = lGapStop - lCovered;
+							//  Forward counted nMers
+							long lForwardNMers = vForwardCounts[lGapStop] - vForwardCounts[lCovered];
+							//  Reverse counted nMers
+							long lReverseNMers = vReverseCounts[lGapStop] - vReverseCounts[lCovered];
+
+							lInterCount++;
+							if (!strCDSTableEntries.empty())
+								strCDSTableEntries += "\n";
+							strCDSTableEntries += strAccession + "~Inter-CDS~inter_" + ConvertLongToString(lInterCount) + "~n~" + ConvertLongToString(lCovered + 1) + "~" + ConvertLongToString(lGapStop) + "~" + ConvertLongToString(lNMers) + "~";
+							strCDSTableEntries += ConvertLongToString(lForward) + "~" + ConvertDoubleToString((lForwardNMers > 0) ? (double)lForward / (double)lForwardNMers : 0) + "~";
+							strCDSTableEntries += ConvertLongToString(lReverse) + "~" + ConvertDoubleToString((lReverseNMers > 0) ? (double)lReverse / (double)lReverseNMers : 0);
+						}
+					}
+
+					//  CDS
+					if (lCount < vSorted.size())
+					{
+						//  CDS
+						structCDS& stCDS = vCDSs[vSorted[lCount]];
+						//  Clamped start
+						long lFrom = (stCDS.lStart > 1) ? stCDS.lStart : 1;
+						//  Clamped stop
+						long lTo = (stCDS.lStop < lPositions) ? stCDS.lStop : lPositions;
+						//  nMer count
+						long lNMers = (lTo >= lFrom) ? (lTo - lFrom + 1) : 0;
+						//  Forward total
+						long lForward = (lNMers > 0) ? (vForwardSums[lTo] - vForwardSums[lFrom - 1]) : 0;
+						//  Reverse total
+						long lReverse = (lNMers > 0) ? (vReverseSums[lTo] - vReverseSums[lFrom - 1]) : 0;
+						//  Forward counted nMers
+						long lForwardNMers = (lNMers > 0) ? (vForwardCounts[lTo] - vForwardCounts[lFrom - 1]) : 0;
+						//  Reverse counted nMers
+						long lReverseNMers = (lNMers > 0) ? (vReverseCounts[lTo] - vReverseCounts[lFrom - 1]) : 0;
+
+						if (!strCDSTableEntries.empty())
+							strCDSTableEntries += "\n";
+						strCDSTableEntries += strAccession + "~CDS~" + stCDS.strNameID + "~" + stCDS.strIsComplement + "~" + ConvertLongToString(stCDS.lStart) + "~" + ConvertLongToString(stCDS.lStop) + "~" + ConvertLongToString(lNMers) + "~";
+						strCDSTableEntries += ConvertLongToString(lForward) + "~" + ConvertDoubleToString((lForwardNMers > 0) ? (double)lForward / (double)lForwardNMers : 0) + "~";
+						strCDSTableEntries += ConvertLongToString(lReverse) + "~" + ConvertDoubleToString((lReverseNMers > 0) ? (double)lReverse / (double)lReverseNMers : 0);
+
+						if (stCDS.lStop > lCovered)
+							lCovered = stCDS.lStop;
+					}
+				}
+
+				return true;
+			}
+			else
+			{
+				ReportTimeStamp("[CompileFDistanceCDSTableOutput]", "ERROR:  Mutation Counts are Empty");
+			}
+		}
+		else
+		{
+			ReportTimeStamp("[CompileFDistanceCDSTableOutput]", "ERROR:  Accession is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [CompileFDistanceCDSTableOutput] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Writes the F-Distance CDS table
+//         
+////////////////////////////////////////////////////////////////////////////////
+//
+//  [string&] strCDSTableFilePathName  :  CDS table file path name
+//  [vector<string>&] vCDSTableEntries :  CDS table entries to write (one element per sequence)
+//                                    :  returns true, if successful; else, false
+//         
+////////////////////////////////////////////////////////////////////////////////
+
+bool WriteFDistanceCDSTable(string& strCDSTableFilePathName, vector<string>& vCDSTableEntries)
+{
+	//  File text
+	string strFileText = "";
+
+	try
+	{
+		//  If CDS table file path name is not empty
+		if (!strCDSTableFilePathName.empty())
+		{
+			//  Add header
+			strFileText = GetFDistanceCDSTableHeader();
+
+			//  Iterate entries and concatenate file text
+			for (long lCount = 0; lCount < vCDSTableEntries.size(); lCount++)
+			{
+				if (!vCDSTableEntries[lCount].empty())
+					strFileText += vCDSTableEntries[lCount] + "\n";
+			}
+
+			//  Write CDS table
+			return WriteFileText(strCDSTableFilePathName, strFileText);
+		}
+		else
+		{
+			ReportTimeStamp("[WriteFDistanceCDSTable]", "ERROR:  F-Distance CDS Table File Path Name is Empty");
+		}
+	}
+	catch (exception ex)
+	{
+		cout << "ERROR [WriteFDistanceCDSTable] Exception Code:  " << ex.what() << "\n";
+	}
+
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  Parses input file path name for base path
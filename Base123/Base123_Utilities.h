@@ -16,11 +16,14 @@
 using namespace std;
 
 #include <deque>
+#include <unordered_map>
 
 void ReportTimeStamp(string strName, string strUpdate);
 bool GetFileText(string strFilePathName, stringstream& ssFileText);
 bool GetFileText(string strFilePathName, string& strFileText);
+bool GetFileFirstLine(string strFilePathName, string& strFirstLine);
 bool WriteFileText(string strFilePathName, string& strFileText);
+bool AppendFileText(string strFilePathName, string& strFileText);
 bool CreateFolderPath(string strFolderPathName);
 bool ChangeWorkingFolder(string strFolderPathName);
 bool IsFilePresent(string strInputFilePathName);
@@ -34,6 +37,13 @@ string GetFDistanceOutputTableHeader();
 string GetContabulatedFDistanceOutputTableHeader(int nOutputCount);
 double ScoreFDistanceMutationString(string& strMutationCount, long& lTotalCount);
 bool CompileFDistanceTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, string& strOutputTableEntry, bool bForContabulation, bool bAppendOnly);
+string GetFDistanceOutputFilePathName(string& strInputFilePathName, string& strOutputFileNameSuffix);
+bool ReadFDistanceJournal(string strJournalFilePathName, unordered_map<string, string>& umJournalEntries);
+bool ValidateFDistanceOutput(string& strOutputFilePathName, string& strJournalEntry, int nLineCount);
+bool ReadFDistanceOutput(string& strOutputFilePathName, string& strForwardOutput, string& strReverseOutput);
+string GetFDistanceCDSTableHeader();
+bool CompileFDistanceCDSTableOutput(string& strAccession, string& strForwardOutput, string& strReverseOutput, long lSequenceLength, int nNMerLength, vector<structCDS>& vCDSs, string& strCDSTableEntries);
+bool WriteFDistanceCDSTable(string& strCDSTableFilePathName, vector<string>& vCDSTableEntries);
 string GetBasePath(string strInputFilePathName);
 string GetBaseFileName(string strInputFilePathName);
 string GetFileNameExceptLastExtension(string strInputFilePathName);